@@ -122,6 +122,11 @@ RO="-ij -sstruct -struct -lobpcg -rt -D HYPRE_NO_SAVED -nthreads 2"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $RO
 ./renametest.sh basic $output_dir/basic--with-concurrent-hopscotch
 
+co="--enable-persistent --enable-debug"
+RO="-ij -sstruct -struct"
+./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $RO
+./renametest.sh basic $output_dir/basic--enable-persistent
+
 co="--enable-single --enable-debug"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: -single
 ./renametest.sh basic $output_dir/basic--enable-single
@@ -180,6 +185,10 @@ co="-DHYPRE_BIGINT=ON"
 ./test.sh cmake.sh $src_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh cmake $output_dir/cmake-bigint
 
+co="-DHYPRE_ENABLE_PERSISTENT_COMM=ON"
+./test.sh cmake.sh $src_dir -co: $co -mo: $mo -ro: -ij -sstruct -struct
+./renametest.sh cmake $output_dir/cmake-persistent
+
 # cmake build doesn't currently support maxdim
 # cmake build doesn't currently support complex
 
@@ -1042,6 +1042,9 @@ hypre_IJMatrixSetConstantValuesParCSRHost( hypre_IJMatrix *matrix,
    HYPRE_Int           nnz_offd   = hypre_CSRMatrixNumNonzeros(offd);
    HYPRE_Int           ii;
 
+   hypre_CSRMatrixSellDestroy(diag);
+   hypre_CSRMatrixSellDestroy(offd);
+
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
 #endif
@@ -2447,6 +2450,10 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
 
    max_num_threads = hypre_NumThreads();
 
+   /* values may have been changed in place: drop the SELL copies */
+   hypre_CSRMatrixSellDestroy(diag);
+   hypre_CSRMatrixSellDestroy(offd);
+
    /* first find out if anyone has an aux_matrix, and create one if you don't
     * have one, but other procs do */
    aux_flag = 0;
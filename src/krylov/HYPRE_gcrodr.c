@@ -0,0 +1,276 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * HYPRE_GCRODR interface
+ *
+ *****************************************************************************/
+#include "krylov.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetup( HYPRE_Solver solver,
+                   HYPRE_Matrix A,
+                   HYPRE_Vector b,
+                   HYPRE_Vector x      )
+{
+   return( hypre_GCRODRSetup( solver, A, b, x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSolve( HYPRE_Solver solver,
+                   HYPRE_Matrix A,
+                   HYPRE_Vector b,
+                   HYPRE_Vector x      )
+{
+   return( hypre_GCRODRSolve( solver, A, b, x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetKDim, HYPRE_GCRODRGetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetKDim( HYPRE_Solver solver,
+                     HYPRE_Int  k_dim )
+{
+   return( hypre_GCRODRSetKDim( (void *) solver, k_dim ) );
+}
+
+HYPRE_Int
+HYPRE_GCRODRGetKDim( HYPRE_Solver solver,
+                     HYPRE_Int  *k_dim )
+{
+   return( hypre_GCRODRGetKDim( (void *) solver, k_dim ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetRecycleDim, HYPRE_GCRODRGetRecycleDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetRecycleDim( HYPRE_Solver solver,
+                           HYPRE_Int  recycle_dim )
+{
+   return( hypre_GCRODRSetRecycleDim( (void *) solver, recycle_dim ) );
+}
+
+HYPRE_Int
+HYPRE_GCRODRGetRecycleDim( HYPRE_Solver solver,
+                           HYPRE_Int  *recycle_dim )
+{
+   return( hypre_GCRODRGetRecycleDim( (void *) solver, recycle_dim ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRGetNumRecycled
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRGetNumRecycled( HYPRE_Solver solver,
+                            HYPRE_Int  *num_recycled )
+{
+   return( hypre_GCRODRGetNumRecycled( (void *) solver, num_recycled ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRClearRecycled
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRClearRecycled( HYPRE_Solver solver )
+{
+   return( hypre_GCRODRClearRecycled( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetTol, HYPRE_GCRODRGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetTol( HYPRE_Solver solver,
+                    HYPRE_Real tol )
+{
+   return( hypre_GCRODRSetTol( (void *) solver, tol ) );
+}
+
+HYPRE_Int
+HYPRE_GCRODRGetTol( HYPRE_Solver solver,
+                    HYPRE_Real *tol )
+{
+   return( hypre_GCRODRGetTol( (void *) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetAbsoluteTol, HYPRE_GCRODRGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetAbsoluteTol( HYPRE_Solver solver,
+                            HYPRE_Real a_tol )
+{
+   return( hypre_GCRODRSetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+HYPRE_Int
+HYPRE_GCRODRGetAbsoluteTol( HYPRE_Solver solver,
+                            HYPRE_Real *a_tol )
+{
+   return( hypre_GCRODRGetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetMinIter, HYPRE_GCRODRGetMinIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetMinIter( HYPRE_Solver solver,
+                        HYPRE_Int  min_iter )
+{
+   return( hypre_GCRODRSetMinIter( (void *) solver, min_iter ) );
+}
+
+HYPRE_Int
+HYPRE_GCRODRGetMinIter( HYPRE_Solver solver,
+                        HYPRE_Int  *min_iter )
+{
+   return( hypre_GCRODRGetMinIter( (void *) solver, min_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetMaxIter, HYPRE_GCRODRGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetMaxIter( HYPRE_Solver solver,
+                        HYPRE_Int  max_iter )
+{
+   return( hypre_GCRODRSetMaxIter( (void *) solver, max_iter ) );
+}
+
+HYPRE_Int
+HYPRE_GCRODRGetMaxIter( HYPRE_Solver solver,
+                        HYPRE_Int  *max_iter )
+{
+   return( hypre_GCRODRGetMaxIter( (void *) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetPrecond( HYPRE_Solver          solver,
+                        HYPRE_PtrToSolverFcn  precond,
+                        HYPRE_PtrToSolverFcn  precond_setup,
+                        HYPRE_Solver          precond_solver )
+{
+   return( hypre_GCRODRSetPrecond( (void *) solver,
+                                   (HYPRE_Int (*)(void*, void*, void*, void*))precond,
+                                   (HYPRE_Int (*)(void*, void*, void*, void*))precond_setup,
+                                   (void *) precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRGetPrecond( HYPRE_Solver  solver,
+                        HYPRE_Solver *precond_data_ptr )
+{
+   return( hypre_GCRODRGetPrecond( (void *)     solver,
+                                   (HYPRE_Solver *) precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetPrintLevel, HYPRE_GCRODRGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetPrintLevel( HYPRE_Solver solver,
+                           HYPRE_Int  level )
+{
+   return( hypre_GCRODRSetPrintLevel( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_GCRODRGetPrintLevel( HYPRE_Solver solver,
+                           HYPRE_Int  *level )
+{
+   return( hypre_GCRODRGetPrintLevel( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRSetLogging, HYPRE_GCRODRGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRSetLogging( HYPRE_Solver solver,
+                        HYPRE_Int  level )
+{
+   return( hypre_GCRODRSetLogging( (void *) solver, level ) );
+}
+
+HYPRE_Int
+HYPRE_GCRODRGetLogging( HYPRE_Solver solver,
+                        HYPRE_Int  *level )
+{
+   return( hypre_GCRODRGetLogging( (void *) solver, level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRGetNumIterations( HYPRE_Solver solver,
+                              HYPRE_Int  *num_iterations )
+{
+   return( hypre_GCRODRGetNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRGetConverged( HYPRE_Solver solver,
+                          HYPRE_Int  *converged )
+{
+   return( hypre_GCRODRGetConverged( (void *) solver, converged ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRGetFinalRelativeResidualNorm( HYPRE_Solver solver,
+                                          HYPRE_Real *norm )
+{
+   return( hypre_GCRODRGetFinalRelativeResidualNorm( (void *) solver, norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_GCRODRGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GCRODRGetResidual( HYPRE_Solver solver, void *residual )
+{
+   /* returns a pointer to the residual vector */
+   return hypre_GCRODRGetResidual( (void *) solver, (void **) residual );
+}
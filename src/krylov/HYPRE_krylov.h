@@ -174,10 +174,24 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 
 /**
  * (Optional) Periodically recompute the residual while iterating.
+ * With pipelined PCG, this also replaces the auxiliary recurrences,
+ * which limits the drift between the recursive and the true residual.
  **/
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                          HYPRE_Int    recompute_residual_p);
 
+/**
+ * (Optional) Use the pipelined variant of PCG (Ghysels and Vanroose).
+ * The inner products of an iteration are combined into one non-blocking
+ * reduction that overlaps with the preconditioner and the matvec, at the
+ * cost of extra vector updates and storage for six more vectors. The
+ * iterates match standard PCG in exact arithmetic; use
+ * \e HYPRE_PCGSetRecomputeResidualP to control roundoff drift. Must be set
+ * before setup. The default is 0 (standard PCG).
+ **/
+HYPRE_Int HYPRE_PCGSetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -818,6 +832,183 @@ HYPRE_Int HYPRE_LGMRESGetPrintLevel(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_LGMRESGetConverged(HYPRE_Solver  solver,
                                    HYPRE_Int    *converged);
 
+/**@}*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name GCRODR Solver
+ *
+ * @{
+ **/
+
+/**
+ * Prepare to solve the system.  The coefficient data in \e b and \e x is
+ * ignored here, but information about the layout of the data may be used.
+ * Calling setup again (e.g., after the matrix has changed) keeps the
+ * recycled subspace; it is re-orthogonalized against the new operator at the
+ * start of the next solve.
+ **/
+HYPRE_Int HYPRE_GCRODRSetup(HYPRE_Solver solver,
+                            HYPRE_Matrix A,
+                            HYPRE_Vector b,
+                            HYPRE_Vector x);
+
+/**
+ * Solve the system with GCRO-DR, a restarted flexible GMRES that deflates a
+ * recycled subspace carried from one cycle, and one solve, to the next.
+ * Details may be found in M. L. Parks, E. de Sturler, G. Mackey, D. D. Johnson
+ * and S. Maiti, "Recycling Krylov subspaces for sequences of linear systems,"
+ * SIAM Journal on Scientific Computing, 28 (2006), pp. 1651-1674.
+ * GCRODR(m,k) in the paper corresponds to GCRODR(KDim, RecycleDim).
+ **/
+HYPRE_Int HYPRE_GCRODRSolve(HYPRE_Solver solver,
+                            HYPRE_Matrix A,
+                            HYPRE_Vector b,
+                            HYPRE_Vector x);
+
+/**
+ * (Optional) Set the convergence tolerance.
+ **/
+HYPRE_Int HYPRE_GCRODRSetTol(HYPRE_Solver solver,
+                             HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the absolute convergence tolerance (default is 0).
+ * (The convergence test is \f$\|r\| \leq\f$
+ * max(relative\f$\_\f$tolerance\f$\ast \|b\|\f$, absolute\f$\_\f$tolerance).)
+ **/
+HYPRE_Int HYPRE_GCRODRSetAbsoluteTol(HYPRE_Solver solver,
+                                     HYPRE_Real   a_tol);
+
+/*
+ * RE-VISIT
+ **/
+HYPRE_Int HYPRE_GCRODRSetMinIter(HYPRE_Solver solver,
+                                 HYPRE_Int    min_iter);
+
+/**
+ * (Optional) Set maximum number of iterations.
+ **/
+HYPRE_Int HYPRE_GCRODRSetMaxIter(HYPRE_Solver solver,
+                                 HYPRE_Int    max_iter);
+
+/**
+ * (Optional) Set the maximum size of the approximation space, including the
+ * recycled vectors (default: 30).  Must be called before setup.
+ **/
+HYPRE_Int HYPRE_GCRODRSetKDim(HYPRE_Solver solver,
+                              HYPRE_Int    k_dim);
+
+/**
+ * (Optional) Set the number of recycled vectors (default: 10).  At most
+ * KDim-1 are used, and 0 gives flexible GMRES.  Must be called before setup.
+ **/
+HYPRE_Int HYPRE_GCRODRSetRecycleDim(HYPRE_Solver solver,
+                                    HYPRE_Int    recycle_dim);
+
+/**
+ * Discard the recycled subspace, e.g., when the next system is unrelated.
+ **/
+HYPRE_Int HYPRE_GCRODRClearRecycled(HYPRE_Solver solver);
+
+/**
+ * (Optional) Set the preconditioner to use.  The preconditioner may change
+ * between iterations.
+ **/
+HYPRE_Int HYPRE_GCRODRSetPrecond(HYPRE_Solver         solver,
+                                 HYPRE_PtrToSolverFcn precond,
+                                 HYPRE_PtrToSolverFcn precond_setup,
+                                 HYPRE_Solver         precond_solver);
+
+/**
+ * (Optional) Set the amount of logging to do.
+ **/
+HYPRE_Int HYPRE_GCRODRSetLogging(HYPRE_Solver solver,
+                                 HYPRE_Int    logging);
+
+/**
+ * (Optional) Set the amount of printing to do to the screen.
+ **/
+HYPRE_Int HYPRE_GCRODRSetPrintLevel(HYPRE_Solver solver,
+                                    HYPRE_Int    level);
+
+/**
+ * Return the number of iterations taken.
+ **/
+HYPRE_Int HYPRE_GCRODRGetNumIterations(HYPRE_Solver  solver,
+                                       HYPRE_Int    *num_iterations);
+
+/**
+ * Return the norm of the final relative residual.
+ **/
+HYPRE_Int HYPRE_GCRODRGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                   HYPRE_Real   *norm);
+
+/**
+ * Return the residual.
+ **/
+HYPRE_Int HYPRE_GCRODRGetResidual(HYPRE_Solver   solver,
+                                  void          *residual);
+
+/**
+ * Return the current number of recycled vectors.
+ **/
+HYPRE_Int HYPRE_GCRODRGetNumRecycled(HYPRE_Solver  solver,
+                                     HYPRE_Int    *num_recycled);
+
+/**
+ **/
+HYPRE_Int HYPRE_GCRODRGetTol(HYPRE_Solver  solver,
+                             HYPRE_Real   *tol);
+
+/**
+ **/
+HYPRE_Int HYPRE_GCRODRGetAbsoluteTol(HYPRE_Solver  solver,
+                                     HYPRE_Real   *a_tol);
+
+/*
+ * RE-VISIT
+ **/
+HYPRE_Int HYPRE_GCRODRGetMinIter(HYPRE_Solver solver,
+                                 HYPRE_Int   *min_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_GCRODRGetMaxIter(HYPRE_Solver  solver,
+                                 HYPRE_Int    *max_iter);
+
+/**
+ **/
+HYPRE_Int HYPRE_GCRODRGetKDim(HYPRE_Solver  solver,
+                              HYPRE_Int    *k_dim);
+
+/**
+ **/
+HYPRE_Int HYPRE_GCRODRGetRecycleDim(HYPRE_Solver  solver,
+                                    HYPRE_Int    *recycle_dim);
+
+/**
+ **/
+HYPRE_Int HYPRE_GCRODRGetPrecond(HYPRE_Solver  solver,
+                                 HYPRE_Solver *precond_data_ptr);
+
+/**
+ **/
+HYPRE_Int HYPRE_GCRODRGetLogging(HYPRE_Solver  solver,
+                                 HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_GCRODRGetPrintLevel(HYPRE_Solver  solver,
+                                    HYPRE_Int    *level);
+
+/**
+ **/
+HYPRE_Int HYPRE_GCRODRGetConverged(HYPRE_Solver  solver,
+                                   HYPRE_Int    *converged);
+
 /**** added by KS ****** */
 /**
  * @name COGMRES Solver
@@ -896,6 +1087,18 @@ HYPRE_Int HYPRE_COGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_COGMRESSetCGS(HYPRE_Solver solver,
                               HYPRE_Int    cgs);
 
+/**
+ * (Optional) Build the Krylov basis in blocks of {\tt s\_step} vectors with
+ * a Newton polynomial and orthogonalize each block at once with block
+ * Gram-Schmidt and CholQR2, so that a restart cycle needs two global
+ * reductions per block instead of one or two per vector.  The Newton shifts
+ * are Ritz values from the first restart cycle, which runs the standard
+ * Arnoldi process.  If a block loses rank, it is truncated and the missing
+ * vectors are generated one at a time.  Default: 1 (off).
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStep(HYPRE_Solver solver,
+                                HYPRE_Int    s_step);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -977,6 +1180,11 @@ HYPRE_Int HYPRE_COGMRESGetUnroll(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_COGMRESGetCGS(HYPRE_Solver  solver,
                               HYPRE_Int    *cgs);
 
+/**
+ **/
+HYPRE_Int HYPRE_COGMRESGetSStep(HYPRE_Solver  solver,
+                                HYPRE_Int    *s_step);
+
 /**
  **/
 HYPRE_Int HYPRE_COGMRESGetPrecond(HYPRE_Solver  solver,
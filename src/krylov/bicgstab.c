@@ -31,6 +31,9 @@ hypre_BiCGSTABFunctionsCreate(
    HYPRE_Int  (*ClearVector)   ( void *x ),
    HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha , void *x ),
    HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha , void *x , void *y ),
+   HYPRE_Real (*Axpy2InnerProd)( HYPRE_Complex alpha , void *x , void *y ,
+                                 HYPRE_Complex beta , void *z , void *w ),
+   HYPRE_Int  (*Xpay)          ( HYPRE_Complex beta , void *x , void *y ),
    HYPRE_Int  (*CommInfo)      ( void *A , HYPRE_Int *my_id ,
                                  HYPRE_Int *num_procs ),
    HYPRE_Int  (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
@@ -51,6 +54,8 @@ hypre_BiCGSTABFunctionsCreate(
    bicgstab_functions->ClearVector = ClearVector;
    bicgstab_functions->ScaleVector = ScaleVector;
    bicgstab_functions->Axpy = Axpy;
+   bicgstab_functions->Axpy2InnerProd = Axpy2InnerProd;
+   bicgstab_functions->Xpay = Xpay;
    bicgstab_functions->CommInfo = CommInfo;
    bicgstab_functions->precond_setup = PrecondSetup;
    bicgstab_functions->precond = Precond;
@@ -445,10 +450,17 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
             gamma = 0.0;
         else
             gamma= gamma_numer/gamma_denom;
-	(*(bicgstab_functions->Axpy))(gamma,v,x);
-	(*(bicgstab_functions->Axpy))(-gamma,s,r);
-    /* residual is now updated, must immediately check for convergence */
-	r_norm = sqrt((*(bicgstab_functions->InnerProd))(r,r));
+    /* residual is updated, must immediately check for convergence */
+	if (bicgstab_functions->Axpy2InnerProd)
+	{
+	   r_norm = sqrt((*(bicgstab_functions->Axpy2InnerProd))(gamma,v,x,-gamma,s,r));
+	}
+	else
+	{
+	   (*(bicgstab_functions->Axpy))(gamma,v,x);
+	   (*(bicgstab_functions->Axpy))(-gamma,s,r);
+	   r_norm = sqrt((*(bicgstab_functions->InnerProd))(r,r));
+	}
 	if (logging > 0 || print_level > 0)
 	{
 	   norms[iter] = r_norm;
@@ -509,16 +521,23 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
        res = (*(bicgstab_functions->InnerProd))(r0,r);
        beta *= res;
        (*(bicgstab_functions->Axpy))(-gamma,q,p);
-       if (fabs(gamma) >= epsmac)
-           (*(bicgstab_functions->ScaleVector))((beta*alpha/gamma),p);
-       else
+       if (fabs(gamma) < epsmac)
        {
 	  hypre_error_w_msg(HYPRE_ERROR_GENERIC,"BiCGSTAB broke down!! gamma=0 \n");
           HYPRE_ANNOTATE_FUNC_END;
 
 	  return hypre_error_flag;
        }
-       (*(bicgstab_functions->Axpy))(1.0,r,p);
+       /* p = r + (beta*alpha/gamma)*p */
+       if (bicgstab_functions->Xpay)
+       {
+          (*(bicgstab_functions->Xpay))((beta*alpha/gamma),r,p);
+       }
+       else
+       {
+          (*(bicgstab_functions->ScaleVector))((beta*alpha/gamma),p);
+          (*(bicgstab_functions->Axpy))(1.0,r,p);
+       }
    } /* end while loop */
 
    (bicgstab_data -> num_iterations) = iter;
@@ -81,6 +81,9 @@ typedef struct
   HYPRE_Int  (*ClearVector)   ( void *x );
   HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha , void *x );
   HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha , void *x , void *y );
+  HYPRE_Real (*Axpy2InnerProd)( HYPRE_Complex alpha , void *x , void *y ,
+                                HYPRE_Complex beta , void *z , void *w );
+  HYPRE_Int  (*Xpay)          ( HYPRE_Complex beta , void *x , void *y );
   HYPRE_Int  (*CommInfo)      ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
 	HYPRE_Int  (*precond_setup) (void *vdata , void *A , void *b , void *x);
 	HYPRE_Int  (*precond)       (void *vdata , void *A , void *b , void *x);
@@ -158,6 +161,9 @@ hypre_BiCGSTABFunctionsCreate(
    HYPRE_Int  (*ClearVector)   ( void *x ),
    HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha , void *x ),
    HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha , void *x , void *y ),
+   HYPRE_Real (*Axpy2InnerProd)( HYPRE_Complex alpha , void *x , void *y ,
+                                 HYPRE_Complex beta , void *z , void *w ),
+   HYPRE_Int  (*Xpay)          ( HYPRE_Complex beta , void *x , void *y ),
    HYPRE_Int  (*CommInfo)      ( void *A , HYPRE_Int *my_id ,
                                  HYPRE_Int *num_procs ),
    HYPRE_Int  (*PrecondSetup)  (void *vdata, void *A, void *b, void *x ),
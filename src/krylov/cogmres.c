@@ -33,6 +33,7 @@ hypre_COGMRESFunctionsCreate(
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
    HYPRE_Int    (*MassInnerProd) (void *x, void **y, HYPRE_Int k, HYPRE_Int unroll, void *result),
+   HYPRE_Int    (*MassInnerProdMult) (void **x, HYPRE_Int nx, void **y, HYPRE_Int k, HYPRE_Int unroll, void *result),
    HYPRE_Int    (*MassDotpTwo)   (void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
    HYPRE_Int    (*ClearVector)   ( void *x ),
@@ -58,6 +59,7 @@ hypre_COGMRESFunctionsCreate(
    cogmres_functions->MatvecDestroy     = MatvecDestroy;
    cogmres_functions->InnerProd         = InnerProd;
    cogmres_functions->MassInnerProd     = MassInnerProd;
+   cogmres_functions->MassInnerProdMult = MassInnerProdMult;
    cogmres_functions->MassDotpTwo       = MassDotpTwo;
    cogmres_functions->CopyVector        = CopyVector;
    cogmres_functions->ClearVector       = ClearVector;
@@ -88,6 +90,7 @@ hypre_COGMRESCreate( hypre_COGMRESFunctions *cogmres_functions )
    /* set defaults */
    (cogmres_data -> k_dim)          = 5;
    (cogmres_data -> cgs)            = 1; /* if 2 performs reorthogonalization */
+   (cogmres_data -> s_step)         = 1; /* if > 1 builds the basis in blocks */
    (cogmres_data -> tol)            = 1.0e-06; /* relative residual tol */
    (cogmres_data -> cf_tol)         = 0.0;
    (cogmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -241,6 +244,500 @@ hypre_COGMRESSetup( void *cogmres_vdata,
 
    return hypre_error_flag;
 }
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESRitzValues
+ *
+ * Real parts of the eigenvalues of the leading m x m block of the
+ * (unrotated) Hessenberg matrix hu, computed with shifted QR iterations.
+ * They only serve as Newton shifts, so a rough answer is good enough.
+ * a must hold m*(m+2) values.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_COGMRESRitzValues( HYPRE_Int   m,
+                         HYPRE_Real *hu,
+                         HYPRE_Int   ld,
+                         HYPRE_Real *wr,
+                         HYPRE_Real *a )
+{
+   HYPRE_Real *cs = a + m*m;
+   HYPRE_Real *sn = cs + m;
+   HYPRE_Real eps = HYPRE_REAL_EPSILON;
+   HYPRE_Int  n, k, col, row, its;
+   HYPRE_Real mu, sub, tr, disc, x, y, rr, c, s, t1, t2;
+   HYPRE_Real p11, p12, p21, p22;
+
+   for (row = 0; row < m; row++)
+   {
+      for (col = 0; col < m; col++)
+      {
+         a[row*m+col] = (row <= col+1) ? hu[col*ld+row] : 0.0;
+      }
+   }
+
+   n = m;
+   its = 0;
+   while (n > 0)
+   {
+      if (n == 1)
+      {
+         wr[0] = a[0];
+         break;
+      }
+
+      p11 = a[(n-2)*m+n-2];
+      p12 = a[(n-2)*m+n-1];
+      p21 = a[(n-1)*m+n-2];
+      p22 = a[(n-1)*m+n-1];
+
+      /* deflate a converged eigenvalue */
+      sub = fabs(p21);
+      if (sub <= eps*(fabs(p11) + fabs(p22)))
+      {
+         wr[n-1] = p22;
+         n--;
+         its = 0;
+         continue;
+      }
+
+      /* deflate an isolated 2x2 block (possibly a complex pair) */
+      tr   = 0.5*(p11 + p22);
+      disc = tr*tr - (p11*p22 - p12*p21);
+      if (n == 2 || fabs(a[(n-2)*m+n-3]) <= eps*(fabs(p11) + fabs(a[(n-3)*m+n-3])))
+      {
+         if (disc >= 0.0)
+         {
+            wr[n-2] = tr + sqrt(disc);
+            wr[n-1] = tr - sqrt(disc);
+         }
+         else
+         {
+            wr[n-2] = wr[n-1] = tr;
+         }
+         n -= 2;
+         its = 0;
+         continue;
+      }
+
+      if (its == 50)
+      {
+         /* no convergence: the diagonal is still a usable set of shifts */
+         for (k = 0; k < n; k++)
+         {
+            wr[k] = a[k*m+k];
+         }
+         break;
+      }
+
+      /* Wilkinson shift, or the real part of a complex pair */
+      if (disc >= 0.0)
+      {
+         mu = (fabs(tr + sqrt(disc) - p22) < fabs(tr - sqrt(disc) - p22)) ?
+              tr + sqrt(disc) : tr - sqrt(disc);
+      }
+      else
+      {
+         mu = tr;
+      }
+      if (its % 10 == 9)
+      {
+         mu += sub;
+      }
+      its++;
+
+      /* H - mu I = QR, H <- RQ + mu I on the active block */
+      for (k = 0; k < n; k++)
+      {
+         a[k*m+k] -= mu;
+      }
+      for (k = 0; k < n-1; k++)
+      {
+         x  = a[k*m+k];
+         y  = a[(k+1)*m+k];
+         rr = sqrt(x*x + y*y);
+         c  = (rr > 0.0) ? x/rr : 1.0;
+         s  = (rr > 0.0) ? y/rr : 0.0;
+         for (col = k; col < n; col++)
+         {
+            t1 = a[k*m+col];
+            t2 = a[(k+1)*m+col];
+            a[k*m+col]     =  c*t1 + s*t2;
+            a[(k+1)*m+col] = -s*t1 + c*t2;
+         }
+         cs[k] = c;
+         sn[k] = s;
+      }
+      for (k = 0; k < n-1; k++)
+      {
+         c = cs[k];
+         s = sn[k];
+         for (row = 0; row <= k+1; row++)
+         {
+            t1 = a[row*m+k];
+            t2 = a[row*m+k+1];
+            a[row*m+k]   =  c*t1 + s*t2;
+            a[row*m+k+1] = -s*t1 + c*t2;
+         }
+      }
+      for (k = 0; k < n; k++)
+      {
+         a[k*m+k] += mu;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESLejaShifts
+ *
+ * Picks s shifts out of the m Ritz values wr in (modified) Leja order,
+ * reusing them cyclically if m < s.  used must hold m values.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_COGMRESLejaShifts( HYPRE_Int   m,
+                         HYPRE_Real *wr,
+                         HYPRE_Int   s,
+                         HYPRE_Real *theta,
+                         HYPRE_Int  *used )
+{
+   HYPRE_Int  k, l, t, best, num_used = 0;
+   HYPRE_Real val, best_val;
+
+   for (k = 0; k < m; k++)
+   {
+      used[k] = 0;
+   }
+
+   for (l = 0; l < s; l++)
+   {
+      if (num_used == m)
+      {
+         for (k = 0; k < m; k++)
+         {
+            used[k] = 0;
+         }
+         num_used = 0;
+      }
+
+      best = -1;
+      best_val = 0.0;
+      for (k = 0; k < m; k++)
+      {
+         if (used[k])
+         {
+            continue;
+         }
+         if (l == 0)
+         {
+            val = fabs(wr[k]);
+         }
+         else
+         {
+            /* log of the product of distances, to avoid overflow */
+            val = 0.0;
+            for (t = 0; t < l; t++)
+            {
+               val += log(fabs(wr[k] - theta[t]) + HYPRE_REAL_MIN);
+            }
+         }
+         if (best < 0 || val > best_val)
+         {
+            best = k;
+            best_val = val;
+         }
+      }
+      theta[l] = wr[best];
+      used[best] = 1;
+      num_used++;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESCholesky
+ *
+ * Upper triangular R with R^T R = G for the n x n Gram matrix G (row-major),
+ * computed on the matrix equilibrated with d[l] = 1/sqrt(S[l][l]), where S
+ * is the Gram matrix before projection.  Stops at the first column whose
+ * relative pivot is too small and returns the number of columns factored.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESCholesky( HYPRE_Int   n,
+                       HYPRE_Real *G,
+                       HYPRE_Real *sdiag,
+                       HYPRE_Real *R )
+{
+   HYPRE_Int  k, l, t, nf;
+   HYPRE_Real piv;
+
+   for (nf = 0; nf < n; nf++)
+   {
+      l = nf;
+      if (!(sdiag[l] > 0.0))
+      {
+         break;
+      }
+      for (k = 0; k < l; k++)
+      {
+         piv = G[k*n+l]/sqrt(sdiag[k]*sdiag[l]);
+         for (t = 0; t < k; t++)
+         {
+            piv -= R[t*n+k]*R[t*n+l];
+         }
+         R[k*n+l] = piv/R[k*n+k];
+      }
+      piv = G[l*n+l]/sdiag[l];
+      for (t = 0; t < l; t++)
+      {
+         piv -= R[t*n+l]*R[t*n+l];
+      }
+      /* the projection cancelled more than half of the digits */
+      if (piv <= 1.0e-10)
+      {
+         break;
+      }
+      R[l*n+l] = sqrt(piv);
+      for (k = l+1; k < n; k++)
+      {
+         R[k*n+l] = 0.0;
+      }
+   }
+
+   /* undo the equilibration */
+   for (l = 0; l < nf; l++)
+   {
+      for (k = 0; k <= l; k++)
+      {
+         R[k*n+l] *= sqrt(sdiag[l]);
+      }
+   }
+
+   return nf;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESBlockOrthog
+ *
+ * One pass of block classical Gram-Schmidt followed by CholQR on the nb
+ * vectors W = p[q..q+nb-1] against the orthonormal p[0..q-1]:
+ *
+ *    W <- (W - Q C) R^{-1},   C = Q^T W,   R^T R = W^T W - C^T C
+ *
+ * C (q x nb) and R (nb x nb) are row-major with leading dimension ld.
+ * All inner products are done in one reduction.  Returns the number of
+ * leading columns of W that were kept.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESBlockOrthog( hypre_COGMRESFunctions *cogmres_functions,
+                          void                  **p,
+                          HYPRE_Int               q,
+                          HYPRE_Int               nb,
+                          HYPRE_Int               unroll,
+                          HYPRE_Int               ld,
+                          HYPRE_Real             *C,
+                          HYPRE_Real             *R,
+                          HYPRE_Real             *work )
+{
+   HYPRE_Int      n = q + nb;
+   HYPRE_Real    *G     = work;
+   HYPRE_Real    *gram  = G + nb*n;
+   HYPRE_Real    *sdiag = gram + nb*nb;
+   HYPRE_Real    *Rn    = sdiag + nb;
+   HYPRE_Complex *alpha = (HYPRE_Complex *) (Rn + nb*nb);
+   HYPRE_Int      k, l, m, nf;
+
+   /* G[l*n+m] = <W_l, p_m> for m < q+nb */
+   (*(cogmres_functions->MassInnerProdMult))(&p[q], nb, p, n, unroll, G);
+
+   for (l = 0; l < nb; l++)
+   {
+      for (m = 0; m < q; m++)
+      {
+         C[m*ld+l] = G[l*n+m];
+      }
+      sdiag[l] = G[l*n+q+l];
+   }
+   for (k = 0; k < nb; k++)
+   {
+      for (l = 0; l < nb; l++)
+      {
+         gram[k*nb+l] = G[l*n+q+k];
+         for (m = 0; m < q; m++)
+         {
+            gram[k*nb+l] -= C[m*ld+k]*C[m*ld+l];
+         }
+      }
+   }
+
+   nf = hypre_COGMRESCholesky(nb, gram, sdiag, Rn);
+
+   for (l = 0; l < nf; l++)
+   {
+      for (m = 0; m < q; m++)
+      {
+         alpha[m] = -C[m*ld+l];
+      }
+      (*(cogmres_functions->MassAxpy))(alpha, p, p[q+l], q, unroll);
+      if (l > 0)
+      {
+         for (m = 0; m < l; m++)
+         {
+            alpha[m] = -Rn[m*nb+l];
+         }
+         (*(cogmres_functions->MassAxpy))(alpha, &p[q], p[q+l], l, unroll);
+      }
+      (*(cogmres_functions->ScaleVector))(1.0/Rn[l*nb+l], p[q+l]);
+
+      for (m = 0; m <= l; m++)
+      {
+         R[m*ld+l] = Rn[m*nb+l];
+      }
+   }
+
+   return nf;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSStepBlock
+ *
+ * Extends the orthonormal basis p[0..j] by up to nb vectors at once.  The
+ * Newton basis v_0 = p[j], v_{l+1} = (A M^{-1} - theta_l) v_l is built in
+ * p[j+1..j+nb], orthogonalized with two block Gram-Schmidt/CholQR passes
+ * (BCGS2 with CholQR2), and the Hessenberg columns j..j+nb-1 are recovered
+ * from the change of basis.  hu holds the unrotated Hessenberg matrix and
+ * is extended in place, the new columns are also copied into hh.  Returns
+ * the number of columns computed, 0 if the block broke down right away.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESSStepBlock( hypre_COGMRESData *cogmres_data,
+                         void              *A,
+                         HYPRE_Int          j,
+                         HYPRE_Int          nb,
+                         HYPRE_Real        *theta,
+                         HYPRE_Real        *hu,
+                         HYPRE_Real        *hh )
+{
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data->functions;
+   HYPRE_Int     k_dim        = (cogmres_data -> k_dim);
+   HYPRE_Int     unroll       = (cogmres_data -> unroll);
+   void         *matvec_data  = (cogmres_data -> matvec_data);
+   void         *r            = (cogmres_data -> r);
+   void        **p            = (cogmres_data -> p);
+   void         *precond_data = (cogmres_data -> precond_data);
+   HYPRE_Int   (*precond)(void*,void*,void*,void*) = (cogmres_functions -> precond);
+
+   HYPRE_Int     ld = k_dim+1;
+   HYPRE_Int     q  = j+1;
+   HYPRE_Int     nrows = q+nb;
+   HYPRE_Int     ldc = nb;   /* leading dimension of C, R, C2 and R2 */
+   HYPRE_Int     nf, nf2, k, l, m;
+   HYPRE_Real   *C, *R, *C2, *R2, *T, *H, *work;
+
+   C    = hypre_CTAllocF(HYPRE_Real, q*nb, cogmres_functions, HYPRE_MEMORY_HOST);
+   R    = hypre_CTAllocF(HYPRE_Real, nb*nb, cogmres_functions, HYPRE_MEMORY_HOST);
+   C2   = hypre_CTAllocF(HYPRE_Real, q*nb, cogmres_functions, HYPRE_MEMORY_HOST);
+   R2   = hypre_CTAllocF(HYPRE_Real, nb*nb, cogmres_functions, HYPRE_MEMORY_HOST);
+   T    = hypre_CTAllocF(HYPRE_Real, nrows*(nb+1), cogmres_functions, HYPRE_MEMORY_HOST);
+   H    = hypre_CTAllocF(HYPRE_Real, nrows*nb, cogmres_functions, HYPRE_MEMORY_HOST);
+   work = hypre_CTAllocF(HYPRE_Real, nb*nrows + 2*nb*nb + nb + 2*nrows,
+                         cogmres_functions, HYPRE_MEMORY_HOST);
+
+   /* Newton basis: p[j+1+l] = (A M^{-1} - theta_l) v_l */
+   for (l = 0; l < nb; l++)
+   {
+      (*(cogmres_functions->ClearVector))(r);
+      precond(precond_data, A, p[j+l], r);
+      (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[j+1+l]);
+      (*(cogmres_functions->Axpy))(-theta[l], p[j+l], p[j+1+l]);
+   }
+
+   /* W = Q C + W1 R and W1 = Q C2 + W2 R2, so W = Q (C + C2 R) + W2 (R2 R) */
+   nf = hypre_COGMRESBlockOrthog(cogmres_functions, p, q, nb, unroll, ldc, C, R, work);
+   nf2 = 0;
+   if (nf > 0)
+   {
+      nf2 = hypre_COGMRESBlockOrthog(cogmres_functions, p, q, nf, unroll, ldc, C2, R2, work);
+   }
+   nb = nf2;
+   nrows = q+nb;
+
+   if (nb > 0)
+   {
+      /* V_{0:nb} = P T in the new orthonormal basis P = p[0..j+nb] */
+      T[j*(nb+1)] = 1.0;
+      for (l = 1; l <= nb; l++)
+      {
+         for (m = 0; m < q; m++)
+         {
+            T[m*(nb+1)+l] = C[m*ldc+l-1];
+            for (k = 0; k < l; k++)
+            {
+               T[m*(nb+1)+l] += C2[m*ldc+k]*R[k*ldc+l-1];
+            }
+         }
+         for (m = 0; m < l; m++)
+         {
+            T[(q+m)*(nb+1)+l] = 0.0;
+            for (k = m; k < l; k++)
+            {
+               T[(q+m)*(nb+1)+l] += R2[m*ldc+k]*R[k*ldc+l-1];
+            }
+         }
+      }
+
+      /* A M^{-1} V_{0:nb-1} = V_{0:nb} B with B bidiagonal (theta_l, 1), and
+         V_{0:nb-1} = p[0..j-1] T_top + p[j..j+nb-1] T_blk, so that
+         H_new = (T B - H_old T_top) T_blk^{-1} */
+      for (l = 0; l < nb; l++)
+      {
+         for (m = 0; m < nrows; m++)
+         {
+            H[m*nb+l] = theta[l]*T[m*(nb+1)+l] + T[m*(nb+1)+l+1];
+         }
+         for (k = 0; k < j; k++)
+         {
+            if (T[k*(nb+1)+l] != 0.0)
+            {
+               for (m = 0; m <= k+1; m++)
+               {
+                  H[m*nb+l] -= hu[k*ld+m]*T[k*(nb+1)+l];
+               }
+            }
+         }
+         for (k = 0; k < l; k++)
+         {
+            for (m = 0; m < nrows; m++)
+            {
+               H[m*nb+l] -= H[m*nb+k]*T[(j+k)*(nb+1)+l];
+            }
+         }
+         for (m = 0; m < nrows; m++)
+         {
+            H[m*nb+l] /= T[(j+l)*(nb+1)+l];
+         }
+
+         /* store column j+l, dropping the roundoff below the subdiagonal */
+         for (m = 0; m <= k_dim; m++)
+         {
+            hu[(j+l)*ld+m] = (m <= j+l+1) ? H[m*nb+l] : 0.0;
+            hh[(j+l)*ld+m] = hu[(j+l)*ld+m];
+         }
+      }
+   }
+
+   hypre_TFreeF(C, cogmres_functions);
+   hypre_TFreeF(R, cogmres_functions);
+   hypre_TFreeF(C2, cogmres_functions);
+   hypre_TFreeF(R2, cogmres_functions);
+   hypre_TFreeF(T, cogmres_functions);
+   hypre_TFreeF(H, cogmres_functions);
+   hypre_TFreeF(work, cogmres_functions);
+
+   return nb;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSolve
  *-------------------------------------------------------------------------*/
@@ -257,6 +754,7 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    HYPRE_Int     k_dim             = (cogmres_data -> k_dim);
    HYPRE_Int     unroll            = (cogmres_data -> unroll);
    HYPRE_Int     cgs               = (cogmres_data -> cgs);
+   HYPRE_Int     s_step            = (cogmres_data -> s_step);
    HYPRE_Int     min_iter          = (cogmres_data -> min_iter);
    HYPRE_Int     max_iter          = (cogmres_data -> max_iter);
    HYPRE_Int     rel_change        = (cogmres_data -> rel_change);
@@ -308,6 +806,14 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   /* s-step variant: Newton shifts, unrotated Hessenberg matrix */
+   HYPRE_Real *theta = NULL, *hu = NULL, *ritz = NULL, *rwork = NULL;
+   HYPRE_Int  *iwork = NULL;
+   HYPRE_Int   have_shifts = 0, blk_left = 0;
+   /* rows of uu (inner products of the basis vectors for cgs > 1) that are
+      up to date; the s-step blocks do not fill them */
+   HYPRE_Int   uu_valid = 0;
+
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    (cogmres_data -> converged) = 0;
@@ -336,6 +842,20 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    hh = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
    uu = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
 
+   s_step = hypre_min(s_step, k_dim);
+   if (s_step > 1 && cogmres_functions->MassInnerProdMult == NULL)
+   {
+      s_step = 1;
+   }
+   if (s_step > 1)
+   {
+      theta = hypre_CTAllocF(HYPRE_Real, s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+      hu    = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+      ritz  = hypre_CTAllocF(HYPRE_Real, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+      rwork = hypre_CTAllocF(HYPRE_Real, k_dim*(k_dim+2), cogmres_functions, HYPRE_MEMORY_HOST);
+      iwork = hypre_CTAllocF(HYPRE_Int, k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   }
+
    (*(cogmres_functions->CopyVector))(b,p[0]);
 
    /* compute initial residual */
@@ -463,6 +983,11 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
          if (rel_change)  hypre_TFreeF(rs_2,cogmres_functions);
          hypre_TFreeF(hh,cogmres_functions);
          hypre_TFreeF(uu,cogmres_functions);
+         hypre_TFreeF(theta,cogmres_functions);
+         hypre_TFreeF(hu,cogmres_functions);
+         hypre_TFreeF(ritz,cogmres_functions);
+         hypre_TFreeF(rwork,cogmres_functions);
+         hypre_TFreeF(iwork,cogmres_functions);
          HYPRE_ANNOTATE_FUNC_END;
 
          return hypre_error_flag;
@@ -498,6 +1023,8 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
       t = 1.0 / r_norm;
       (*(cogmres_functions->ScaleVector))(t,p[0]);
       i = 0;
+      blk_left = 0;
+      uu_valid = 0;
       /***RESTART CYCLE (right-preconditioning) ***/
       while (i < k_dim && iter < max_iter)
       {
@@ -505,46 +1032,74 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
          iter++;
          itmp = (i-1)*(k_dim+1);
 
-         (*(cogmres_functions->ClearVector))(r);
-
-         precond(precond_data, A, p[i-1], r);
-         (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
-         for (j=0; j<i; j++)
-            rv[j]  = 0;
+         if (have_shifts && blk_left == 0)
+         {
+            blk_left = hypre_COGMRESSStepBlock(cogmres_data, A, i-1,
+                                               hypre_min(s_step, hypre_min(k_dim-i+1, max_iter-iter+1)),
+                                               theta, hu, hh);
+         }
 
-         if (cgs > 1)
+         /* p[i] and column i-1 of hh already come from the current block */
+         if (blk_left > 0)
+         {
+            blk_left--;
+         }
+         else
          {
-            (*(cogmres_functions->MassDotpTwo))((void *) p[i], p[i-1], p, i, unroll, &hh[itmp], &uu[itmp]);
-            for (j=0; j<i-1; j++) uu[j*(k_dim+1)+i-1] = uu[itmp+j];
-            for (j=0; j<i; j++) rv[j] = hh[itmp+j];
-            for (k=0; k < i; k++)
+            (*(cogmres_functions->ClearVector))(r);
+
+            precond(precond_data, A, p[i-1], r);
+            (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[i]);
+            for (j=0; j<i; j++)
+               rv[j]  = 0;
+
+            if (cgs > 1)
             {
-               for (j=0; j < i; j++)
+               /* rows of uu for the vectors of earlier s-step blocks */
+               for (k = uu_valid; k < i-1; k++)
                {
-                  hh[itmp+j] -= (uu[k*(k_dim+1)+j]*rv[j]);
+                  (*(cogmres_functions->MassInnerProd))((void *) p[k], p, k+1, unroll, &uu[k*(k_dim+1)]);
+                  for (j=0; j<k; j++) uu[j*(k_dim+1)+k] = uu[k*(k_dim+1)+j];
                }
+               uu_valid = i;
+
+               (*(cogmres_functions->MassDotpTwo))((void *) p[i], p[i-1], p, i, unroll, &hh[itmp], &uu[itmp]);
+               for (j=0; j<i-1; j++) uu[j*(k_dim+1)+i-1] = uu[itmp+j];
+               for (j=0; j<i; j++) rv[j] = hh[itmp+j];
+               for (k=0; k < i; k++)
+               {
+                  for (j=0; j < i; j++)
+                  {
+                     hh[itmp+j] -= (uu[k*(k_dim+1)+j]*rv[j]);
+                  }
+               }
+               for (j=0; j<i; j++)
+                  hh[itmp+j]  = -rv[j]-hh[itmp+j];
             }
-            for (j=0; j<i; j++)
-               hh[itmp+j]  = -rv[j]-hh[itmp+j];
-         }
-         else
-         {
-            (*(cogmres_functions->MassInnerProd))((void *) p[i], p, i, unroll, &hh[itmp]);
+            else
+            {
+               (*(cogmres_functions->MassInnerProd))((void *) p[i], p, i, unroll, &hh[itmp]);
+               for (j=0; j<i; j++)
+                  hh[itmp+j]  = -hh[itmp+j];
+            }
+
+            (*(cogmres_functions->MassAxpy))(&hh[itmp],p,p[i], i, unroll);
             for (j=0; j<i; j++)
                hh[itmp+j]  = -hh[itmp+j];
-         }
+            t = sqrt( (*(cogmres_functions->InnerProd))(p[i],p[i]) );
+            hh[itmp+i] = t;
 
-         (*(cogmres_functions->MassAxpy))(&hh[itmp],p,p[i], i, unroll);
-         for (j=0; j<i; j++)
-            hh[itmp+j]  = -hh[itmp+j];
-         t = sqrt( (*(cogmres_functions->InnerProd))(p[i],p[i]) );
-         hh[itmp+i] = t;
-
-         if (hh[itmp+i] != 0.0)
-         {
-            t = 1.0/t;
-            (*(cogmres_functions->ScaleVector))(t,p[i]);
+            if (hh[itmp+i] != 0.0)
+            {
+               t = 1.0/t;
+               (*(cogmres_functions->ScaleVector))(t,p[i]);
+            }
+            if (s_step > 1)
+            {
+               for (j=0; j<=i; j++) hu[itmp+j] = hh[itmp+j];
+            }
          }
+
          for (j = 1; j < i; j++)
          {
             t = hh[itmp+j-1];
@@ -696,6 +1251,15 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
          }
       } /*** end of restart cycle ***/
 
+      /* Newton shifts for the s-step cycles from the Ritz values of the
+         first (standard) cycle */
+      if (s_step > 1 && !have_shifts && i > 0)
+      {
+         hypre_COGMRESRitzValues(i, hu, k_dim+1, ritz, rwork);
+         hypre_COGMRESLejaShifts(i, ritz, s_step, theta, iwork);
+         have_shifts = 1;
+      }
+
       /* now compute solution, first solve upper triangular system */
       if (break_value) break;
 
@@ -852,6 +1416,11 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    }*/
    hypre_TFreeF(hh,cogmres_functions);
    hypre_TFreeF(uu,cogmres_functions);
+   hypre_TFreeF(theta,cogmres_functions);
+   hypre_TFreeF(hu,cogmres_functions);
+   hypre_TFreeF(ritz,cogmres_functions);
+   hypre_TFreeF(rwork,cogmres_functions);
+   hypre_TFreeF(iwork,cogmres_functions);
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -924,6 +1493,28 @@ hypre_COGMRESGetCGS( void   *cogmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStep, hypre_COGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStep( void   *cogmres_vdata,
+        HYPRE_Int   s_step )
+{
+   hypre_COGMRESData *cogmres_data =(hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> s_step) = s_step;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStep( void   *cogmres_vdata,
+        HYPRE_Int * s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_step = (cogmres_data -> s_step);
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSetTol, hypre_COGMRESGetTol
  *--------------------------------------------------------------------------*/
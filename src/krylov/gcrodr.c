@@ -0,0 +1,1114 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * GCRODR gcro with deflated restarting (Krylov subspace recycling)
+ *
+ * Parks, de Sturler, Mackey, Johnson and Maiti, "Recycling Krylov subspaces
+ * for sequences of linear systems", SIAM J. Sci. Comput. 28 (2006).
+ *
+ * A space U of recycle_dim vectors is kept with C = A U orthonormal.  Each
+ * cycle runs k_dim - recycle_dim Arnoldi steps on (I - C C^T) A M and
+ * minimizes the residual over span{U, M V}.  At the end of a cycle U is
+ * replaced by the directions of the cycle's space that A M amplifies
+ * least, so later cycles, and later solves, no longer have to rediscover
+ * them.  The space survives between calls to Solve; after Setup (i.e., a
+ * new or modified operator) C is recomputed and re-orthonormalized.
+ *
+ * The preconditioned directions M v are stored, as in flexible GMRES, so the
+ * recycled vectors need no extra preconditioner applications.  The
+ * deflation directions are taken as the right singular vectors of the small
+ * cycle matrix with the smallest singular values, rather than harmonic Ritz
+ * vectors, which would need a nonsymmetric dense eigensolver.
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+#include "_hypre_lapack.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRFunctionsCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_GCRODRFunctions *
+hypre_GCRODRFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   )
+{
+   hypre_GCRODRFunctions * gcrodr_functions;
+   gcrodr_functions = (hypre_GCRODRFunctions *)
+      CAlloc( 1, sizeof(hypre_GCRODRFunctions), HYPRE_MEMORY_HOST );
+
+   gcrodr_functions->CAlloc = CAlloc;
+   gcrodr_functions->Free = Free;
+   gcrodr_functions->CommInfo = CommInfo;
+   gcrodr_functions->CreateVector = CreateVector;
+   gcrodr_functions->CreateVectorArray = CreateVectorArray;
+   gcrodr_functions->DestroyVector = DestroyVector;
+   gcrodr_functions->MatvecCreate = MatvecCreate;
+   gcrodr_functions->Matvec = Matvec;
+   gcrodr_functions->MatvecDestroy = MatvecDestroy;
+   gcrodr_functions->InnerProd = InnerProd;
+   gcrodr_functions->CopyVector = CopyVector;
+   gcrodr_functions->ClearVector = ClearVector;
+   gcrodr_functions->ScaleVector = ScaleVector;
+   gcrodr_functions->Axpy = Axpy;
+/* default preconditioner must be set here but can be changed later... */
+   gcrodr_functions->precond_setup = PrecondSetup;
+   gcrodr_functions->precond       = Precond;
+
+   return gcrodr_functions;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_GCRODRCreate( hypre_GCRODRFunctions *gcrodr_functions )
+{
+   hypre_GCRODRData *gcrodr_data;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   gcrodr_data = hypre_CTAllocF(hypre_GCRODRData, 1, gcrodr_functions, HYPRE_MEMORY_HOST);
+   gcrodr_data->functions = gcrodr_functions;
+
+   /* set defaults */
+   (gcrodr_data -> k_dim)          = 30;
+   (gcrodr_data -> tol)            = 1.0e-06;
+   (gcrodr_data -> a_tol)          = 0.0; /* abs. residual tol */
+   (gcrodr_data -> min_iter)       = 0;
+   (gcrodr_data -> max_iter)       = 1000;
+   (gcrodr_data -> converged)      = 0;
+   (gcrodr_data -> precond_data)   = NULL;
+   (gcrodr_data -> print_level)    = 0;
+   (gcrodr_data -> logging)        = 0;
+   (gcrodr_data -> r)              = NULL;
+   (gcrodr_data -> v)              = NULL;
+   (gcrodr_data -> z)              = NULL;
+   (gcrodr_data -> matvec_data)    = NULL;
+   (gcrodr_data -> norms)          = NULL;
+
+   /* gcrodr specific */
+   (gcrodr_data -> recycle_dim)    = 10;
+   (gcrodr_data -> num_recycled)   = 0;
+   (gcrodr_data -> reproject)      = 0;
+   (gcrodr_data -> u)              = NULL;
+   (gcrodr_data -> c)              = NULL;
+   (gcrodr_data -> u_new)          = NULL;
+   (gcrodr_data -> c_new)          = NULL;
+   (gcrodr_data -> u_scale)        = NULL;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return (void *) gcrodr_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRDestroyVectorArray
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_GCRODRDestroyVectorArray( hypre_GCRODRFunctions *gcrodr_functions,
+                                void                 **vecs,
+                                HYPRE_Int              n )
+{
+   HYPRE_Int i;
+
+   if (vecs != NULL)
+   {
+      for (i = 0; i < n; i++)
+      {
+         if (vecs[i] != NULL)
+         {
+            (*(gcrodr_functions->DestroyVector))(vecs[i]);
+         }
+      }
+      hypre_TFreeF(vecs, gcrodr_functions);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRDestroy( void *gcrodr_vdata )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+   if (gcrodr_data)
+   {
+      hypre_GCRODRFunctions *gcrodr_functions = gcrodr_data->functions;
+      HYPRE_Int              k_dim            = (gcrodr_data -> k_dim);
+      HYPRE_Int              recycle_dim      = (gcrodr_data -> recycle_dim);
+
+      if ( (gcrodr_data -> norms) != NULL )
+         hypre_TFreeF( gcrodr_data -> norms, gcrodr_functions );
+
+      if ( (gcrodr_data -> matvec_data) != NULL )
+         (*(gcrodr_functions->MatvecDestroy))(gcrodr_data -> matvec_data);
+
+      if ( (gcrodr_data -> r) != NULL )
+         (*(gcrodr_functions->DestroyVector))(gcrodr_data -> r);
+
+      hypre_GCRODRDestroyVectorArray(gcrodr_functions, (gcrodr_data -> v), k_dim+1);
+      hypre_GCRODRDestroyVectorArray(gcrodr_functions, (gcrodr_data -> z), k_dim);
+      hypre_GCRODRDestroyVectorArray(gcrodr_functions, (gcrodr_data -> u), recycle_dim);
+      hypre_GCRODRDestroyVectorArray(gcrodr_functions, (gcrodr_data -> c), recycle_dim);
+      hypre_GCRODRDestroyVectorArray(gcrodr_functions, (gcrodr_data -> u_new), recycle_dim);
+      hypre_GCRODRDestroyVectorArray(gcrodr_functions, (gcrodr_data -> c_new), recycle_dim);
+      hypre_TFreeF( gcrodr_data -> u_scale, gcrodr_functions );
+
+      hypre_TFreeF( gcrodr_data, gcrodr_functions );
+      hypre_TFreeF( gcrodr_functions, gcrodr_functions );
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_GCRODRGetResidual( void *gcrodr_vdata, void **residual )
+{
+   hypre_GCRODRData  *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+   *residual = gcrodr_data->r;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetup( void *gcrodr_vdata,
+                   void *A,
+                   void *b,
+                   void *x         )
+{
+   hypre_GCRODRData *gcrodr_data     = (hypre_GCRODRData *)gcrodr_vdata;
+   hypre_GCRODRFunctions *gcrodr_functions = gcrodr_data->functions;
+
+   HYPRE_Int            k_dim            = (gcrodr_data -> k_dim);
+   HYPRE_Int            recycle_dim      = (gcrodr_data -> recycle_dim);
+   HYPRE_Int            max_iter         = (gcrodr_data -> max_iter);
+   HYPRE_Int          (*precond_setup)(void*,void*,void*,void*) = (gcrodr_functions->precond_setup);
+   void          *precond_data     = (gcrodr_data -> precond_data);
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (gcrodr_data -> A) = A;
+
+   /* each cycle needs at least one Arnoldi step; clamp the stored value so
+      that the solve and the recycled space update agree on it */
+   recycle_dim = hypre_max(hypre_min(recycle_dim, k_dim-1), 0);
+   (gcrodr_data -> recycle_dim) = recycle_dim;
+
+   /*--------------------------------------------------
+    * The arguments for NewVector are important to
+    * maintain consistency between the setup and
+    * compute phases of matvec and the preconditioner.
+    *--------------------------------------------------*/
+
+   if ((gcrodr_data -> v) == NULL)
+      (gcrodr_data -> v) = (void**)(*(gcrodr_functions->CreateVectorArray))(k_dim+1,b);
+   if ((gcrodr_data -> z) == NULL)
+      (gcrodr_data -> z) = (void**)(*(gcrodr_functions->CreateVectorArray))(k_dim,x);
+   if ((gcrodr_data -> r) == NULL)
+      (gcrodr_data -> r) = (*(gcrodr_functions->CreateVector))(b);
+
+   if (recycle_dim > 0)
+   {
+      if ((gcrodr_data -> u) == NULL)
+         (gcrodr_data -> u) = (void**)(*(gcrodr_functions->CreateVectorArray))(recycle_dim,x);
+      if ((gcrodr_data -> c) == NULL)
+         (gcrodr_data -> c) = (void**)(*(gcrodr_functions->CreateVectorArray))(recycle_dim,b);
+      if ((gcrodr_data -> u_new) == NULL)
+         (gcrodr_data -> u_new) = (void**)(*(gcrodr_functions->CreateVectorArray))(recycle_dim,x);
+      if ((gcrodr_data -> c_new) == NULL)
+         (gcrodr_data -> c_new) = (void**)(*(gcrodr_functions->CreateVectorArray))(recycle_dim,b);
+      if ((gcrodr_data -> u_scale) == NULL)
+         (gcrodr_data -> u_scale) = hypre_CTAllocF(HYPRE_Real, recycle_dim, gcrodr_functions, HYPRE_MEMORY_HOST);
+   }
+
+   /* the recycled space has to be projected onto the new operator */
+   (gcrodr_data -> reproject) = 1;
+
+   if ((gcrodr_data -> matvec_data) == NULL)
+      (gcrodr_data -> matvec_data) = (*(gcrodr_functions->MatvecCreate))(A, x);
+
+   precond_setup(precond_data, A, b, x);
+
+   /*-----------------------------------------------------
+    * Allocate space for log info
+    *-----------------------------------------------------*/
+
+   if ( (gcrodr_data->logging)>0 || (gcrodr_data->print_level) > 0 )
+   {
+      if ((gcrodr_data -> norms) == NULL)
+         (gcrodr_data -> norms) = hypre_CTAllocF(HYPRE_Real, max_iter + 1,gcrodr_functions, HYPRE_MEMORY_HOST);
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRNormalizeRecycled
+ *
+ * Scale u_i to unit length and fold the factor into u_scale_i, keeping
+ * A u_i = u_scale_i c_i.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_GCRODRNormalizeRecycled( hypre_GCRODRData *gcrodr_data )
+{
+   hypre_GCRODRFunctions *gcrodr_functions = gcrodr_data->functions;
+   void                 **u                = (gcrodr_data -> u);
+   HYPRE_Real            *u_scale          = (gcrodr_data -> u_scale);
+   HYPRE_Int              i;
+   HYPRE_Real             nrm;
+
+   for (i = 0; i < (gcrodr_data -> num_recycled); i++)
+   {
+      nrm = sqrt((*(gcrodr_functions->InnerProd))(u[i], u[i]));
+      (*(gcrodr_functions->ScaleVector))(1.0/nrm, u[i]);
+      u_scale[i] /= nrm;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRReproject
+ *
+ * Recompute C = A U for a new operator and orthonormalize it with modified
+ * Gram-Schmidt, applying the same transformation to U.  Vectors that have
+ * become dependent are dropped.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_GCRODRReproject( hypre_GCRODRData *gcrodr_data,
+                       void             *A )
+{
+   hypre_GCRODRFunctions *gcrodr_functions = gcrodr_data->functions;
+   void                  *matvec_data      = (gcrodr_data -> matvec_data);
+   void                 **u                = (gcrodr_data -> u);
+   void                 **c                = (gcrodr_data -> c);
+   HYPRE_Real            *u_scale          = (gcrodr_data -> u_scale);
+   HYPRE_Int              kk               = (gcrodr_data -> num_recycled);
+   HYPRE_Int              i, j;
+   HYPRE_Real             h, nrm, nrm_0;
+
+   for (i = 0; i < kk; i++)
+   {
+      (*(gcrodr_functions->Matvec))(matvec_data, 1.0, A, u[i], 0.0, c[i]);
+   }
+
+   i = 0;
+   while (i < kk)
+   {
+      nrm_0 = sqrt((*(gcrodr_functions->InnerProd))(c[i], c[i]));
+      for (j = 0; j < i; j++)
+      {
+         h = (*(gcrodr_functions->InnerProd))(c[j], c[i]);
+         (*(gcrodr_functions->Axpy))(-h, c[j], c[i]);
+         (*(gcrodr_functions->Axpy))(-h, u[j], u[i]);
+      }
+      nrm = sqrt((*(gcrodr_functions->InnerProd))(c[i], c[i]));
+      if (nrm <= 1.0e-12 * nrm_0 || nrm == 0.0)
+      {
+         /* replace by the last vector and try again */
+         kk--;
+         if (i < kk)
+         {
+            (*(gcrodr_functions->CopyVector))(u[kk], u[i]);
+            (*(gcrodr_functions->CopyVector))(c[kk], c[i]);
+         }
+         continue;
+      }
+      (*(gcrodr_functions->ScaleVector))(1.0/nrm, c[i]);
+      (*(gcrodr_functions->ScaleVector))(1.0/nrm, u[i]);
+      u_scale[i] = 1.0;
+      i++;
+   }
+
+   (gcrodr_data -> num_recycled) = kk;
+   (gcrodr_data -> reproject)    = 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRUpdateRecycled
+ *
+ * With W = [C V] and Y = [U Z] the bases of the last cycle, A Y = W G.
+ * Replace U and C by Y P S^{-1} and W Q, where G P = Q S holds the
+ * smallest singular triplets of G, so that again A U = C with C
+ * orthonormal.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_GCRODRUpdateRecycled( hypre_GCRODRData *gcrodr_data,
+                            HYPRE_Int         num_cols,
+                            HYPRE_Real       *G,
+                            HYPRE_Int         ldg )
+{
+   hypre_GCRODRFunctions *gcrodr_functions = gcrodr_data->functions;
+   HYPRE_Int              recycle_dim      = (gcrodr_data -> recycle_dim);
+   HYPRE_Int              kk               = (gcrodr_data -> num_recycled);
+   void                 **u                = (gcrodr_data -> u);
+   void                 **c                = (gcrodr_data -> c);
+   void                 **u_new            = (gcrodr_data -> u_new);
+   void                 **c_new            = (gcrodr_data -> c_new);
+   void                 **v                = (gcrodr_data -> v);
+   void                 **z                = (gcrodr_data -> z);
+
+   HYPRE_Int   num_rows = num_cols + 1;
+   HYPRE_Int   lwork    = 8*num_rows;
+   HYPRE_Int   info, i, l, idx, num_new;
+   HYPRE_Real *a, *s, *su, *svt, *work;
+   char        jobu = 'S', jobvt = 'S';
+
+   a    = hypre_CTAllocF(HYPRE_Real, num_rows*num_cols, gcrodr_functions, HYPRE_MEMORY_HOST);
+   s    = hypre_CTAllocF(HYPRE_Real, num_cols, gcrodr_functions, HYPRE_MEMORY_HOST);
+   su   = hypre_CTAllocF(HYPRE_Real, num_rows*num_cols, gcrodr_functions, HYPRE_MEMORY_HOST);
+   svt  = hypre_CTAllocF(HYPRE_Real, num_cols*num_cols, gcrodr_functions, HYPRE_MEMORY_HOST);
+   work = hypre_CTAllocF(HYPRE_Real, lwork, gcrodr_functions, HYPRE_MEMORY_HOST);
+
+   for (l = 0; l < num_cols; l++)
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         a[i + l*num_rows] = G[i + l*ldg];
+      }
+   }
+   hypre_dgesvd(&jobu, &jobvt, &num_rows, &num_cols, a, &num_rows, s,
+                su, &num_rows, svt, &num_cols, work, &lwork, &info);
+
+   if (info == 0)
+   {
+      num_new = 0;
+      for (l = 0; l < hypre_min(recycle_dim, num_cols); l++)
+      {
+         /* singular values come in decreasing order */
+         idx = num_cols - 1 - l;
+         if (s[idx] <= 1.0e-14 * s[0])
+         {
+            continue;
+         }
+
+         (*(gcrodr_functions->ClearVector))(u_new[num_new]);
+         (*(gcrodr_functions->ClearVector))(c_new[num_new]);
+         for (i = 0; i < num_cols; i++)
+         {
+            (*(gcrodr_functions->Axpy))(svt[idx + i*num_cols] / s[idx],
+                                        (i < kk) ? u[i] : z[i-kk], u_new[num_new]);
+         }
+         for (i = 0; i < num_rows; i++)
+         {
+            (*(gcrodr_functions->Axpy))(su[i + idx*num_rows],
+                                        (i < kk) ? c[i] : v[i-kk], c_new[num_new]);
+         }
+         (gcrodr_data -> u_scale)[num_new] = 1.0;
+         num_new++;
+      }
+
+      (gcrodr_data -> u)            = u_new;
+      (gcrodr_data -> c)            = c_new;
+      (gcrodr_data -> u_new)        = u;
+      (gcrodr_data -> c_new)        = c;
+      (gcrodr_data -> num_recycled) = num_new;
+      hypre_GCRODRNormalizeRecycled(gcrodr_data);
+   }
+
+   hypre_TFreeF(a, gcrodr_functions);
+   hypre_TFreeF(s, gcrodr_functions);
+   hypre_TFreeF(su, gcrodr_functions);
+   hypre_TFreeF(svt, gcrodr_functions);
+   hypre_TFreeF(work, gcrodr_functions);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRProject
+ *
+ * Take the recycled space out of the residual, x += U C^T r and
+ * r -= C C^T r, so that the next Arnoldi cycle starts orthogonal to C.
+ * Returns the new residual norm.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_GCRODRProject( hypre_GCRODRData *gcrodr_data,
+                     void             *x )
+{
+   hypre_GCRODRFunctions *gcrodr_functions = gcrodr_data->functions;
+   void                  *r                = (gcrodr_data -> r);
+   void                 **u                = (gcrodr_data -> u);
+   void                 **c                = (gcrodr_data -> c);
+   HYPRE_Real            *u_scale          = (gcrodr_data -> u_scale);
+   HYPRE_Int              i;
+   HYPRE_Real             h;
+
+   for (i = 0; i < (gcrodr_data -> num_recycled); i++)
+   {
+      h = (*(gcrodr_functions->InnerProd))(c[i], r);
+      (*(gcrodr_functions->Axpy))(h / u_scale[i], u[i], x);
+      (*(gcrodr_functions->Axpy))(-h, c[i], r);
+   }
+
+   return sqrt((*(gcrodr_functions->InnerProd))(r, r));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSolve
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSolve(void  *gcrodr_vdata,
+                  void  *A,
+                  void  *b,
+                  void  *x)
+{
+   hypre_GCRODRData  *gcrodr_data   = (hypre_GCRODRData *)gcrodr_vdata;
+   hypre_GCRODRFunctions *gcrodr_functions = gcrodr_data->functions;
+   HYPRE_Int         k_dim        = (gcrodr_data -> k_dim);
+   HYPRE_Int         min_iter     = (gcrodr_data -> min_iter);
+   HYPRE_Int         max_iter     = (gcrodr_data -> max_iter);
+   HYPRE_Real        r_tol        = (gcrodr_data -> tol);
+   HYPRE_Real        a_tol        = (gcrodr_data -> a_tol);
+   void             *matvec_data  = (gcrodr_data -> matvec_data);
+
+   void             *r            = (gcrodr_data -> r);
+   void            **v            = (gcrodr_data -> v);
+   void            **z            = (gcrodr_data -> z);
+   void            **u;
+   void            **c;
+   HYPRE_Real       *u_scale      = (gcrodr_data -> u_scale);
+   HYPRE_Int         recycle_dim  = (gcrodr_data -> recycle_dim);
+   HYPRE_Int         kk;
+
+   HYPRE_Int        (*precond)(void*,void*,void*,void*)   = (gcrodr_functions -> precond);
+   HYPRE_Int        *precond_data = (HYPRE_Int*)(gcrodr_data -> precond_data);
+
+   HYPRE_Int         print_level  = (gcrodr_data -> print_level);
+   HYPRE_Int         logging      = (gcrodr_data -> logging);
+   HYPRE_Real       *norms        = (gcrodr_data -> norms);
+
+   HYPRE_Int         i, j, l, col, num_steps, ldg;
+   HYPRE_Int         iter;
+   HYPRE_Int         my_id, num_procs;
+   HYPRE_Real       *G, *H, *rs, *cs, *sn, *y;
+   HYPRE_Real        epsilon, gamma, t, h, r_norm, b_norm, den_norm, r_norm_0;
+
+   HYPRE_Real        epsmac = 1.e-16;
+   HYPRE_Real        ieee_check = 0.;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   (gcrodr_data -> converged) = 0;
+
+   (*(gcrodr_functions->CommInfo))(A,&my_id,&num_procs);
+
+   if ((gcrodr_data -> u) == NULL)
+   {
+      recycle_dim = 0;
+   }
+
+   /* G is the (k_dim+1) x k_dim cycle matrix, column-major; H is the copy
+      reduced to triangular form by Givens rotations */
+   ldg = k_dim+1;
+   G  = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, gcrodr_functions, HYPRE_MEMORY_HOST);
+   H  = hypre_CTAllocF(HYPRE_Real, (k_dim+1)*k_dim, gcrodr_functions, HYPRE_MEMORY_HOST);
+   rs = hypre_CTAllocF(HYPRE_Real, k_dim+1, gcrodr_functions, HYPRE_MEMORY_HOST);
+   cs = hypre_CTAllocF(HYPRE_Real, k_dim, gcrodr_functions, HYPRE_MEMORY_HOST);
+   sn = hypre_CTAllocF(HYPRE_Real, k_dim, gcrodr_functions, HYPRE_MEMORY_HOST);
+   y  = hypre_CTAllocF(HYPRE_Real, k_dim, gcrodr_functions, HYPRE_MEMORY_HOST);
+
+   /* compute initial residual */
+   (*(gcrodr_functions->CopyVector))(b, r);
+   (*(gcrodr_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+
+   b_norm = sqrt((*(gcrodr_functions->InnerProd))(b,b));
+   r_norm = sqrt((*(gcrodr_functions->InnerProd))(r,r));
+
+   /* Since it is does not diminish performance, attempt to return an error flag
+      and notify users when they supply bad input. */
+   if (r_norm != 0.) ieee_check = r_norm/r_norm; /* INF -> NaN conversion */
+   if (b_norm != 0.) ieee_check += b_norm/b_norm;
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+        hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+        hypre_printf("ERROR -- hypre_GCRODRSolve: INFs and/or NaNs detected in input.\n");
+        hypre_printf("User probably placed non-numerics in supplied A, b or x_0.\n");
+        hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+        hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      hypre_TFreeF(G, gcrodr_functions);
+      hypre_TFreeF(H, gcrodr_functions);
+      hypre_TFreeF(rs, gcrodr_functions);
+      hypre_TFreeF(cs, gcrodr_functions);
+      hypre_TFreeF(sn, gcrodr_functions);
+      hypre_TFreeF(y, gcrodr_functions);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
+   r_norm_0 = r_norm;
+   den_norm = (b_norm > 0.0) ? b_norm : r_norm_0;
+   epsilon  = hypre_max(a_tol, r_tol*den_norm);
+
+   /* bring the recycled space in: x += U C^T r, r -= C C^T r */
+   if (recycle_dim > 0 && (gcrodr_data -> num_recycled) > 0)
+   {
+      if ((gcrodr_data -> reproject))
+      {
+         hypre_GCRODRReproject(gcrodr_data, A);
+         hypre_GCRODRNormalizeRecycled(gcrodr_data);
+      }
+      r_norm = hypre_GCRODRProject(gcrodr_data, x);
+   }
+   (gcrodr_data -> reproject) = 0;
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      hypre_printf("L2 norm of b: %e\n", b_norm);
+      hypre_printf("Initial L2 norm of residual: %e\n", r_norm_0);
+      hypre_printf("Recycled vectors: %d\n", (gcrodr_data -> num_recycled));
+      hypre_printf("=============================================\n\n");
+      hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+      hypre_printf("-----    ------------    ---------- ------------\n");
+   }
+   if (logging > 0 || print_level > 0)
+   {
+      norms[0] = r_norm;
+   }
+
+   iter = 0;
+   while (iter < max_iter)
+   {
+      if (r_norm <= epsilon && iter >= min_iter)
+      {
+         (gcrodr_data -> converged) = 1;
+         break;
+      }
+      if (r_norm == 0.0)
+      {
+         break;
+      }
+
+      kk        = (recycle_dim > 0) ? (gcrodr_data -> num_recycled) : 0;
+      u         = (gcrodr_data -> u);
+      c         = (gcrodr_data -> c);
+      num_steps = k_dim - kk;
+
+      for (i = 0; i < (k_dim+1)*k_dim; i++)
+      {
+         G[i] = 0.0;
+         H[i] = 0.0;
+      }
+      for (i = 0; i < kk; i++)
+      {
+         G[i + i*ldg] = u_scale[i];
+         H[i + i*ldg] = u_scale[i];
+         rs[i] = 0.0;
+      }
+      rs[kk] = r_norm;
+
+      (*(gcrodr_functions->CopyVector))(r, v[0]);
+      (*(gcrodr_functions->ScaleVector))(1.0/r_norm, v[0]);
+
+      j = 0;
+      while (j < num_steps && iter < max_iter)
+      {
+         col = kk + j;
+         iter++;
+
+         (*(gcrodr_functions->ClearVector))(z[j]);
+         precond(precond_data, A, v[j], z[j]);
+         (*(gcrodr_functions->Matvec))(matvec_data, 1.0, A, z[j], 0.0, v[j+1]);
+
+         /* orthogonalize against C, then against V */
+         for (i = 0; i < kk; i++)
+         {
+            h = (*(gcrodr_functions->InnerProd))(c[i], v[j+1]);
+            (*(gcrodr_functions->Axpy))(-h, c[i], v[j+1]);
+            G[i + col*ldg] = h;
+         }
+         for (i = 0; i <= j; i++)
+         {
+            h = (*(gcrodr_functions->InnerProd))(v[i], v[j+1]);
+            (*(gcrodr_functions->Axpy))(-h, v[i], v[j+1]);
+            G[kk+i + col*ldg] = h;
+         }
+         h = sqrt((*(gcrodr_functions->InnerProd))(v[j+1], v[j+1]));
+         G[col+1 + col*ldg] = h;
+         if (h != 0.0)
+         {
+            (*(gcrodr_functions->ScaleVector))(1.0/h, v[j+1]);
+         }
+
+         /* apply the previous rotations (they only touch rows >= kk) and
+            eliminate the new subdiagonal entry */
+         for (i = 0; i <= col+1; i++)
+         {
+            H[i + col*ldg] = G[i + col*ldg];
+         }
+         for (i = kk; i < col; i++)
+         {
+            t = H[i + col*ldg];
+            H[i   + col*ldg] =  cs[i]*t + sn[i]*H[i+1 + col*ldg];
+            H[i+1 + col*ldg] = -sn[i]*t + cs[i]*H[i+1 + col*ldg];
+         }
+         t = H[col + col*ldg];
+         gamma = sqrt(t*t + h*h);
+         if (gamma == 0.0) gamma = epsmac;
+         cs[col] = t/gamma;
+         sn[col] = h/gamma;
+         rs[col+1] = -sn[col]*rs[col];
+         rs[col]   =  cs[col]*rs[col];
+         H[col + col*ldg]   = gamma;
+         H[col+1 + col*ldg] = 0.0;
+
+         r_norm = fabs(rs[col+1]);
+         if (logging > 0 || print_level > 0)
+         {
+            norms[iter] = r_norm;
+            if ( print_level>1 && my_id == 0 )
+            {
+               hypre_printf("% 5d    %e    %f   %e\n", iter, norms[iter],
+                            norms[iter]/norms[iter-1], norms[iter]/den_norm);
+            }
+         }
+         j++;
+
+         if (r_norm <= epsilon && iter >= min_iter)
+         {
+            break;
+         }
+      }
+
+      /* y = H^{-1} rs, x += [U Z] y */
+      col = kk + j;
+      for (i = col-1; i >= 0; i--)
+      {
+         t = rs[i];
+         for (l = i+1; l < col; l++)
+         {
+            t -= H[i + l*ldg] * y[l];
+         }
+         y[i] = t / H[i + i*ldg];
+      }
+      for (i = 0; i < kk; i++)
+      {
+         (*(gcrodr_functions->Axpy))(y[i], u[i], x);
+      }
+      for (i = 0; i < j; i++)
+      {
+         (*(gcrodr_functions->Axpy))(y[kk+i], z[i], x);
+      }
+
+      /* true residual */
+      (*(gcrodr_functions->CopyVector))(b, r);
+      (*(gcrodr_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+      r_norm = sqrt((*(gcrodr_functions->InnerProd))(r,r));
+
+      if (recycle_dim > 0 && j > 0)
+      {
+         hypre_GCRODRUpdateRecycled(gcrodr_data, col, G, ldg);
+         if (!(r_norm <= epsilon && iter >= min_iter))
+         {
+            r_norm = hypre_GCRODRProject(gcrodr_data, x);
+         }
+      }
+   }
+
+   if (r_norm <= epsilon && iter >= min_iter)
+   {
+      (gcrodr_data -> converged) = 1;
+   }
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+      hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+   }
+
+   (gcrodr_data -> num_iterations) = iter;
+   (gcrodr_data -> rel_residual_norm) = (den_norm > 0.0) ? r_norm/den_norm : r_norm;
+
+   if (!(gcrodr_data -> converged) && r_norm > 0.0)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_TFreeF(G, gcrodr_functions);
+   hypre_TFreeF(H, gcrodr_functions);
+   hypre_TFreeF(rs, gcrodr_functions);
+   hypre_TFreeF(cs, gcrodr_functions);
+   hypre_TFreeF(sn, gcrodr_functions);
+   hypre_TFreeF(y, gcrodr_functions);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetKDim, hypre_GCRODRGetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetKDim( void   *gcrodr_vdata,
+                     HYPRE_Int   k_dim )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   if ((gcrodr_data -> v) != NULL)
+   {
+      /* the work space is sized at setup */
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "GCRODR: set k_dim before setup\n");
+      return hypre_error_flag;
+   }
+   (gcrodr_data -> k_dim) = k_dim;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GCRODRGetKDim( void   *gcrodr_vdata,
+                     HYPRE_Int * k_dim )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *k_dim = (gcrodr_data -> k_dim);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetRecycleDim, hypre_GCRODRGetRecycleDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetRecycleDim( void   *gcrodr_vdata,
+                           HYPRE_Int   recycle_dim )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   if ((gcrodr_data -> v) != NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "GCRODR: set recycle_dim before setup\n");
+      return hypre_error_flag;
+   }
+   if (recycle_dim < 0) recycle_dim = 0;
+   (gcrodr_data -> recycle_dim) = recycle_dim;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GCRODRGetRecycleDim( void   *gcrodr_vdata,
+                           HYPRE_Int * recycle_dim )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *recycle_dim = (gcrodr_data -> recycle_dim);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRGetNumRecycled
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRGetNumRecycled( void   *gcrodr_vdata,
+                            HYPRE_Int * num_recycled )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *num_recycled = (gcrodr_data -> num_recycled);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRClearRecycled
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRClearRecycled( void   *gcrodr_vdata )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   (gcrodr_data -> num_recycled) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetTol, hypre_GCRODRGetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetTol( void   *gcrodr_vdata,
+                    HYPRE_Real  tol       )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   (gcrodr_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GCRODRGetTol( void   *gcrodr_vdata,
+                    HYPRE_Real  * tol      )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *tol = (gcrodr_data -> tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetAbsoluteTol, hypre_GCRODRGetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetAbsoluteTol( void   *gcrodr_vdata,
+                            HYPRE_Real  a_tol       )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   (gcrodr_data -> a_tol) = a_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GCRODRGetAbsoluteTol( void   *gcrodr_vdata,
+                            HYPRE_Real  * a_tol      )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *a_tol = (gcrodr_data -> a_tol);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetMinIter, hypre_GCRODRGetMinIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetMinIter( void *gcrodr_vdata,
+                        HYPRE_Int   min_iter  )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   (gcrodr_data -> min_iter) = min_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GCRODRGetMinIter( void *gcrodr_vdata,
+                        HYPRE_Int * min_iter  )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *min_iter = (gcrodr_data -> min_iter);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetMaxIter, hypre_GCRODRGetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetMaxIter( void *gcrodr_vdata,
+                        HYPRE_Int   max_iter  )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   (gcrodr_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GCRODRGetMaxIter( void *gcrodr_vdata,
+                        HYPRE_Int * max_iter  )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *max_iter = (gcrodr_data -> max_iter);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetPrecond( void  *gcrodr_vdata,
+                        HYPRE_Int  (*precond)(void*,void*,void*,void*),
+                        HYPRE_Int  (*precond_setup)(void*,void*,void*,void*),
+                        void  *precond_data )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+   hypre_GCRODRFunctions *gcrodr_functions = gcrodr_data->functions;
+
+   (gcrodr_functions -> precond)        = precond;
+   (gcrodr_functions -> precond_setup)  = precond_setup;
+   (gcrodr_data -> precond_data)   = precond_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRGetPrecond( void         *gcrodr_vdata,
+                        HYPRE_Solver *precond_data_ptr )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *precond_data_ptr = (HYPRE_Solver)(gcrodr_data -> precond_data);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetPrintLevel, hypre_GCRODRGetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetPrintLevel( void *gcrodr_vdata,
+                           HYPRE_Int   level)
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   (gcrodr_data -> print_level) = level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GCRODRGetPrintLevel( void *gcrodr_vdata,
+                           HYPRE_Int * level)
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *level = (gcrodr_data -> print_level);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRSetLogging, hypre_GCRODRGetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRSetLogging( void *gcrodr_vdata,
+                        HYPRE_Int   level)
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   (gcrodr_data -> logging) = level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GCRODRGetLogging( void *gcrodr_vdata,
+                        HYPRE_Int * level)
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *level = (gcrodr_data -> logging);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRGetNumIterations( void *gcrodr_vdata,
+                              HYPRE_Int  *num_iterations )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *num_iterations = (gcrodr_data -> num_iterations);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRGetConverged
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRGetConverged( void *gcrodr_vdata,
+                          HYPRE_Int  *converged )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *converged = (gcrodr_data -> converged);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GCRODRGetFinalRelativeResidualNorm( void   *gcrodr_vdata,
+                                          HYPRE_Real *relative_residual_norm )
+{
+   hypre_GCRODRData *gcrodr_data = (hypre_GCRODRData *)gcrodr_vdata;
+
+   *relative_residual_norm = (gcrodr_data -> rel_residual_norm);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,165 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * GCRODR gcro with deflated restarting (Krylov subspace recycling)
+ *
+ *****************************************************************************/
+
+#ifndef hypre_KRYLOV_GCRODR_HEADER
+#define hypre_KRYLOV_GCRODR_HEADER
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name Generic GCRODR Interface
+ *
+ * A general description of the interface goes here...
+ *
+ **/
+/*@{*/
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * hypre_GCRODRData and hypre_GCRODRFunctions
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name GCRODR structs
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * The {\tt hypre\_GCRODRFunctions} object ...
+ **/
+
+typedef struct
+{
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
+   HYPRE_Int    (*Free)          ( void *ptr );
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs );
+   void *       (*CreateVector)  ( void *vector );
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors );
+   HYPRE_Int    (*DestroyVector) ( void *vector );
+   void *       (*MatvecCreate)  ( void *A, void *x );
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+   HYPRE_Int    (*ClearVector)   ( void *x );
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+
+   HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x );
+   HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x );
+
+} hypre_GCRODRFunctions;
+
+/**
+ * The {\tt hypre\_GCRODRData} object ...
+ **/
+
+typedef struct
+{
+   HYPRE_Int      k_dim;
+   HYPRE_Int      min_iter;
+   HYPRE_Int      max_iter;
+   HYPRE_Int      converged;
+   HYPRE_Real   tol;
+   HYPRE_Real   a_tol;
+   HYPRE_Real   rel_residual_norm;
+
+/* recycling specific stuff */
+   HYPRE_Int      recycle_dim;    /* requested size of the recycled space */
+   HYPRE_Int      num_recycled;   /* current size, kept between solves */
+   HYPRE_Int      reproject;      /* operator changed since C = A U was formed */
+   void   **u;                    /* recycled space, unit vectors */
+   void   **c;                    /* A u_i = u_scale_i c_i, c orthonormal */
+   void   **u_new;
+   void   **c_new;
+   HYPRE_Real  *u_scale;
+/*---*/
+
+   void  *A;
+   void  *r;
+   void  **v;
+   void  **z;
+
+   void    *matvec_data;
+   void    *precond_data;
+
+   hypre_GCRODRFunctions * functions;
+
+   /* log info (always logged) */
+   HYPRE_Int      num_iterations;
+
+   HYPRE_Int     print_level; /* printing when print_level>0 */
+   HYPRE_Int     logging;  /* extra computations for logging when logging>0 */
+   HYPRE_Real  *norms;
+
+} hypre_GCRODRData;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name generic GCRODR Solver
+ *
+ * Description...
+ **/
+/*@{*/
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+hypre_GCRODRFunctions *
+hypre_GCRODRFunctionsCreate(
+   void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+   HYPRE_Int    (*Free)          ( void *ptr ),
+   HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                   HYPRE_Int   *num_procs ),
+   void *       (*CreateVector)  ( void *vector ),
+   void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+   HYPRE_Int    (*DestroyVector) ( void *vector ),
+   void *       (*MatvecCreate)  ( void *A, void *x ),
+   HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                   void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+   HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+   HYPRE_Int    (*ClearVector)   ( void *x ),
+   HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+   HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+   HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+   );
+
+/**
+ * Description...
+ *
+ * @param param [IN] ...
+ **/
+
+void *
+hypre_GCRODRCreate( hypre_GCRODRFunctions *gcrodr_functions );
+
+#ifdef __cplusplus
+}
+#endif
+#endif
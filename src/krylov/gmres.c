@@ -36,6 +36,7 @@ hypre_GMRESFunctionsCreate(
    HYPRE_Int    (*ClearVector)   ( void *x ),
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y ),
    HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    )
@@ -58,6 +59,7 @@ hypre_GMRESFunctionsCreate(
    gmres_functions->ClearVector = ClearVector;
    gmres_functions->ScaleVector = ScaleVector;
    gmres_functions->Axpy = Axpy;
+   gmres_functions->AxpyInnerProd = AxpyInnerProd;
 /* default preconditioner must be set here but can be changed later... */
    gmres_functions->precond_setup = PrecondSetup;
    gmres_functions->precond       = Precond;
@@ -520,9 +522,20 @@ hypre_GMRESSolve(void  *gmres_vdata,
          for (j=0; j < i; j++)
          {
             hh[j][i-1] = (*(gmres_functions->InnerProd))(p[j],p[i]);
-            (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+            if (j < i-1 || !(gmres_functions->AxpyInnerProd))
+            {
+               (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+            }
+         }
+         /* the last projection and the norm in one pass if possible */
+         if (gmres_functions->AxpyInnerProd)
+         {
+            t = sqrt((*(gmres_functions->AxpyInnerProd))(-hh[i-1][i-1],p[i-1],p[i]));
+         }
+         else
+         {
+            t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
          }
-         t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
          hh[i][i-1] = t;
          if (t != 0.0)
          {
@@ -101,6 +101,9 @@ extern "C" {
     HYPRE_Int  (*ClearVector)   ( void *x );
     HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha , void *x );
     HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha , void *x , void *y );
+    HYPRE_Real (*Axpy2InnerProd)( HYPRE_Complex alpha , void *x , void *y ,
+                                  HYPRE_Complex beta , void *z , void *w );
+    HYPRE_Int  (*Xpay)          ( HYPRE_Complex beta , void *x , void *y );
     HYPRE_Int  (*CommInfo)      ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
     HYPRE_Int  (*precond_setup) (void *vdata , void *A , void *b , void *x);
     HYPRE_Int  (*precond)       (void *vdata , void *A , void *b , void *x);
@@ -180,6 +183,9 @@ extern "C" {
           HYPRE_Int  (*ClearVector)   ( void *x ),
           HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha , void *x ),
           HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha , void *x , void *y ),
+          HYPRE_Real (*Axpy2InnerProd)( HYPRE_Complex alpha , void *x , void *y ,
+            HYPRE_Complex beta , void *z , void *w ),
+          HYPRE_Int  (*Xpay)          ( HYPRE_Complex beta , void *x , void *y ),
           HYPRE_Int  (*CommInfo)      ( void *A , HYPRE_Int *my_id ,
             HYPRE_Int *num_procs ),
           HYPRE_Int  (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
@@ -411,6 +417,7 @@ extern "C" {
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+    HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y );
 
     HYPRE_Int    (*precond)       (void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup) (void *vdata , void *A , void *b , void *x);
@@ -494,6 +501,7 @@ extern "C" {
           HYPRE_Int    (*ClearVector)   ( void *x ),
           HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
           HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+          HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y ),
           HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
           HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
@@ -569,6 +577,7 @@ extern "C" {
     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
     HYPRE_Int    (*MassInnerProd) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result);
+    HYPRE_Int    (*MassInnerProdMult) ( void **x, HYPRE_Int nx, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result);
     HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y);
     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
     HYPRE_Int    (*ClearVector)   ( void *x );
@@ -592,6 +601,7 @@ extern "C" {
     HYPRE_Int      k_dim;
     HYPRE_Int      unroll;
     HYPRE_Int      cgs;
+    HYPRE_Int      s_step;
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -655,6 +665,7 @@ extern "C" {
           HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
           HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
           HYPRE_Int    (*MassInnerProd) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result),
+          HYPRE_Int    (*MassInnerProdMult) ( void **x, HYPRE_Int nx, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result),
           HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y),
           HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
           HYPRE_Int    (*ClearVector)   ( void *x ),
@@ -841,6 +852,165 @@ extern "C" {
     void *
       hypre_LGMRESCreate( hypre_LGMRESFunctions *lgmres_functions );
 
+#ifdef __cplusplus
+  }
+#endif
+#endif
+
+  /******************************************************************************
+   *
+   * GCRODR gcro with deflated restarting (Krylov subspace recycling)
+   *
+   *****************************************************************************/
+
+#ifndef hypre_KRYLOV_GCRODR_HEADER
+#define hypre_KRYLOV_GCRODR_HEADER
+
+  /*--------------------------------------------------------------------------
+   *--------------------------------------------------------------------------*/
+
+  /**
+   * @name Generic GCRODR Interface
+   *
+   * A general description of the interface goes here...
+   *
+   **/
+  /*@{*/
+
+  /*--------------------------------------------------------------------------
+   *--------------------------------------------------------------------------*/
+
+  /*--------------------------------------------------------------------------
+   * hypre_GCRODRData and hypre_GCRODRFunctions
+   *--------------------------------------------------------------------------*/
+
+  /**
+   * @name GCRODR structs
+   *
+   * Description...
+   **/
+  /*@{*/
+
+  /**
+   * The {\tt hypre\_GCRODRFunctions} object ...
+   **/
+
+  typedef struct
+  {
+     void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
+     HYPRE_Int    (*Free)          ( void *ptr );
+     HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                     HYPRE_Int   *num_procs );
+     void *       (*CreateVector)  ( void *vector );
+     void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors );
+     HYPRE_Int    (*DestroyVector) ( void *vector );
+     void *       (*MatvecCreate)  ( void *A, void *x );
+     HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     void *x, HYPRE_Complex beta, void *y );
+     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
+     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
+     HYPRE_Int    (*ClearVector)   ( void *x );
+     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
+     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+
+     HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x );
+     HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x );
+
+  } hypre_GCRODRFunctions;
+
+  /**
+   * The {\tt hypre\_GCRODRData} object ...
+   **/
+
+  typedef struct
+  {
+     HYPRE_Int      k_dim;
+     HYPRE_Int      min_iter;
+     HYPRE_Int      max_iter;
+     HYPRE_Int      converged;
+     HYPRE_Real   tol;
+     HYPRE_Real   a_tol;
+     HYPRE_Real   rel_residual_norm;
+
+  /* recycling specific stuff */
+     HYPRE_Int      recycle_dim;    /* requested size of the recycled space */
+     HYPRE_Int      num_recycled;   /* current size, kept between solves */
+     HYPRE_Int      reproject;      /* operator changed since C = A U was formed */
+     void   **u;                    /* recycled space, unit vectors */
+     void   **c;                    /* A u_i = u_scale_i c_i, c orthonormal */
+     void   **u_new;
+     void   **c_new;
+     HYPRE_Real  *u_scale;
+  /*---*/
+
+     void  *A;
+     void  *r;
+     void  **v;
+     void  **z;
+
+     void    *matvec_data;
+     void    *precond_data;
+
+     hypre_GCRODRFunctions * functions;
+
+     /* log info (always logged) */
+     HYPRE_Int      num_iterations;
+
+     HYPRE_Int     print_level; /* printing when print_level>0 */
+     HYPRE_Int     logging;  /* extra computations for logging when logging>0 */
+     HYPRE_Real  *norms;
+
+  } hypre_GCRODRData;
+
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+  /**
+   * @name generic GCRODR Solver
+   *
+   * Description...
+   **/
+  /*@{*/
+
+  /**
+   * Description...
+   *
+   * @param param [IN] ...
+   **/
+
+  hypre_GCRODRFunctions *
+  hypre_GCRODRFunctionsCreate(
+     void *       (*CAlloc)        ( size_t count, size_t elt_size, HYPRE_MemoryLocation location ),
+     HYPRE_Int    (*Free)          ( void *ptr ),
+     HYPRE_Int    (*CommInfo)      ( void  *A, HYPRE_Int   *my_id,
+                                     HYPRE_Int   *num_procs ),
+     void *       (*CreateVector)  ( void *vector ),
+     void *       (*CreateVectorArray)  ( HYPRE_Int size, void *vectors ),
+     HYPRE_Int    (*DestroyVector) ( void *vector ),
+     void *       (*MatvecCreate)  ( void *A, void *x ),
+     HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                     void *x, HYPRE_Complex beta, void *y ),
+     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
+     HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+     HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
+     HYPRE_Int    (*ClearVector)   ( void *x ),
+     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
+     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+     HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
+     HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
+     );
+
+  /**
+   * Description...
+   *
+   * @param param [IN] ...
+   **/
+
+  void *
+  hypre_GCRODRCreate( hypre_GCRODRFunctions *gcrodr_functions );
+
 #ifdef __cplusplus
   }
 #endif
@@ -1057,10 +1227,17 @@ extern "C" {
         void *x, HYPRE_Complex beta, void *y );
     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+    HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y,
+                                    HYPRE_Real *local, HYPRE_Real *result,
+                                    hypre_MPI_Request *request );
+    HYPRE_Int    (*InnerProdWait) ( hypre_MPI_Request *request );
     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+    HYPRE_Real   (*Axpy2InnerProd)( HYPRE_Complex alpha, void *x, void *y,
+                                   HYPRE_Complex beta, void *z, void *w );
+    HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y );
 
     HYPRE_Int    (*precond)(void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup)(void *vdata , void *A , void *b , void *x);
@@ -1117,6 +1294,7 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      pipelined;
 
     void    *A;
     void    *p;
@@ -1124,6 +1302,15 @@ extern "C" {
     void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
 
+    /* pipelined CG only: u = C*r, w = A*u, m = C*w, n = A*m, and the
+       recurrences z = A*q, q = C*s, with s = A*p */
+    void    *u;
+    void    *w;
+    void    *m;
+    void    *n;
+    void    *z;
+    void    *q;
+
     HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
     void    *matvec_data;
     void    *precond_data;
@@ -1174,10 +1361,16 @@ extern "C" {
             void *x, HYPRE_Complex beta, void *y ),
           HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
           HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+          HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y,
+            HYPRE_Real *local, HYPRE_Real *result, hypre_MPI_Request *request ),
+          HYPRE_Int    (*InnerProdWait) ( hypre_MPI_Request *request ),
           HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
           HYPRE_Int    (*ClearVector)   ( void *x ),
           HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
           HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+          HYPRE_Real   (*Axpy2InnerProd)( HYPRE_Complex alpha, void *x, void *y,
+            HYPRE_Complex beta, void *z, void *w ),
+          HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y ),
           HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
           HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
           );
@@ -1280,6 +1473,8 @@ extern "C" {
   HYPRE_Int hypre_COGMRESGetUnroll ( void *gmres_vdata , HYPRE_Int *unroll );
   HYPRE_Int hypre_COGMRESSetCGS ( void *gmres_vdata , HYPRE_Int cgs );
   HYPRE_Int hypre_COGMRESGetCGS ( void *gmres_vdata , HYPRE_Int *cgs );
+  HYPRE_Int hypre_COGMRESSetSStep ( void *gmres_vdata , HYPRE_Int s_step );
+  HYPRE_Int hypre_COGMRESGetSStep ( void *gmres_vdata , HYPRE_Int *s_step );
   HYPRE_Int hypre_COGMRESSetTol ( void *gmres_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_COGMRESGetTol ( void *gmres_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_COGMRESSetAbsoluteTol ( void *gmres_vdata , HYPRE_Real a_tol );
@@ -1371,6 +1566,36 @@ extern "C" {
   HYPRE_Int hypre_LGMRESGetConverged ( void *lgmres_vdata , HYPRE_Int *converged );
   HYPRE_Int hypre_LGMRESGetFinalRelativeResidualNorm ( void *lgmres_vdata , HYPRE_Real *relative_residual_norm );
 
+  /* gcrodr.c */
+  void *hypre_GCRODRCreate ( hypre_GCRODRFunctions *gcrodr_functions );
+  HYPRE_Int hypre_GCRODRDestroy ( void *gcrodr_vdata );
+  HYPRE_Int hypre_GCRODRGetResidual ( void *gcrodr_vdata , void **residual );
+  HYPRE_Int hypre_GCRODRSetup ( void *gcrodr_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_GCRODRSolve ( void *gcrodr_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_GCRODRSetKDim ( void *gcrodr_vdata , HYPRE_Int k_dim );
+  HYPRE_Int hypre_GCRODRGetKDim ( void *gcrodr_vdata , HYPRE_Int *k_dim );
+  HYPRE_Int hypre_GCRODRSetRecycleDim ( void *gcrodr_vdata , HYPRE_Int recycle_dim );
+  HYPRE_Int hypre_GCRODRGetRecycleDim ( void *gcrodr_vdata , HYPRE_Int *recycle_dim );
+  HYPRE_Int hypre_GCRODRGetNumRecycled ( void *gcrodr_vdata , HYPRE_Int *num_recycled );
+  HYPRE_Int hypre_GCRODRClearRecycled ( void *gcrodr_vdata );
+  HYPRE_Int hypre_GCRODRSetTol ( void *gcrodr_vdata , HYPRE_Real tol );
+  HYPRE_Int hypre_GCRODRGetTol ( void *gcrodr_vdata , HYPRE_Real *tol );
+  HYPRE_Int hypre_GCRODRSetAbsoluteTol ( void *gcrodr_vdata , HYPRE_Real a_tol );
+  HYPRE_Int hypre_GCRODRGetAbsoluteTol ( void *gcrodr_vdata , HYPRE_Real *a_tol );
+  HYPRE_Int hypre_GCRODRSetMinIter ( void *gcrodr_vdata , HYPRE_Int min_iter );
+  HYPRE_Int hypre_GCRODRGetMinIter ( void *gcrodr_vdata , HYPRE_Int *min_iter );
+  HYPRE_Int hypre_GCRODRSetMaxIter ( void *gcrodr_vdata , HYPRE_Int max_iter );
+  HYPRE_Int hypre_GCRODRGetMaxIter ( void *gcrodr_vdata , HYPRE_Int *max_iter );
+  HYPRE_Int hypre_GCRODRSetPrecond ( void *gcrodr_vdata , HYPRE_Int (*precond )(void*,void*,void*,void*), HYPRE_Int (*precond_setup )(void*,void*,void*,void*) , void *precond_data );
+  HYPRE_Int hypre_GCRODRGetPrecond ( void *gcrodr_vdata , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int hypre_GCRODRSetPrintLevel ( void *gcrodr_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_GCRODRGetPrintLevel ( void *gcrodr_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_GCRODRSetLogging ( void *gcrodr_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_GCRODRGetLogging ( void *gcrodr_vdata , HYPRE_Int *level );
+  HYPRE_Int hypre_GCRODRGetNumIterations ( void *gcrodr_vdata , HYPRE_Int *num_iterations );
+  HYPRE_Int hypre_GCRODRGetConverged ( void *gcrodr_vdata , HYPRE_Int *converged );
+  HYPRE_Int hypre_GCRODRGetFinalRelativeResidualNorm ( void *gcrodr_vdata , HYPRE_Real *relative_residual_norm );
+
   /* HYPRE_bicgstab.c */
   HYPRE_Int HYPRE_BiCGSTABDestroy ( HYPRE_Solver solver );
   HYPRE_Int HYPRE_BiCGSTABSetup ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
@@ -1444,6 +1669,8 @@ extern "C" {
   HYPRE_Int HYPRE_COGMRESGetUnroll ( HYPRE_Solver solver , HYPRE_Int *unroll );
   HYPRE_Int HYPRE_COGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
   HYPRE_Int HYPRE_COGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
+  HYPRE_Int HYPRE_COGMRESSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
+  HYPRE_Int HYPRE_COGMRESGetSStep ( HYPRE_Solver solver , HYPRE_Int *s_step );
   HYPRE_Int HYPRE_COGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
   HYPRE_Int HYPRE_COGMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
   HYPRE_Int HYPRE_COGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -1524,6 +1751,34 @@ extern "C" {
   HYPRE_Int HYPRE_LGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
   HYPRE_Int HYPRE_LGMRESGetResidual ( HYPRE_Solver solver , void *residual );
 
+  /* HYPRE_gcrodr.c */
+  HYPRE_Int HYPRE_GCRODRSetup ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
+  HYPRE_Int HYPRE_GCRODRSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
+  HYPRE_Int HYPRE_GCRODRSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+  HYPRE_Int HYPRE_GCRODRGetKDim ( HYPRE_Solver solver , HYPRE_Int *k_dim );
+  HYPRE_Int HYPRE_GCRODRSetRecycleDim ( HYPRE_Solver solver , HYPRE_Int recycle_dim );
+  HYPRE_Int HYPRE_GCRODRGetRecycleDim ( HYPRE_Solver solver , HYPRE_Int *recycle_dim );
+  HYPRE_Int HYPRE_GCRODRGetNumRecycled ( HYPRE_Solver solver , HYPRE_Int *num_recycled );
+  HYPRE_Int HYPRE_GCRODRClearRecycled ( HYPRE_Solver solver );
+  HYPRE_Int HYPRE_GCRODRSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+  HYPRE_Int HYPRE_GCRODRGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
+  HYPRE_Int HYPRE_GCRODRSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
+  HYPRE_Int HYPRE_GCRODRGetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real *a_tol );
+  HYPRE_Int HYPRE_GCRODRSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
+  HYPRE_Int HYPRE_GCRODRGetMinIter ( HYPRE_Solver solver , HYPRE_Int *min_iter );
+  HYPRE_Int HYPRE_GCRODRSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+  HYPRE_Int HYPRE_GCRODRGetMaxIter ( HYPRE_Solver solver , HYPRE_Int *max_iter );
+  HYPRE_Int HYPRE_GCRODRSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
+  HYPRE_Int HYPRE_GCRODRGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
+  HYPRE_Int HYPRE_GCRODRSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_GCRODRGetPrintLevel ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_GCRODRSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
+  HYPRE_Int HYPRE_GCRODRGetLogging ( HYPRE_Solver solver , HYPRE_Int *level );
+  HYPRE_Int HYPRE_GCRODRGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+  HYPRE_Int HYPRE_GCRODRGetConverged ( HYPRE_Solver solver , HYPRE_Int *converged );
+  HYPRE_Int HYPRE_GCRODRGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+  HYPRE_Int HYPRE_GCRODRGetResidual ( HYPRE_Solver solver , void *residual );
+
   /* HYPRE_pcg.c */
   HYPRE_Int HYPRE_PCGSetup ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
   HYPRE_Int HYPRE_PCGSolve ( HYPRE_Solver solver , HYPRE_Matrix A , HYPRE_Vector b , HYPRE_Vector x );
@@ -1549,6 +1804,8 @@ extern "C" {
   HYPRE_Int HYPRE_PCGGetRecomputeResidual ( HYPRE_Solver solver , HYPRE_Int *recompute_residual );
   HYPRE_Int HYPRE_PCGSetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int recompute_residual_p );
   HYPRE_Int HYPRE_PCGGetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int HYPRE_PCGSetPipelined ( HYPRE_Solver solver , HYPRE_Int pipelined );
+  HYPRE_Int HYPRE_PCGGetPipelined ( HYPRE_Solver solver , HYPRE_Int *pipelined );
   HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_PCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1563,9 +1820,11 @@ extern "C" {
   /* pcg.c */
   void *hypre_PCGCreate ( hypre_PCGFunctions *pcg_functions );
   HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
+  HYPRE_Int hypre_PCGDestroyPipelinedVectors ( void *pcg_vdata );
   HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata , void **residual );
   HYPRE_Int hypre_PCGSetup ( void *pcg_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_PCGSolve ( void *pcg_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_PCGSolvePipelined ( void *pcg_vdata , void *A , void *b , void *x , HYPRE_Real bi_prod , HYPRE_Real eps );
   HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata , HYPRE_Real a_tol );
@@ -1586,6 +1845,8 @@ extern "C" {
   HYPRE_Int hypre_PCGGetRecomputeResidual ( void *pcg_vdata , HYPRE_Int *recompute_residual );
   HYPRE_Int hypre_PCGSetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int recompute_residual_p );
   HYPRE_Int hypre_PCGGetRecomputeResidualP ( void *pcg_vdata , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata , HYPRE_Int pipelined );
+  HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata , HYPRE_Int *pipelined );
   HYPRE_Int hypre_PCGSetStopCrit ( void *pcg_vdata , HYPRE_Int stop_crit );
   HYPRE_Int hypre_PCGGetStopCrit ( void *pcg_vdata , HYPRE_Int *stop_crit );
   HYPRE_Int hypre_PCGGetPrecond ( void *pcg_vdata , HYPRE_Solver *precond_data_ptr );
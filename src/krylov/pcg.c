@@ -40,10 +40,17 @@ hypre_PCGFunctionsCreate(
                                    void *x, HYPRE_Complex beta, void *y ),
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y,
+                                   HYPRE_Real *local, HYPRE_Real *result,
+                                   hypre_MPI_Request *request ),
+   HYPRE_Int    (*InnerProdWait) ( hypre_MPI_Request *request ),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
    HYPRE_Int    (*ClearVector)   ( void *x ),
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Real   (*Axpy2InnerProd)( HYPRE_Complex alpha, void *x, void *y,
+                                   HYPRE_Complex beta, void *z, void *w ),
+   HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y ),
    HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    )
@@ -61,10 +68,14 @@ hypre_PCGFunctionsCreate(
    pcg_functions->Matvec = Matvec;
    pcg_functions->MatvecDestroy = MatvecDestroy;
    pcg_functions->InnerProd = InnerProd;
+   pcg_functions->InnerProdStart = InnerProdStart;
+   pcg_functions->InnerProdWait = InnerProdWait;
    pcg_functions->CopyVector = CopyVector;
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
    pcg_functions->Axpy = Axpy;
+   pcg_functions->Axpy2InnerProd = Axpy2InnerProd;
+   pcg_functions->Xpay = Xpay;
    /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
@@ -101,6 +112,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> pipelined)    = 0;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -111,6 +123,12 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> u)            = NULL;
+   (pcg_data -> w)            = NULL;
+   (pcg_data -> m)            = NULL;
+   (pcg_data -> n)            = NULL;
+   (pcg_data -> z)            = NULL;
+   (pcg_data -> q)            = NULL;
 
    HYPRE_ANNOTATE_FUNC_END;
 
@@ -161,6 +179,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGDestroyPipelinedVectors(pcg_data);
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -170,6 +189,37 @@ hypre_PCGDestroy( void *pcg_vdata )
    return(hypre_error_flag);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGDestroyPipelinedVectors
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGDestroyPipelinedVectors( void *pcg_vdata )
+{
+   hypre_PCGData      *pcg_data      = (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   void              **vectors[6];
+   HYPRE_Int           k;
+
+   vectors[0] = &(pcg_data -> u);
+   vectors[1] = &(pcg_data -> w);
+   vectors[2] = &(pcg_data -> m);
+   vectors[3] = &(pcg_data -> n);
+   vectors[4] = &(pcg_data -> z);
+   vectors[5] = &(pcg_data -> q);
+
+   for (k = 0; k < 6; k++)
+   {
+      if ( *vectors[k] != NULL )
+      {
+         (*(pcg_functions->DestroyVector))(*vectors[k]);
+         *vectors[k] = NULL;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGGetResidual
  *--------------------------------------------------------------------------*/
@@ -221,6 +271,17 @@ hypre_PCGSetup( void *pcg_vdata,
       (*(pcg_functions->DestroyVector))(pcg_data -> r);
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   hypre_PCGDestroyPipelinedVectors(pcg_data);
+   if ( pcg_data -> pipelined )
+   {
+      (pcg_data -> u) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> w) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> m) = (*(pcg_functions->CreateVector))(x);
+      (pcg_data -> n) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> z) = (*(pcg_functions->CreateVector))(b);
+      (pcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+   }
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
    (pcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
@@ -310,6 +371,8 @@ hypre_PCGSolve( void *pcg_vdata,
 
    HYPRE_Real      i_prod = 0.0;
    HYPRE_Real      i_prod_0 = 0.0;
+   HYPRE_Real      ri_prod = 0.0;
+   HYPRE_Int       have_ri_prod = 0;
    HYPRE_Real      cf_ave_0 = 0.0;
    HYPRE_Real      cf_ave_1 = 0.0;
    HYPRE_Real      weight;
@@ -424,6 +487,15 @@ hypre_PCGSolve( void *pcg_vdata,
          action to force iterations even though the exact value was known. */
    };
 
+   if ( (pcg_data -> pipelined) && (pcg_data -> u) &&
+        (pcg_functions -> InnerProdStart) && (pcg_functions -> InnerProdWait) )
+   {
+      hypre_PCGSolvePipelined(pcg_vdata, A, b, x, bi_prod, eps);
+      HYPRE_ANNOTATE_FUNC_END;
+
+      return hypre_error_flag;
+   }
+
    /* r = b - Ax */
    (*(pcg_functions->CopyVector))(b, r);
 
@@ -529,16 +601,22 @@ hypre_PCGSolve( void *pcg_vdata,
 
       gamma_old = gamma;
 
-      /* x = x + alpha*p */
-      (*(pcg_functions->Axpy))(alpha, p, x);
-
-      /* r = r - alpha*s */
-      if ( !recompute_true_residual )
+      /* x = x + alpha*p, r = r - alpha*s; in the 2-norm case <r,r> is
+         formed in the same pass when the vector type provides it */
+      have_ri_prod = 0;
+      if ( !recompute_true_residual && two_norm && (pcg_functions -> Axpy2InnerProd) )
+      {
+         ri_prod = (*(pcg_functions->Axpy2InnerProd))(alpha, p, x, -alpha, s, r);
+         have_ri_prod = 1;
+      }
+      else if ( !recompute_true_residual )
       {
+         (*(pcg_functions->Axpy))(alpha, p, x);
          (*(pcg_functions->Axpy))(-alpha, s, r);
       }
       else
       {
+         (*(pcg_functions->Axpy))(alpha, p, x);
          if (print_level > 1 && my_id == 0)
          {
             hypre_printf("Recomputing the residual...\n");
@@ -586,7 +664,7 @@ hypre_PCGSolve( void *pcg_vdata,
 
       /* set i_prod for convergence test */
       if (two_norm)
-         i_prod = (*(pcg_functions->InnerProd))(r,r);
+         i_prod = have_ri_prod ? ri_prod : (*(pcg_functions->InnerProd))(r,r);
       else
          i_prod = gamma;
 
@@ -730,7 +808,11 @@ hypre_PCGSolve( void *pcg_vdata,
       beta = gamma / gamma_old;
 
       /* p = s + beta p */
-      if ( !recompute_true_residual )
+      if ( !recompute_true_residual && (pcg_functions -> Xpay) )
+      {
+         (*(pcg_functions->Xpay))(beta, s, p);
+      }
+      else if ( !recompute_true_residual )
       {
          (*(pcg_functions->ScaleVector))(beta, p);
          (*(pcg_functions->Axpy))(1.0, s, p);
@@ -762,6 +844,413 @@ hypre_PCGSolve( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolvePipelined
+ *--------------------------------------------------------------------------
+ *
+ * Pipelined PCG (Ghysels and Vanroose, Parallel Computing 40, 2014). All the
+ * inner products of an iteration go into one non-blocking reduction, which
+ * is overlapped with the preconditioner and the matvec:
+ *
+ *       start  gamma = <r,u>, delta = <w,u>
+ *              m = C*w, n = A*m
+ *       wait
+ *       beta  = gamma / gamma_old
+ *       alpha = gamma / (delta - beta*gamma/alpha_old)
+ *       z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p
+ *       x = x + alpha*p, r = r - alpha*s, u = u - alpha*q, w = w - alpha*z
+ *
+ * In exact arithmetic this gives the iterates of hypre_PCGSolve, but the
+ * extra recurrences let rounding errors build up in r. With
+ * recompute_residual_p > 0, r, u, w, s, q and z are replaced with their true
+ * values every recompute_residual_p iterations (residual replacement).
+ * This is called from hypre_PCGSolve once bi_prod and eps are known.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolvePipelined( void       *pcg_vdata,
+                         void       *A,
+                         void       *b,
+                         void       *x,
+                         HYPRE_Real  bi_prod,
+                         HYPRE_Real  eps )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Real      cf_tol       = (pcg_data -> cf_tol);
+   HYPRE_Real      rtol         = (pcg_data -> rtol);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       rel_change   = (pcg_data -> rel_change);
+   HYPRE_Int       recompute_residual   = (pcg_data -> recompute_residual);
+   HYPRE_Int       recompute_residual_p = (pcg_data -> recompute_residual_p);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *p            = (pcg_data -> p);
+   void           *s            = (pcg_data -> s);
+   void           *r            = (pcg_data -> r);
+   void           *u            = (pcg_data -> u);
+   void           *w            = (pcg_data -> w);
+   void           *m            = (pcg_data -> m);
+   void           *n            = (pcg_data -> n);
+   void           *z            = (pcg_data -> z);
+   void           *q            = (pcg_data -> q);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   /* fused reduction: gamma, delta, then the optional products */
+   void           *dot_x[6], *dot_y[6];
+   HYPRE_Real      local[6], result[6];
+   hypre_MPI_Request request;
+   HYPRE_Int       num_dots, k_rr, k_pp, k_xx, k_ss;
+
+   HYPRE_Real      alpha = 0.0, alpha_old = 0.0, beta;
+   HYPRE_Real      gamma = 0.0, gamma_old = 0.0, delta, denom;
+   HYPRE_Real      ieee_check = 0.;
+
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      i_prod_0 = 0.0;
+   HYPRE_Real      cf_ave_0 = 0.0;
+   HYPRE_Real      cf_ave_1 = 0.0;
+   HYPRE_Real      weight;
+   HYPRE_Real      ratio;
+
+   HYPRE_Int       tentatively_converged = 0;
+   HYPRE_Int       replace_residual = 0;
+
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+
+   /* r = b - Ax, u = C*r, w = A*u */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   while (1)
+   {
+      /*--------------------------------------------------------------------
+       * start the reduction and overlap it with m = C*w, n = A*m
+       *--------------------------------------------------------------------*/
+
+      dot_x[0] = r;  dot_y[0] = u;
+      dot_x[1] = w;  dot_y[1] = u;
+      num_dots = 2;
+      k_rr = k_pp = k_xx = k_ss = -1;
+      if (two_norm)
+      {
+         k_rr = num_dots;
+         dot_x[num_dots] = r;  dot_y[num_dots++] = r;
+      }
+      if (i > 0 && rel_change)
+      {
+         k_pp = num_dots;
+         dot_x[num_dots] = p;  dot_y[num_dots++] = p;
+         k_xx = num_dots;
+         dot_x[num_dots] = x;  dot_y[num_dots++] = x;
+      }
+      if (i > 0 && rtol && two_norm)
+      {
+         k_ss = num_dots;
+         dot_x[num_dots] = s;  dot_y[num_dots++] = s;
+      }
+
+      (*(pcg_functions->InnerProdStart))(num_dots, dot_x, dot_y, local, result, &request);
+
+      (*(pcg_functions->ClearVector))(m);
+      precond(precond_data, A, w, m);
+      (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+
+      (*(pcg_functions->InnerProdWait))(&request);
+
+      gamma = result[0];
+      delta = result[1];
+      i_prod = two_norm ? result[k_rr] : gamma;
+
+      if (i == 0)
+      {
+         /* Since it is does not diminish performance, attempt to return an
+            error flag and notify users when they supply bad input. */
+         if (gamma != 0.) ieee_check = gamma/gamma; /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            if (print_level > 0 || logging > 0)
+            {
+              hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+              hypre_printf("ERROR -- hypre_PCGSolve: INFs and/or NaNs detected in input.\n");
+              hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+              hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+              hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+
+            return hypre_error_flag;
+         }
+
+         /* Set initial residual norm */
+         i_prod_0 = i_prod;
+         if ( logging>0 || print_level>0 ) norms[0] = sqrt(i_prod_0);
+
+         if ( print_level > 1 && my_id==0 )
+         {
+            hypre_printf("\n\n");
+            if (two_norm)
+            {
+               if ( stop_crit && !rel_change && atolf==0 )  /* pure absolute tolerance */
+               {
+                  hypre_printf("Iters       ||r||_2     conv.rate\n");
+                  hypre_printf("-----    ------------   ---------\n");
+               }
+               else
+               {
+                  hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+                  hypre_printf("-----    ------------   ---------  ------------ \n");
+               }
+            }
+            else  /* !two_norm */
+            {
+               hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+               hypre_printf("-----    ------------    ---------  ------------ \n");
+            }
+         }
+      }
+      else
+      {
+         /* residual-based stopping criteria, see hypre_PCGSolve */
+         if (rtol && two_norm)
+         {
+            HYPRE_Real drob2 = alpha*alpha*result[k_ss]/bi_prod;
+            if ( drob2 < rtol*rtol )
+            {
+               if (print_level > 1 && my_id == 0)
+               {
+                  hypre_printf("\n\n||r_old-r_new||/||b||: %e\n", sqrt(drob2));
+               }
+               break;
+            }
+         }
+         else if (rtol)
+         {
+            HYPRE_Real r2ob2 = (gamma + gamma_old)/bi_prod;
+            if ( r2ob2 < rtol*rtol)
+            {
+               if (print_level > 1 && my_id == 0)
+               {
+                  hypre_printf("\n\n||r_old-r_new||_C/||b||_C: %e\n", sqrt(r2ob2));
+               }
+               break;
+            }
+         }
+
+         /* print norm info */
+         if ( logging>0 || print_level>0 )
+         {
+            norms[i]     = sqrt(i_prod);
+            rel_norms[i] = bi_prod ? sqrt(i_prod/bi_prod) : 0;
+         }
+         if ( print_level > 1 && my_id==0 )
+         {
+            if (two_norm && stop_crit && !rel_change && atolf==0)
+            {
+               hypre_printf("% 5d    %e    %f\n", i, norms[i],
+                            norms[i]/norms[i-1] );
+            }
+            else
+            {
+               hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                            norms[i]/norms[i-1], rel_norms[i] );
+            }
+         }
+
+         /*-----------------------------------------------------------------
+          * check for convergence
+          *-----------------------------------------------------------------*/
+         tentatively_converged = (i_prod / bi_prod < eps);
+         if ( tentatively_converged && recompute_residual )
+         {
+            /* r = b - Ax; m is free until the next iteration */
+            (*(pcg_functions->CopyVector))(b, r);
+            (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+            if (two_norm)
+            {
+               i_prod = (*(pcg_functions->InnerProd))(r,r);
+            }
+            else
+            {
+               (*(pcg_functions->ClearVector))(m);
+               precond(precond_data, A, r, m);
+               i_prod = (*(pcg_functions->InnerProd))(r, m);
+            }
+            if (i_prod / bi_prod >= eps)
+            {
+               /* r changed, so the recurrences must follow */
+               tentatively_converged = 0;
+               replace_residual = 1;
+            }
+         }
+         if ( tentatively_converged && rel_change && (i_prod > 0.0) )
+         {
+            ratio = alpha*alpha*result[k_pp]/result[k_xx];
+            if (ratio >= eps) tentatively_converged = 0;
+         }
+         if ( tentatively_converged )
+         {
+            (pcg_data -> converged) = 1;
+            break;
+         }
+
+         if (! (gamma > HYPRE_REAL_MIN) )
+         {
+            hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+
+            break;
+         }
+
+         /* convergence factor test, see hypre_PCGSolve */
+         if (cf_tol > 0.0)
+         {
+            cf_ave_0 = cf_ave_1;
+            if (! (i_prod_0 > HYPRE_REAL_MIN) )
+            {
+               hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal i_prod value in PCG");
+
+               break;
+            }
+            cf_ave_1 = pow( i_prod / i_prod_0, 1.0/(2.0*i) );
+
+            weight   = fabs(cf_ave_1 - cf_ave_0);
+            weight   = weight / hypre_max(cf_ave_1, cf_ave_0);
+            weight   = 1.0 - weight;
+            if (weight * cf_ave_1 > cf_tol) break;
+         }
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      /*--------------------------------------------------------------------
+       * the core CG calculations...
+       *--------------------------------------------------------------------*/
+      i++;
+
+      if (i == 1)
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta * gamma / alpha_old;
+      }
+      if ( denom == 0.0 )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero sdotp value in PCG");
+         break;
+      }
+      alpha = gamma / denom;
+      if (! (alpha > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal alpha value in PCG");
+         break;
+      }
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+
+      /* z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p */
+      if (i == 1)
+      {
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+      else if (pcg_functions -> Xpay)
+      {
+         (*(pcg_functions->Xpay))(beta, n, z);
+         (*(pcg_functions->Xpay))(beta, m, q);
+         (*(pcg_functions->Xpay))(beta, w, s);
+         (*(pcg_functions->Xpay))(beta, u, p);
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+
+      /* x = x + alpha*p */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+
+      if (recompute_residual_p && !(i%recompute_residual_p))
+      {
+         replace_residual = 1;
+      }
+
+      if ( !replace_residual )
+      {
+         /* r = r - alpha*s, u = u - alpha*q, w = w - alpha*z */
+         (*(pcg_functions->Axpy))(-alpha, s, r);
+         (*(pcg_functions->Axpy))(-alpha, q, u);
+         (*(pcg_functions->Axpy))(-alpha, z, w);
+      }
+      else
+      {
+         /* residual replacement: r = b - Ax, u = C*r, w = A*u,
+            s = A*p, q = C*s, z = A*q */
+         if (print_level > 1 && my_id == 0)
+         {
+            hypre_printf("Recomputing the residual...\n");
+         }
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
+         (*(pcg_functions->ClearVector))(q);
+         precond(precond_data, A, s, q);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, q, 0.0, z);
+         replace_residual = 0;
+      }
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   if (i >= max_iter && (i_prod/bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetTol, hypre_PCGGetTol
  *--------------------------------------------------------------------------*/
@@ -1028,6 +1517,32 @@ hypre_PCGGetRecomputeResidualP( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int   pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int * pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetStopCrit, hypre_PCGGetStopCrit
  *--------------------------------------------------------------------------*/
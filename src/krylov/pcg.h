@@ -59,10 +59,17 @@ typedef struct
                                    void *x, HYPRE_Complex beta, void *y );
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
    HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y,
+                                   HYPRE_Real *local, HYPRE_Real *result,
+                                   hypre_MPI_Request *request );
+   HYPRE_Int    (*InnerProdWait) ( hypre_MPI_Request *request );
    HYPRE_Int    (*CopyVector)    ( void *x, void *y );
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   HYPRE_Real   (*Axpy2InnerProd)( HYPRE_Complex alpha, void *x, void *y,
+                                   HYPRE_Complex beta, void *z, void *w );
+   HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y );
 
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
@@ -119,6 +126,7 @@ typedef struct
    HYPRE_Int    stop_crit;
    HYPRE_Int    converged;
    HYPRE_Int    hybrid;
+   HYPRE_Int    pipelined;
 
    void    *A;
    void    *p;
@@ -126,6 +134,15 @@ typedef struct
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                   If that is ever changed, it still must be kept if logging>1 */
 
+   /* pipelined CG only: u = C*r, w = A*u, m = C*w, n = A*m, and the
+      recurrences z = A*q, q = C*s, with s = A*p */
+   void    *u;
+   void    *w;
+   void    *m;
+   void    *n;
+   void    *z;
+   void    *q;
+
    HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void      *matvec_data;
    void      *precond_data;
@@ -175,10 +192,17 @@ hypre_PCGFunctionsCreate(
                                    void *x, HYPRE_Complex beta, void *y ),
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y,
+                                   HYPRE_Real *local, HYPRE_Real *result,
+                                   hypre_MPI_Request *request ),
+   HYPRE_Int    (*InnerProdWait) ( hypre_MPI_Request *request ),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
    HYPRE_Int    (*ClearVector)   ( void *x ),
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y ),
+   HYPRE_Real   (*Axpy2InnerProd)( HYPRE_Complex alpha, void *x, void *y,
+                                   HYPRE_Complex beta, void *z, void *w ),
+   HYPRE_Int    (*Xpay)          ( HYPRE_Complex beta, void *x, void *y ),
    HYPRE_Int    (*PrecondSetup)  ( void *vdata, void *A, void *b, void *x ),
    HYPRE_Int    (*Precond)       ( void *vdata, void *A, void *b, void *x )
    );
@@ -567,6 +567,24 @@ HYPRE_BoomerAMGGetConvergeType( HYPRE_Solver solver,
    return( hypre_BoomerAMGGetConvergeType( (void *) solver, type ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetLaggedConvCheck, HYPRE_BoomerAMGGetLaggedConvCheck
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetLaggedConvCheck( HYPRE_Solver solver,
+                                   HYPRE_Int    lagged  )
+{
+   return( hypre_BoomerAMGSetLaggedConvCheck( (void *) solver, lagged ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetLaggedConvCheck( HYPRE_Solver solver,
+                                   HYPRE_Int   *lagged  )
+{
+   return( hypre_BoomerAMGGetLaggedConvCheck( (void *) solver, lagged ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetTol, HYPRE_BoomerAMGGetTol
  *--------------------------------------------------------------------------*/
@@ -1721,6 +1739,17 @@ HYPRE_BoomerAMGSetChebyEigEst( HYPRE_Solver  solver,
    return( hypre_BoomerAMGSetChebyEigEst( (void *) solver, eig_est ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetChebyCommAvoid
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetChebyCommAvoid( HYPRE_Solver  solver,
+                                  HYPRE_Int     cheby_ca )
+{
+   return( hypre_BoomerAMGSetChebyCommAvoid( (void *) solver, cheby_ca ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetInterpVectors
  *--------------------------------------------------------------------------*/
@@ -1859,6 +1888,17 @@ HYPRE_BoomerAMGSetAddLastLvl( HYPRE_Solver solver,
    return( hypre_BoomerAMGSetAddLastLvl( (void *) solver, add_last_lvl ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetAddAsync
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAddAsync( HYPRE_Solver solver,
+                            HYPRE_Int    add_async  )
+{
+   return( hypre_BoomerAMGSetAddAsync( (void *) solver, add_async ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetNonGalerkinTol
  *--------------------------------------------------------------------------*/
@@ -1927,6 +1967,28 @@ HYPRE_BoomerAMGSetKeepTranspose (HYPRE_Solver solver,
    return (hypre_BoomerAMGSetKeepTranspose ( (void *) solver, keepTranspose ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSinglePrecisionLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSinglePrecisionLevel (HYPRE_Solver solver,
+                                        HYPRE_Int    sp_level)
+{
+   return (hypre_BoomerAMGSetSinglePrecisionLevel ( (void *) solver, sp_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetReuseHierarchy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetReuseHierarchy (HYPRE_Solver solver,
+                                  HYPRE_Int    reuse_hierarchy)
+{
+   return (hypre_BoomerAMGSetReuseHierarchy ( (void *) solver, reuse_hierarchy ) );
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetDSLUThreshold
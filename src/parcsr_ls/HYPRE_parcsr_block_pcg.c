@@ -0,0 +1,177 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * HYPRE_ParCSRBlockPCG interface
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   *solver = (HYPRE_Solver) hypre_ParBlockPCGCreate( );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGDestroy( HYPRE_Solver solver )
+{
+   return( hypre_ParBlockPCGDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSetup( HYPRE_Solver solver,
+                           HYPRE_ParCSRMatrix A,
+                           HYPRE_ParVector b,
+                           HYPRE_ParVector x      )
+{
+   return( hypre_ParBlockPCGSetup( (void *) solver,
+                                   (hypre_ParCSRMatrix *) A,
+                                   (hypre_ParVector *) b,
+                                   (hypre_ParVector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSolve( HYPRE_Solver solver,
+                           HYPRE_ParCSRMatrix A,
+                           HYPRE_ParVector b,
+                           HYPRE_ParVector x      )
+{
+   return( hypre_ParBlockPCGSolve( (void *) solver,
+                                   (hypre_ParCSRMatrix *) A,
+                                   (hypre_ParVector *) b,
+                                   (hypre_ParVector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSetTol( HYPRE_Solver solver, HYPRE_Real tol )
+{
+   return( hypre_ParBlockPCGSetTol( (void *) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSetAbsoluteTol( HYPRE_Solver solver, HYPRE_Real a_tol )
+{
+   return( hypre_ParBlockPCGSetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSetRankTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSetRankTol( HYPRE_Solver solver, HYPRE_Real rank_tol )
+{
+   return( hypre_ParBlockPCGSetRankTol( (void *) solver, rank_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSetMaxIter( HYPRE_Solver solver, HYPRE_Int max_iter )
+{
+   return( hypre_ParBlockPCGSetMaxIter( (void *) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSetPrecond( HYPRE_Solver            solver,
+                                HYPRE_PtrToParSolverFcn precond,
+                                HYPRE_PtrToParSolverFcn precond_setup,
+                                HYPRE_Solver            precond_solver )
+{
+   return( hypre_ParBlockPCGSetPrecond( (void *) solver, precond, precond_setup,
+                                        precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSetPrecondMultivec
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSetPrecondMultivec( HYPRE_Solver solver, HYPRE_Int precond_multivec )
+{
+   return( hypre_ParBlockPCGSetPrecondMultivec( (void *) solver, precond_multivec ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSetPrintLevel( HYPRE_Solver solver, HYPRE_Int print_level )
+{
+   return( hypre_ParBlockPCGSetPrintLevel( (void *) solver, print_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGSetLogging( HYPRE_Solver solver, HYPRE_Int logging )
+{
+   return( hypre_ParBlockPCGSetLogging( (void *) solver, logging ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGGetNumIterations( HYPRE_Solver solver, HYPRE_Int *num_iterations )
+{
+   return( hypre_ParBlockPCGGetNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRBlockPCGGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRBlockPCGGetFinalRelativeResidualNorm( HYPRE_Solver solver, HYPRE_Real *norm )
+{
+   return( hypre_ParBlockPCGGetFinalRelativeResidualNorm( (void *) solver, norm ) );
+}
@@ -0,0 +1,247 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRCreate( MPI_Comm comm, HYPRE_Solver *solver )
+{
+   hypre_GCRODRFunctions * gcrodr_functions;
+
+   if (!solver)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   gcrodr_functions =
+      hypre_GCRODRFunctionsCreate(
+         hypre_ParKrylovCAlloc, hypre_ParKrylovFree, hypre_ParKrylovCommInfo,
+         hypre_ParKrylovCreateVector,
+         hypre_ParKrylovCreateVectorArray,
+         hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
+         hypre_ParKrylovMatvec, hypre_ParKrylovMatvecDestroy,
+         hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
+         hypre_ParKrylovClearVector,
+         hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
+         hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   *solver = ( (HYPRE_Solver) hypre_GCRODRCreate( gcrodr_functions ) );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int 
+HYPRE_ParCSRGCRODRDestroy( HYPRE_Solver solver )
+{
+   return( hypre_GCRODRDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int 
+HYPRE_ParCSRGCRODRSetup( HYPRE_Solver solver,
+                         HYPRE_ParCSRMatrix A,
+                         HYPRE_ParVector b,
+                         HYPRE_ParVector x      )
+{
+   return( HYPRE_GCRODRSetup( solver,
+                              (HYPRE_Matrix) A,
+                              (HYPRE_Vector) b,
+                              (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int 
+HYPRE_ParCSRGCRODRSolve( HYPRE_Solver solver,
+                         HYPRE_ParCSRMatrix A,
+                         HYPRE_ParVector b,
+                         HYPRE_ParVector x      )
+{
+   return( HYPRE_GCRODRSolve( solver,
+                              (HYPRE_Matrix) A,
+                              (HYPRE_Vector) b,
+                              (HYPRE_Vector) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetKDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRSetKDim( HYPRE_Solver solver,
+                           HYPRE_Int    k_dim    )
+{
+   return( HYPRE_GCRODRSetKDim( solver, k_dim ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetRecycleDim
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRSetRecycleDim( HYPRE_Solver solver,
+                                 HYPRE_Int    recycle_dim )
+{
+   return( HYPRE_GCRODRSetRecycleDim( solver, recycle_dim ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRGetNumRecycled
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRGetNumRecycled( HYPRE_Solver  solver,
+                                  HYPRE_Int    *num_recycled )
+{
+   return( HYPRE_GCRODRGetNumRecycled( solver, num_recycled ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRClearRecycled
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRClearRecycled( HYPRE_Solver solver )
+{
+   return( HYPRE_GCRODRClearRecycled( solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRSetTol( HYPRE_Solver solver,
+                          HYPRE_Real   tol    )
+{
+   return( HYPRE_GCRODRSetTol( solver, tol ) );
+}
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRSetAbsoluteTol( HYPRE_Solver solver,
+                                  HYPRE_Real   a_tol    )
+{
+   return( HYPRE_GCRODRSetAbsoluteTol( solver, a_tol ) );
+}
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetMinIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRSetMinIter( HYPRE_Solver solver,
+                              HYPRE_Int    min_iter )
+{
+   return( HYPRE_GCRODRSetMinIter( solver, min_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRSetMaxIter( HYPRE_Solver solver,
+                              HYPRE_Int    max_iter )
+{
+   return( HYPRE_GCRODRSetMaxIter( solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRSetPrecond( HYPRE_Solver          solver,
+                              HYPRE_PtrToParSolverFcn  precond,
+                              HYPRE_PtrToParSolverFcn  precond_setup,
+                              HYPRE_Solver          precond_solver )
+{
+   return( HYPRE_GCRODRSetPrecond( solver,
+                                   (HYPRE_PtrToSolverFcn) precond,
+                                   (HYPRE_PtrToSolverFcn) precond_setup,
+                                   precond_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRGetPrecond
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRGetPrecond( HYPRE_Solver  solver,
+                              HYPRE_Solver *precond_data_ptr )
+{
+   return( HYPRE_GCRODRGetPrecond( solver, precond_data_ptr ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetLogging
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRSetLogging( HYPRE_Solver solver,
+                              HYPRE_Int logging)
+{
+   return( HYPRE_GCRODRSetLogging( solver, logging ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRSetPrintLevel( HYPRE_Solver solver,
+                                 HYPRE_Int print_level)
+{
+   return( HYPRE_GCRODRSetPrintLevel( solver, print_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRGetNumIterations( HYPRE_Solver  solver,
+                                    HYPRE_Int    *num_iterations )
+{
+   return( HYPRE_GCRODRGetNumIterations( solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                                HYPRE_Real   *norm   )
+{
+   return( HYPRE_GCRODRGetFinalRelativeResidualNorm( solver, norm ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRGCRODRGetResidual
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRGCRODRGetResidual( HYPRE_Solver  solver,
+                               HYPRE_ParVector *residual)
+{
+   return( HYPRE_GCRODRGetResidual( solver, (void *) residual ) );
+}
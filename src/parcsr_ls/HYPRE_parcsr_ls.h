@@ -184,6 +184,18 @@ HYPRE_Int HYPRE_BoomerAMGSetDofFunc(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType(HYPRE_Solver solver,
                                          HYPRE_Int    type);
 
+/**
+ * (Optional) Use a lagged convergence check when BoomerAMG is used as a
+ * solver.  The global reduction for the residual norm of a cycle is
+ * started with a non-blocking Allreduce and completed after the next
+ * cycle, so its latency is hidden behind that cycle.  Convergence is
+ * detected one cycle late, i.e., the solve may do one more cycle than
+ * necessary.  The returned residual norm is that of the final iterate.
+ * The default is 0 (blocking check after every cycle).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetLaggedConvCheck(HYPRE_Solver solver,
+                                            HYPRE_Int    lagged);
+
 /**
  * (Optional) Set the convergence tolerance, if BoomerAMG is used
  * as a solver. If it is used as a preconditioner, it should be set to 0.
@@ -626,6 +638,18 @@ HYPRE_Int HYPRE_BoomerAMGSetSimple(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetAddLastLvl(HYPRE_Solver solver,
                                      HYPRE_Int    add_last_lvl);
 
+/**
+ * (Optional) If set to 1, the additive correction of the levels up to
+ * add_last_lvl is computed concurrently with the multiplicative cycle on
+ * the coarser levels. One thread does the coarse-level work, the others
+ * apply the additive smoother and are joined by the first one when it is
+ * done. Only has an effect when add_last_lvl is smaller than the coarsest
+ * level. Results are the same as without it up to roundoff.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetAddAsync(HYPRE_Solver solver,
+                                     HYPRE_Int    add_async);
+
 /**
  * (Optional) Defines the truncation factor for the
  * smoothed interpolation used for mult-additive or simple method.
@@ -738,6 +762,9 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 16 : Chebyshev
  *    - 17 : FCF-Jacobi
  *    - 18 : \f$\ell_1\f$-scaled jacobi
+ *    - 40 : hybrid multicolor Gauss-Seidel or SOR (result independent of
+ *           the number of threads)
+ *    - 41 : hybrid multicolor symmetric Gauss-Seidel or SSOR
  **/
 HYPRE_Int HYPRE_BoomerAMGSetRelaxType(HYPRE_Solver  solver,
                                       HYPRE_Int     relax_type);
@@ -890,6 +917,18 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst (HYPRE_Solver solver,
                                            HYPRE_Int   eig_est);
 
+/**
+ * (Optional) Uses a communication-avoiding Chebyshev smoother on the
+ * \e cheby_ca finest levels. Instead of one halo exchange per matvec, a
+ * ghost layer as deep as the polynomial order is exchanged once per sweep
+ * and the matvecs are done locally, recomputing the ghost rows. This trades
+ * extra flops and setup work for fewer messages and pays off on the fine
+ * levels of large runs. Results are the same up to roundoff.
+ * The default is 0 (off). Host memory only.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetChebyCommAvoid (HYPRE_Solver solver,
+                                            HYPRE_Int    cheby_ca);
+
 /**
  * (Optional) Enables the use of more complex smoothers.
  * The following options exist for \e smooth_type:
@@ -1204,6 +1243,33 @@ HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose(HYPRE_Solver solver,
                                       HYPRE_Int    keepTranspose);
 
+/**
+ * (Optional) Stores the coarse grid operators of levels sp_level and
+ * coarser (level 0 is never converted) and the interpolation and restriction
+ * operators of levels sp_level and coarser in single precision, to reduce
+ * memory traffic in the solve phase. Products are still accumulated in
+ * double precision. Only available on the host and for relaxation types 0,
+ * 3, 4, 6, 7, 8, 13, 14, 16 and 18; levels using other relaxation types
+ * keep their operators in double precision. The default is -1 (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSinglePrecisionLevel(HYPRE_Solver solver,
+                                                 HYPRE_Int    sp_level);
+
+/**
+ * (Optional) If set to 1, a setup with a matrix that has the same sparsity
+ * pattern as the one of the previous setup only recomputes the numeric
+ * values of the hierarchy: the C/F splittings and the interpolation and
+ * restriction operators are kept, and the coarse grid operators and the
+ * smoother data are recomputed from the new matrix. The pattern is checked
+ * through the local sizes and a checksum of the local row pointers and
+ * column indices; a different pattern triggers a full setup. Options that
+ * cannot be reused (block, additive, non-Galerkin, complex smoothers,
+ * redundant coarse solves, interpolation vectors and single precision
+ * levels) fall back to a full setup. The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetReuseHierarchy(HYPRE_Solver solver,
+                                           HYPRE_Int    reuse_hierarchy);
+
 /**
  * HYPRE_BoomerAMGSetPlotGrids
  **/
@@ -2499,6 +2565,118 @@ HYPRE_Int HYPRE_ParCSROnProcTriSolve(HYPRE_Solver       solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR Block PCG Solver
+ *
+ * Block conjugate gradient for several right-hand sides with the same SPD
+ * matrix.  The right-hand sides and solutions are passed as column-wise
+ * ParVectors holding k vectors each (as created by hypre_ParMultiVectorCreate);
+ * all k systems share one Krylov space, so each iteration performs one
+ * multivector matvec and a few small dense reductions instead of k of each.
+ * Search directions that become numerically dependent are dropped, so the
+ * method does not break down when the right-hand sides or residuals are
+ * (nearly) linearly dependent.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGCreate(MPI_Comm      comm,
+                                     HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGDestroy(HYPRE_Solver solver);
+
+/**
+ * Set up the solver (and the preconditioner) for right-hand sides of the
+ * width of \e b.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetup(HYPRE_Solver       solver,
+                                    HYPRE_ParCSRMatrix A,
+                                    HYPRE_ParVector    b,
+                                    HYPRE_ParVector    x);
+
+/**
+ * Solve A X = B for all columns of the multivectors \e b and \e x.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSolve(HYPRE_Solver       solver,
+                                    HYPRE_ParCSRMatrix A,
+                                    HYPRE_ParVector    b,
+                                    HYPRE_ParVector    x);
+
+/**
+ * (Optional) Set the relative convergence tolerance.  Every column must
+ * satisfy ||r_j||_2 <= max(tol ||b_j||_2, a_tol).  The default is 1e-6.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetTol(HYPRE_Solver solver,
+                                     HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the absolute convergence tolerance (default is 0).
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetAbsoluteTol(HYPRE_Solver solver,
+                                             HYPRE_Real   a_tol);
+
+/**
+ * (Optional) Set the tolerance below which a search direction is treated
+ * as linearly dependent on the others and dropped.  It is compared with the
+ * squared sine of the angle between a direction and the span of those
+ * already kept.  The default is 1e-10.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetRankTol(HYPRE_Solver solver,
+                                         HYPRE_Real   rank_tol);
+
+/**
+ * (Optional) Set the maximum number of iterations (default is 1000).
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetMaxIter(HYPRE_Solver solver,
+                                         HYPRE_Int    max_iter);
+
+/**
+ * (Optional) Set the preconditioner.  Unless
+ * \ref HYPRE_ParCSRBlockPCGSetPrecondMultivec is set, the preconditioner is
+ * applied to one column at a time.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrecond(HYPRE_Solver            solver,
+                                         HYPRE_PtrToParSolverFcn precond,
+                                         HYPRE_PtrToParSolverFcn precond_setup,
+                                         HYPRE_Solver            precond_solver);
+
+/**
+ * (Optional) Indicate that the preconditioner accepts multivectors, so it is
+ * applied once to all columns.  The default is 0.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrecondMultivec(HYPRE_Solver solver,
+                                                 HYPRE_Int    precond_multivec);
+
+/**
+ * (Optional) Set the print level.  A value larger than 1 prints the largest
+ * relative residual norm and the block size at each iteration.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrintLevel(HYPRE_Solver solver,
+                                            HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRBlockPCGSetLogging(HYPRE_Solver solver,
+                                         HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRBlockPCGGetNumIterations(HYPRE_Solver  solver,
+                                               HYPRE_Int    *num_iterations);
+
+/**
+ * Return the largest relative residual norm over all columns.
+ **/
+HYPRE_Int HYPRE_ParCSRBlockPCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                           HYPRE_Real   *norm);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -2614,6 +2792,9 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS(HYPRE_Solver solver,
                                    HYPRE_Int    cgs);
 
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep(HYPRE_Solver solver,
+                                    HYPRE_Int    s_step);
+
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol(HYPRE_Solver solver,
                                   HYPRE_Real   tol);
 
@@ -2740,6 +2921,91 @@ HYPRE_Int HYPRE_ParCSRFlexGMRESSetModifyPC( HYPRE_Solver           solver,
 
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR GCRODR Solver
+ *
+ * These routines should be used in conjunction with the generic interface in
+ * \ref KrylovSolvers.  The recycled subspace is kept between calls to Solve,
+ * so a sequence of related systems can reuse one solver object.
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRGCRODRCreate(MPI_Comm      comm,
+                                   HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRGCRODRDestroy(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSetup(HYPRE_Solver       solver,
+                                  HYPRE_ParCSRMatrix A,
+                                  HYPRE_ParVector    b,
+                                  HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSolve(HYPRE_Solver       solver,
+                                  HYPRE_ParCSRMatrix A,
+                                  HYPRE_ParVector    b,
+                                  HYPRE_ParVector    x);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSetKDim(HYPRE_Solver solver,
+                                    HYPRE_Int    k_dim);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSetRecycleDim(HYPRE_Solver solver,
+                                          HYPRE_Int    recycle_dim);
+
+HYPRE_Int HYPRE_ParCSRGCRODRGetNumRecycled(HYPRE_Solver  solver,
+                                           HYPRE_Int    *num_recycled);
+
+HYPRE_Int HYPRE_ParCSRGCRODRClearRecycled(HYPRE_Solver solver);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSetTol(HYPRE_Solver solver,
+                                   HYPRE_Real   tol);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSetAbsoluteTol(HYPRE_Solver solver,
+                                           HYPRE_Real   a_tol);
+
+/*
+ * RE-VISIT
+ **/
+HYPRE_Int HYPRE_ParCSRGCRODRSetMinIter(HYPRE_Solver solver,
+                                       HYPRE_Int    min_iter);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSetMaxIter(HYPRE_Solver solver,
+                                       HYPRE_Int    max_iter);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSetPrecond(HYPRE_Solver             solver,
+                                       HYPRE_PtrToParSolverFcn  precond,
+                                       HYPRE_PtrToParSolverFcn  precond_setup,
+                                       HYPRE_Solver             precond_solver);
+
+HYPRE_Int HYPRE_ParCSRGCRODRGetPrecond(HYPRE_Solver  solver,
+                                       HYPRE_Solver *precond_data);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSetLogging(HYPRE_Solver solver,
+                                       HYPRE_Int    logging);
+
+HYPRE_Int HYPRE_ParCSRGCRODRSetPrintLevel(HYPRE_Solver solver,
+                                          HYPRE_Int    print_level);
+
+HYPRE_Int HYPRE_ParCSRGCRODRGetNumIterations(HYPRE_Solver  solver,
+                                             HYPRE_Int    *num_iterations);
+
+HYPRE_Int HYPRE_ParCSRGCRODRGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                         HYPRE_Real   *norm);
+
+HYPRE_Int HYPRE_ParCSRGCRODRGetResidual(HYPRE_Solver     solver,
+                                        HYPRE_ParVector *residual);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -4134,6 +4400,7 @@ HYPRE_ILUSetSchurMaxIter( HYPRE_Solver solver, HYPRE_Int ss_max_iter );
  * Options for \e ilu_type are:
  *    - 0 : BJ with ILU(k) (default, with k = 0)
  *    - 1 : BJ with ILUT
+ *    - 2 : BJ with iterative ILU(k), see HYPRE_ILUSetIterativeSetupMaxIter
  *    - 10 : GMRES with ILU(k)
  *    - 11 : GMRES with ILUT
  *    - 20 : NSH with ILU(k)
@@ -4157,6 +4424,55 @@ HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type );
 HYPRE_Int
 HYPRE_ILUSetLocalReordering( HYPRE_Solver solver, HYPRE_Int reordering_type );
 
+/**
+ * (Optional) Set the type of triangular solves with the L and U factors on
+ * the host. Applies to the block Jacobi variants (\e ilu_type 0, 1 and 2).
+ *
+ * Options for \e tri_solve are:
+ *    - 0 : sequential substitution (default)
+ *    - 1 : substitution by level sets of L and U, computed in the setup,
+ *          with the rows of a level split over the OpenMP threads (same as
+ *          0 when running with a single thread)
+ *    - 2 : approximate solves by a fixed number of Jacobi iterations
+ *
+ * Options 0 and 1 give the same result.
+ **/
+HYPRE_Int
+HYPRE_ILUSetTriSolve( HYPRE_Solver solver, HYPRE_Int tri_solve );
+
+/**
+ * (Optional) Set the number of Jacobi iterations for the L solve when
+ * \e tri_solve is 2. The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetLowerJacobiIters( HYPRE_Solver solver, HYPRE_Int lower_jacobi_iters );
+
+/**
+ * (Optional) Set the number of Jacobi iterations for the U solve when
+ * \e tri_solve is 2. The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetUpperJacobiIters( HYPRE_Solver solver, HYPRE_Int upper_jacobi_iters );
+
+/**
+ * (Optional) Set the max number of sweeps of the iterative ILU(k)
+ * factorization (\e ilu_type 2). Each sweep updates all the entries of the
+ * L and U factors, with the rows split over the OpenMP threads, from the
+ * fixed-point equations of Chow and Patel. The pattern is that of ILU(k).
+ * The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetIterativeSetupMaxIter( HYPRE_Solver solver, HYPRE_Int iter_setup_max_iter );
+
+/**
+ * (Optional) Set the stop tolerance of the iterative ILU(k) factorization
+ * (\e ilu_type 2). The sweeps stop when the norm of A - LU on the pattern of
+ * the factors, relative to the norm of A, drops below \e iter_setup_tol.
+ * The default is 0, which always does the max number of sweeps.
+ **/
+HYPRE_Int
+HYPRE_ILUSetIterativeSetupTolerance( HYPRE_Solver solver, HYPRE_Real iter_setup_tol );
+
 /**
  * (Optional) Set the print level to print setup and solve information.
  *
@@ -97,6 +97,7 @@ typedef struct
    HYPRE_Real    *relax_weight;
    HYPRE_Real    *omega;
    HYPRE_Int      converge_type;
+   HYPRE_Int      lagged_conv_check;
    HYPRE_Real     tol;
    HYPRE_Int      partial_cycle_coarsest_level;
    HYPRE_Int      partial_cycle_control;
@@ -171,6 +172,13 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    HYPRE_Real         **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_ca;
+   void               **cheby_ca_data;
+
+   /* multicolor Gauss-Seidel (relax types 40, 41) */
+   HYPRE_Int           *num_colors;
+   HYPRE_Int          **color_ptr;
+   HYPRE_Int          **color_order;
 
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
@@ -186,6 +194,15 @@ typedef struct
    hypre_ParVector   *Rtemp;
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
+   /* per-thread partial sums of hypre_ParCSRMatrixResidualRestrict */
+   HYPRE_Complex     *restrict_work;
+   HYPRE_Int          restrict_work_size;
+
+   /* row-wise multivector hierarchy for multiple right-hand sides */
+   HYPRE_Int          num_vectors_mv;
+   hypre_ParVector  **F_array_mv;
+   hypre_ParVector  **U_array_mv;
+   hypre_ParVector   *Vtemp_mv;
 
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
@@ -244,6 +261,7 @@ typedef struct
    HYPRE_Int      mult_additive;
    HYPRE_Int      simple;
    HYPRE_Int      add_last_lvl;
+   HYPRE_Int      add_async;
    HYPRE_Int      add_P_max_elmts;
    HYPRE_Real     add_trunc_factor;
    HYPRE_Int      add_rlx_type;
@@ -259,6 +277,24 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* levels from which A, P and R are stored in single precision (-1: none) */
+   HYPRE_Int single_precision_level;
+
+   /* numeric-only re-setup: keep CF splittings, P and R when the sparsity
+      of A is unchanged; reuse_A_info holds the local sizes of A (rows, diag
+      and offd nonzeros, offd columns) at the last full setup, and
+      reuse_A_checksum the checksum of its local sparsity pattern */
+   HYPRE_Int          reuse_hierarchy;
+   HYPRE_Int          reuse_A_info[4];
+   hypre_ulonglongint reuse_A_checksum;
+   /* products kept between numeric-only re-setups: A*P and R*(A*P) with
+      their hypre_ParMatmul plans, and P^T when R is not stored */
+   HYPRE_Int             reuse_num_levels;
+   hypre_ParMatmulPlan **reuse_AP_plans;
+   hypre_ParMatmulPlan **reuse_RAP_plans;
+   hypre_ParCSRMatrix  **reuse_AP_array;
+   hypre_ParCSRMatrix  **reuse_PT_array;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -335,6 +371,7 @@ typedef struct
 #define hypre_ParAMGDataFCycle(amg_data) ((amg_data)->fcycle)
 #define hypre_ParAMGDataCycleType(amg_data) ((amg_data)->cycle_type)
 #define hypre_ParAMGDataConvergeType(amg_data) ((amg_data)->converge_type)
+#define hypre_ParAMGDataLaggedConvCheck(amg_data) ((amg_data)->lagged_conv_check)
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
 #define hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) ((amg_data)->partial_cycle_coarsest_level)
 #define hypre_ParAMGDataPartialCycleControl(amg_data) ((amg_data)->partial_cycle_control)
@@ -413,6 +450,12 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyCommAvoid(amg_data) ((amg_data)->cheby_ca)
+#define hypre_ParAMGDataChebyCAData(amg_data) ((amg_data)->cheby_ca_data)
+
+#define hypre_ParAMGDataNumColors(amg_data) ((amg_data)->num_colors)
+#define hypre_ParAMGDataColorPtr(amg_data) ((amg_data)->color_ptr)
+#define hypre_ParAMGDataColorOrder(amg_data) ((amg_data)->color_order)
 
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
@@ -430,6 +473,12 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataRestrictWork(amg_data) ((amg_data)->restrict_work)
+#define hypre_ParAMGDataRestrictWorkSize(amg_data) ((amg_data)->restrict_work_size)
+#define hypre_ParAMGDataNumVectorsMV(amg_data) ((amg_data)->num_vectors_mv)
+#define hypre_ParAMGDataFArrayMV(amg_data) ((amg_data)->F_array_mv)
+#define hypre_ParAMGDataUArrayMV(amg_data) ((amg_data)->U_array_mv)
+#define hypre_ParAMGDataVtempMV(amg_data) ((amg_data)->Vtemp_mv)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -489,6 +538,7 @@ typedef struct
 #define hypre_ParAMGDataMultAdditive(amg_data) ((amg_data)->mult_additive)
 #define hypre_ParAMGDataSimple(amg_data) ((amg_data)->simple)
 #define hypre_ParAMGDataAddLastLvl(amg_data) ((amg_data)->add_last_lvl)
+#define hypre_ParAMGDataAddAsync(amg_data) ((amg_data)->add_async)
 #define hypre_ParAMGDataMultAddPMaxElmts(amg_data) ((amg_data)->add_P_max_elmts)
 #define hypre_ParAMGDataMultAddTruncFactor(amg_data) ((amg_data)->add_trunc_factor)
 #define hypre_ParAMGDataAddRelaxType(amg_data) ((amg_data)->add_rlx_type)
@@ -508,6 +558,15 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataSinglePrecisionLevel(amg_data) ((amg_data)->single_precision_level)
+#define hypre_ParAMGDataReuseHierarchy(amg_data) ((amg_data)->reuse_hierarchy)
+#define hypre_ParAMGDataReuseAInfo(amg_data) ((amg_data)->reuse_A_info)
+#define hypre_ParAMGDataReuseAChecksum(amg_data) ((amg_data)->reuse_A_checksum)
+#define hypre_ParAMGDataReuseNumLevels(amg_data) ((amg_data)->reuse_num_levels)
+#define hypre_ParAMGDataReuseAPPlans(amg_data) ((amg_data)->reuse_AP_plans)
+#define hypre_ParAMGDataReuseRAPPlans(amg_data) ((amg_data)->reuse_RAP_plans)
+#define hypre_ParAMGDataReuseAPArray(amg_data) ((amg_data)->reuse_AP_array)
+#define hypre_ParAMGDataReusePTArray(amg_data) ((amg_data)->reuse_PT_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
@@ -1108,6 +1167,8 @@ HYPRE_Int HYPRE_BoomerAMGSetCycleType ( HYPRE_Solver solver , HYPRE_Int cycle_ty
 HYPRE_Int HYPRE_BoomerAMGGetCycleType ( HYPRE_Solver solver , HYPRE_Int *cycle_type );
 HYPRE_Int HYPRE_BoomerAMGSetConvergeType ( HYPRE_Solver solver , HYPRE_Int type );
 HYPRE_Int HYPRE_BoomerAMGGetConvergeType ( HYPRE_Solver solver , HYPRE_Int *type );
+HYPRE_Int HYPRE_BoomerAMGSetLaggedConvCheck ( HYPRE_Solver solver , HYPRE_Int lagged );
+HYPRE_Int HYPRE_BoomerAMGGetLaggedConvCheck ( HYPRE_Solver solver , HYPRE_Int *lagged );
 HYPRE_Int HYPRE_BoomerAMGSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_BoomerAMGGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
 HYPRE_Int HYPRE_BoomerAMGSetNumGridSweeps ( HYPRE_Solver solver , HYPRE_Int *num_grid_sweeps );
@@ -1209,6 +1270,7 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver , HYPRE_Real rat
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver , HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver , HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver , HYPRE_Int scale );
+HYPRE_Int HYPRE_BoomerAMGSetChebyCommAvoid ( HYPRE_Solver solver , HYPRE_Int cheby_ca );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver , HYPRE_Int num_vectors , HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver , HYPRE_Int num );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecQMax ( HYPRE_Solver solver , HYPRE_Int q_max );
@@ -1223,12 +1285,15 @@ HYPRE_Int HYPRE_BoomerAMGGetMultAdditive ( HYPRE_Solver solver , HYPRE_Int *mult
 HYPRE_Int HYPRE_BoomerAMGSetSimple ( HYPRE_Solver solver , HYPRE_Int simple );
 HYPRE_Int HYPRE_BoomerAMGGetSimple ( HYPRE_Solver solver , HYPRE_Int *simple );
 HYPRE_Int HYPRE_BoomerAMGSetAddLastLvl ( HYPRE_Solver solver , HYPRE_Int add_last_lvl );
+HYPRE_Int HYPRE_BoomerAMGSetAddAsync ( HYPRE_Solver solver , HYPRE_Int add_async );
 HYPRE_Int HYPRE_BoomerAMGSetNonGalerkinTol ( HYPRE_Solver solver , HYPRE_Real nongalerkin_tol );
 HYPRE_Int HYPRE_BoomerAMGSetLevelNonGalerkinTol ( HYPRE_Solver solver , HYPRE_Real nongalerkin_tol , HYPRE_Int level );
 HYPRE_Int HYPRE_BoomerAMGSetNonGalerkTol ( HYPRE_Solver solver , HYPRE_Int nongalerk_num_tol , HYPRE_Real *nongalerk_tol );
 HYPRE_Int HYPRE_BoomerAMGSetRAP2 ( HYPRE_Solver solver , HYPRE_Int rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetModuleRAP2 ( HYPRE_Solver solver , HYPRE_Int mod_rap2 );
 HYPRE_Int HYPRE_BoomerAMGSetKeepTranspose ( HYPRE_Solver solver , HYPRE_Int keepTranspose );
+HYPRE_Int HYPRE_BoomerAMGSetSinglePrecisionLevel ( HYPRE_Solver solver , HYPRE_Int sp_level );
+HYPRE_Int HYPRE_BoomerAMGSetReuseHierarchy ( HYPRE_Solver solver , HYPRE_Int reuse_hierarchy );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int HYPRE_BoomerAMGSetDSLUThreshold ( HYPRE_Solver solver , HYPRE_Int slu_threshold );
 #endif
@@ -1288,6 +1353,22 @@ HYPRE_Int HYPRE_BlockTridiagSetAMGNumSweeps ( HYPRE_Solver solver , HYPRE_Int nu
 HYPRE_Int HYPRE_BlockTridiagSetAMGRelaxType ( HYPRE_Solver solver , HYPRE_Int relax_type );
 HYPRE_Int HYPRE_BlockTridiagSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
 
+/* HYPRE_parcsr_block_pcg.c */
+HYPRE_Int HYPRE_ParCSRBlockPCGCreate ( MPI_Comm comm , HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRBlockPCGDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRBlockPCGSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetRankTol ( HYPRE_Solver solver , HYPRE_Real rank_tol );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrecondMultivec ( HYPRE_Solver solver , HYPRE_Int precond_multivec );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
+HYPRE_Int HYPRE_ParCSRBlockPCGSetLogging ( HYPRE_Solver solver , HYPRE_Int logging );
+HYPRE_Int HYPRE_ParCSRBlockPCGGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_ParCSRBlockPCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+
 /* HYPRE_parcsr_cgnr.c */
 HYPRE_Int HYPRE_ParCSRCGNRCreate ( MPI_Comm comm , HYPRE_Solver *solver );
 HYPRE_Int HYPRE_ParCSRCGNRDestroy ( HYPRE_Solver solver );
@@ -1337,6 +1418,27 @@ HYPRE_Int HYPRE_ParCSRFlexGMRESGetFinalRelativeResidualNorm ( HYPRE_Solver solve
 HYPRE_Int HYPRE_ParCSRFlexGMRESGetResidual ( HYPRE_Solver solver , HYPRE_ParVector *residual );
 HYPRE_Int HYPRE_ParCSRFlexGMRESSetModifyPC ( HYPRE_Solver solver , HYPRE_PtrToModifyPCFcn modify_pc );
 
+/* HYPRE_parcsr_gcrodr.c */
+HYPRE_Int HYPRE_ParCSRGCRODRCreate ( MPI_Comm comm , HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRGCRODRDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRGCRODRSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRGCRODRSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRGCRODRSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
+HYPRE_Int HYPRE_ParCSRGCRODRSetRecycleDim ( HYPRE_Solver solver , HYPRE_Int recycle_dim );
+HYPRE_Int HYPRE_ParCSRGCRODRGetNumRecycled ( HYPRE_Solver solver , HYPRE_Int *num_recycled );
+HYPRE_Int HYPRE_ParCSRGCRODRClearRecycled ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRGCRODRSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
+HYPRE_Int HYPRE_ParCSRGCRODRSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
+HYPRE_Int HYPRE_ParCSRGCRODRSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
+HYPRE_Int HYPRE_ParCSRGCRODRSetMaxIter ( HYPRE_Solver solver , HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRGCRODRSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_solver );
+HYPRE_Int HYPRE_ParCSRGCRODRGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
+HYPRE_Int HYPRE_ParCSRGCRODRSetLogging ( HYPRE_Solver solver , HYPRE_Int logging );
+HYPRE_Int HYPRE_ParCSRGCRODRSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
+HYPRE_Int HYPRE_ParCSRGCRODRGetNumIterations ( HYPRE_Solver solver , HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_ParCSRGCRODRGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
+HYPRE_Int HYPRE_ParCSRGCRODRGetResidual ( HYPRE_Solver solver , HYPRE_ParVector *residual );
+
 /* HYPRE_parcsr_gmres.c */
 HYPRE_Int HYPRE_ParCSRGMRESCreate ( MPI_Comm comm , HYPRE_Solver *solver );
 HYPRE_Int HYPRE_ParCSRGMRESDestroy ( HYPRE_Solver solver );
@@ -1607,6 +1709,8 @@ HYPRE_Int hypre_BoomerAMGSetCycleType ( void *data , HYPRE_Int cycle_type );
 HYPRE_Int hypre_BoomerAMGGetCycleType ( void *data , HYPRE_Int *cycle_type );
 HYPRE_Int hypre_BoomerAMGSetConvergeType ( void *data , HYPRE_Int type );
 HYPRE_Int hypre_BoomerAMGGetConvergeType ( void *data , HYPRE_Int *type );
+HYPRE_Int hypre_BoomerAMGSetLaggedConvCheck ( void *data , HYPRE_Int lagged );
+HYPRE_Int hypre_BoomerAMGGetLaggedConvCheck ( void *data , HYPRE_Int *lagged );
 HYPRE_Int hypre_BoomerAMGSetTol ( void *data , HYPRE_Real tol );
 HYPRE_Int hypre_BoomerAMGGetTol ( void *data , HYPRE_Real *tol );
 HYPRE_Int hypre_BoomerAMGSetNumSweeps ( void *data , HYPRE_Int num_sweeps );
@@ -1718,6 +1822,7 @@ HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data , HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data , HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data , HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data , HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetChebyCommAvoid ( void *data , HYPRE_Int cheby_ca );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver , HYPRE_Int num_vectors , hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver , HYPRE_Int var );
 HYPRE_Int hypre_BoomerAMGSetInterpVecQMax ( void *data , HYPRE_Int q_max );
@@ -1732,29 +1837,56 @@ HYPRE_Int hypre_BoomerAMGGetMultAdditive ( void *data , HYPRE_Int *mult_additive
 HYPRE_Int hypre_BoomerAMGSetSimple ( void *data , HYPRE_Int simple );
 HYPRE_Int hypre_BoomerAMGGetSimple ( void *data , HYPRE_Int *simple );
 HYPRE_Int hypre_BoomerAMGSetAddLastLvl ( void *data , HYPRE_Int add_last_lvl );
+HYPRE_Int hypre_BoomerAMGSetAddAsync ( void *data , HYPRE_Int add_async );
 HYPRE_Int hypre_BoomerAMGSetNonGalerkinTol ( void *data , HYPRE_Real nongalerkin_tol );
 HYPRE_Int hypre_BoomerAMGSetLevelNonGalerkinTol ( void *data , HYPRE_Real nongalerkin_tol , HYPRE_Int level );
 HYPRE_Int hypre_BoomerAMGSetNonGalerkTol ( void *data , HYPRE_Int nongalerk_num_tol , HYPRE_Real *nongalerk_tol );
 HYPRE_Int hypre_BoomerAMGSetRAP2 ( void *data , HYPRE_Int rap2 );
 HYPRE_Int hypre_BoomerAMGSetModuleRAP2 ( void *data , HYPRE_Int mod_rap2 );
 HYPRE_Int hypre_BoomerAMGSetKeepTranspose ( void *data , HYPRE_Int keepTranspose );
+HYPRE_Int hypre_BoomerAMGSetSinglePrecisionLevel ( void *data , HYPRE_Int sp_level );
+HYPRE_Int hypre_BoomerAMGSetReuseHierarchy ( void *data , HYPRE_Int reuse_hierarchy );
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int hypre_BoomerAMGSetDSLUThreshold ( void *data , HYPRE_Int slu_threshold );
 #endif
 HYPRE_Int hypre_BoomerAMGSetCPoints( void *data, HYPRE_Int cpt_coarse_level, HYPRE_Int  num_cpt_coarse, HYPRE_BigInt *cpt_coarse_index );
 HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int num_points, HYPRE_BigInt *indices );
 
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGReuseHierarchyRecord ( void *amg_vdata , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGReuseHierarchyCheck ( void *amg_vdata , hypre_ParCSRMatrix *A , HYPRE_Int *reuse );
+HYPRE_Int hypre_BoomerAMGReuseHierarchyFree ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGSetupNumeric ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGDestroyMultiVec ( hypre_ParAMGData *amg_data );
+HYPRE_Int hypre_BoomerAMGSolveMultiVec ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
 /* par_amg_solveT.c */
 HYPRE_Int hypre_BoomerAMGSolveT ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 HYPRE_Int hypre_BoomerAMGCycleT ( void *amg_vdata , hypre_ParVector **F_array , hypre_ParVector **U_array );
 HYPRE_Int hypre_BoomerAMGRelaxT ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , hypre_ParVector *u , hypre_ParVector *Vtemp );
 
+/* par_block_pcg.c */
+void *hypre_ParBlockPCGCreate ( void );
+HYPRE_Int hypre_ParBlockPCGDestroy ( void *block_pcg_vdata );
+HYPRE_Int hypre_ParBlockPCGSetup ( void *block_pcg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
+HYPRE_Int hypre_ParBlockPCGSolve ( void *block_pcg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
+HYPRE_Int hypre_ParBlockPCGSetTol ( void *block_pcg_vdata , HYPRE_Real tol );
+HYPRE_Int hypre_ParBlockPCGSetAbsoluteTol ( void *block_pcg_vdata , HYPRE_Real a_tol );
+HYPRE_Int hypre_ParBlockPCGSetRankTol ( void *block_pcg_vdata , HYPRE_Real rank_tol );
+HYPRE_Int hypre_ParBlockPCGSetMaxIter ( void *block_pcg_vdata , HYPRE_Int max_iter );
+HYPRE_Int hypre_ParBlockPCGSetPrecond ( void *block_pcg_vdata , HYPRE_PtrToParSolverFcn precond , HYPRE_PtrToParSolverFcn precond_setup , HYPRE_Solver precond_data );
+HYPRE_Int hypre_ParBlockPCGSetPrecondMultivec ( void *block_pcg_vdata , HYPRE_Int precond_multivec );
+HYPRE_Int hypre_ParBlockPCGSetPrintLevel ( void *block_pcg_vdata , HYPRE_Int print_level );
+HYPRE_Int hypre_ParBlockPCGSetLogging ( void *block_pcg_vdata , HYPRE_Int logging );
+HYPRE_Int hypre_ParBlockPCGGetNumIterations ( void *block_pcg_vdata , HYPRE_Int *num_iterations );
+HYPRE_Int hypre_ParBlockPCGGetFinalRelativeResidualNorm ( void *block_pcg_vdata , HYPRE_Real *relative_residual_norm );
+
 /* par_cgc_coarsen.c */
 HYPRE_Int hypre_BoomerAMGCoarsenCGCb ( hypre_ParCSRMatrix *S , hypre_ParCSRMatrix *A , HYPRE_Int measure_type , HYPRE_Int coarsen_type , HYPRE_Int cgc_its , HYPRE_Int debug_flag , HYPRE_Int **CF_marker_ptr );
 HYPRE_Int hypre_BoomerAMGCoarsenCGC ( hypre_ParCSRMatrix *S , HYPRE_Int numberofgrids , HYPRE_Int coarsen_type , HYPRE_Int *CF_marker );
@@ -1771,6 +1903,9 @@ HYPRE_Int hypre_Bisection ( HYPRE_Int n , HYPRE_Real *diag , HYPRE_Real *offd ,
 /* par_cheby.c */
 HYPRE_Int hypre_ParCSRRelax_Cheby_Setup ( hypre_ParCSRMatrix *A , HYPRE_Real max_eig , HYPRE_Real min_eig , HYPRE_Real fraction , HYPRE_Int order , HYPRE_Int scale , HYPRE_Int variant , HYPRE_Real **coefs_ptr , HYPRE_Real **ds_ptr );
 HYPRE_Int hypre_ParCSRRelax_Cheby_Solve ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Real *ds_data , HYPRE_Real *coefs , HYPRE_Int order , HYPRE_Int scale , HYPRE_Int variant , hypre_ParVector *u , hypre_ParVector *v , hypre_ParVector *r );
+HYPRE_Int hypre_ParCSRRelax_Cheby_CASetup ( hypre_ParCSRMatrix *A , HYPRE_Int order , HYPRE_Int scale , HYPRE_Real *ds_data , void **ca_data_ptr );
+HYPRE_Int hypre_ParCSRRelax_Cheby_CADestroy ( void *data );
+HYPRE_Int hypre_ParCSRRelax_Cheby_CASolve ( void *data , hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Real *coefs , HYPRE_Int order , HYPRE_Int scale , hypre_ParVector *u );
 
 /* par_coarsen.c */
 HYPRE_Int hypre_BoomerAMGCoarsen ( hypre_ParCSRMatrix *S , hypre_ParCSRMatrix *A , HYPRE_Int CF_init , HYPRE_Int debug_flag , HYPRE_Int **CF_marker_ptr );
@@ -1931,6 +2066,7 @@ HYPRE_Int hypre_GenerateSendMapAndCommPkg ( MPI_Comm comm , HYPRE_Int num_sends
 
 /* par_relax.c */
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxMultiVec ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
 HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data , HYPRE_Int level , HYPRE_Int relax_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data , HYPRE_Int level , HYPRE_Int relax_type );
 HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp, HYPRE_Int GS_order, HYPRE_Int Symm, HYPRE_Int Skip_diag, HYPRE_Int forced_seq, HYPRE_Int Topo_order );
@@ -1974,6 +2110,10 @@ HYPRE_Int hypre_BoomerAMGRelax11TwoStageGaussSeidel( hypre_ParCSRMatrix *A, hypr
 
 HYPRE_Int hypre_BoomerAMGRelax12TwoStageGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp );
 
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorSetup( hypre_ParCSRMatrix *A, HYPRE_Int *num_colors_ptr, HYPRE_Int **color_ptr_ptr, HYPRE_Int **color_order_ptr );
+
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorGaussSeidel( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Int num_colors, HYPRE_Int *color_ptr, HYPRE_Int *color_order, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp, HYPRE_Int Symm );
+
 /* par_realx_device.c */
 HYPRE_Int hypre_BoomerAMGRelaxHybridGaussSeidelDevice( hypre_ParCSRMatrix *A, hypre_ParVector *f, HYPRE_Int *cf_marker, HYPRE_Int relax_points, HYPRE_Real relax_weight, HYPRE_Real omega, HYPRE_Real *l1_norms, hypre_ParVector *u, hypre_ParVector *Vtemp, hypre_ParVector *Ztemp, HYPRE_Int GS_order, HYPRE_Int Symm );
 
@@ -2083,13 +2223,19 @@ HYPRE_Int hypre_ParKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void
 HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_ParKrylovInnerProdStart ( HYPRE_Int n , void **x , void **y , HYPRE_Real *local , HYPRE_Real *result , hypre_MPI_Request *request );
+HYPRE_Int hypre_ParKrylovInnerProdWait ( hypre_MPI_Request *request );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x , void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
+HYPRE_Int hypre_ParKrylovMassInnerProdMult ( void **x , HYPRE_Int nx , void **y , HYPRE_Int k , HYPRE_Int unroll , void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x , void *y , void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Int hypre_ParKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha , void *x );
 HYPRE_Int hypre_ParKrylovAxpy ( HYPRE_Complex alpha , void *x , void *y );
+HYPRE_Real hypre_ParKrylovAxpyInnerProd ( HYPRE_Complex alpha , void *x , void *y );
+HYPRE_Real hypre_ParKrylovAxpy2InnerProd ( HYPRE_Complex alpha , void *x , void *y , HYPRE_Complex beta , void *z , void *w );
+HYPRE_Int hypre_ParKrylovXpay ( HYPRE_Complex beta , void *x , void *y );
 HYPRE_Int hypre_ParKrylovCommInfo ( void *A , HYPRE_Int *my_id , HYPRE_Int *num_procs );
 HYPRE_Int hypre_ParKrylovIdentitySetup ( void *vdata , void *A , void *b , void *x );
 HYPRE_Int hypre_ParKrylovIdentity ( void *vdata , void *A , void *b , void *x );
@@ -2229,6 +2375,11 @@ HYPRE_Int hypre_ILUSolve( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVecto
 HYPRE_Int hypre_ILUSetPrintLevel( void *ilu_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type );
+HYPRE_Int hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve );
+HYPRE_Int hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters );
+HYPRE_Int hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters );
+HYPRE_Int hypre_ILUSetIterativeSetupMaxIter( void *ilu_vdata, HYPRE_Int iter_setup_max_iter );
+HYPRE_Int hypre_ILUSetIterativeSetupTolerance( void *ilu_vdata, HYPRE_Real iter_setup_tol );
 HYPRE_Int hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim );
 HYPRE_Int hypre_ILUSetSchurSolverMaxIter( void *ilu_vdata, HYPRE_Int ss_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverTol( void *ilu_vdata, HYPRE_Real ss_tol );
@@ -2269,12 +2420,17 @@ HYPRE_Int hypre_ILUSetupILU0(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_Int *
 HYPRE_Int hypre_ILUSetupMILU0(hypre_ParCSRMatrix *A, HYPRE_Int *permp, HYPRE_Int *qpermp, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end, HYPRE_Int modified);
 HYPRE_Int hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp, HYPRE_Int *qpermp, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUKSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU, HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int *S_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j, HYPRE_Int **S_diag_j, HYPRE_Int **u_end);
+HYPRE_Int hypre_ILUSetupILUKIter(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int max_iter, HYPRE_Real tol, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUT(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol, HYPRE_Int *permp, HYPRE_Int *qpermp, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILU0RAS(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILUKRASSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int *A_offd_i, HYPRE_Int *A_offd_j, HYPRE_Int *E_i, HYPRE_Int *E_j, HYPRE_Int ext, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU, HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j);
 HYPRE_Int hypre_ILUSetupILUKRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILUTRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
+HYPRE_Int hypre_ILUSetupLevelSets(hypre_CSRMatrix *T, HYPRE_Int n, HYPRE_Int upper, HYPRE_Int *num_levelsp, HYPRE_Int **level_ptrp, HYPRE_Int **level_rowsp);
+HYPRE_Int hypre_ILUDestroyLevelSets( void *ilu_vdata );
 HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *utemp, hypre_ParVector *ftemp);
+HYPRE_Int hypre_ILUSolveLULevels(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Int num_L_levels, HYPRE_Int *L_level_ptr, HYPRE_Int *L_level_rows, HYPRE_Int num_U_levels, HYPRE_Int *U_level_ptr, HYPRE_Int *U_level_rows);
+HYPRE_Int hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, hypre_ParVector *xtemp, HYPRE_Int lower_jacobi_iters, HYPRE_Int upper_jacobi_iters);
 HYPRE_Int hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, HYPRE_Solver schur_precond, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext);
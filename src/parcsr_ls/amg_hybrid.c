@@ -1880,9 +1880,12 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
                   hypre_ParKrylovMatvec,
                   hypre_ParKrylovMatvecDestroy,
-                  hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
+                  hypre_ParKrylovInnerProd,
+                  hypre_ParKrylovInnerProdStart, hypre_ParKrylovInnerProdWait,
+                  hypre_ParKrylovCopyVector,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
+                  hypre_ParKrylovAxpy2InnerProd, hypre_ParKrylovXpay,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
             pcg_solver = hypre_PCGCreate( pcg_functions );
 
@@ -1950,6 +1953,7 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
+                  hypre_ParKrylovAxpyInnerProd,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
             pcg_solver = hypre_GMRESCreate( gmres_functions );
 
@@ -2012,6 +2016,7 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
+                  hypre_ParKrylovAxpy2InnerProd, hypre_ParKrylovXpay,
                   hypre_ParKrylovCommInfo,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
             pcg_solver = hypre_BiCGSTABCreate( bicgstab_functions );
@@ -14,6 +14,220 @@
 #include "_hypre_parcsr_ls.h"
 #include "par_amg.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAdditiveCoarseSolve
+ *
+ * Relaxation on the coarsest grid when it is not part of the additive cycle.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGAdditiveCoarseSolve( hypre_ParAMGData *amg_data )
+{
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParVector    **F_array         = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector    **U_array         = hypre_ParAMGDataUArray(amg_data);
+   hypre_ParVector     *Vtemp           = hypre_ParAMGDataVtemp(amg_data);
+   hypre_ParVector     *Ztemp           = hypre_ParAMGDataZtemp(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Real          *relax_weight    = hypre_ParAMGDataRelaxWeight(amg_data);
+   HYPRE_Real          *omega           = hypre_ParAMGDataOmega(amg_data);
+   HYPRE_Int           *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Int            rlx_coarse      = hypre_ParAMGDataGridRelaxType(amg_data)[3];
+   HYPRE_Int            fine_grid       = hypre_ParAMGDataNumLevels(amg_data) - 1;
+   HYPRE_Int            j;
+
+   for (j=0; j < num_grid_sweeps[3]; j++)
+      if (rlx_coarse == 18)
+         hypre_ParCSRRelax(A_array[fine_grid], F_array[fine_grid],
+                           1, 1,
+                           l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
+                           1.0, 1.0 ,0,0,0,0,
+                           U_array[fine_grid], Vtemp, Ztemp);
+      else
+         hypre_BoomerAMGRelaxIF(A_array[fine_grid],F_array[fine_grid],
+                                NULL, rlx_coarse,0,0,
+                                relax_weight[fine_grid], omega[fine_grid],
+                                l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
+                                U_array[fine_grid], Vtemp, Ztemp);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAdditiveUpLevel
+ *
+ * Multiplicative up-cycle step: interpolate the correction of fine_grid+1
+ * and post-smooth on fine_grid.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGAdditiveUpLevel( hypre_ParAMGData *amg_data,
+                                HYPRE_Int         fine_grid )
+{
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParVector    **F_array         = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector    **U_array         = hypre_ParAMGDataUArray(amg_data);
+   hypre_ParVector     *Vtemp           = hypre_ParAMGDataVtemp(amg_data);
+   hypre_ParVector     *Ztemp           = hypre_ParAMGDataZtemp(amg_data);
+   HYPRE_Int          **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Real          *relax_weight    = hypre_ParAMGDataRelaxWeight(amg_data);
+   HYPRE_Real          *omega           = hypre_ParAMGDataOmega(amg_data);
+   HYPRE_Int           *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Int            rlx_up          = hypre_ParAMGDataGridRelaxType(amg_data)[2];
+   HYPRE_Int            rlx_order       = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Int            coarse_grid     = fine_grid + 1;
+   HYPRE_Int            i, j;
+
+   hypre_ParCSRMatrixMatvec(1.0, P_array[fine_grid],
+                               U_array[coarse_grid],
+                               1.0, U_array[fine_grid]);
+   if (rlx_up != 18)
+      /*hypre_BoomerAMGRelax(A_array[fine_grid],F_array[fine_grid],NULL,rlx_up,0,*/
+      for (j=0; j < num_grid_sweeps[2]; j++)
+        hypre_BoomerAMGRelaxIF(A_array[fine_grid],F_array[fine_grid],
+                               CF_marker_array[fine_grid],
+                               rlx_up,rlx_order,2,
+                               relax_weight[fine_grid], omega[fine_grid],
+                               l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
+                               U_array[fine_grid], Vtemp, Ztemp);
+   else if (rlx_order)
+   {
+      HYPRE_Int loc_relax_points[2];
+      loc_relax_points[0] = -1;
+      loc_relax_points[1] = 1;
+      for (j=0; j < num_grid_sweeps[2]; j++)
+      for (i=0; i < 2; i++)
+          hypre_ParCSRRelax_L1_Jacobi(A_array[fine_grid],F_array[fine_grid],
+                                      CF_marker_array[fine_grid],
+                                      loc_relax_points[i],
+                                      1.0,
+                                      l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
+                                      U_array[fine_grid], Vtemp);
+   }
+   else
+      for (j=0; j < num_grid_sweeps[2]; j++)
+      hypre_ParCSRRelax(A_array[fine_grid], F_array[fine_grid],
+                        1, 1,
+                        l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
+                        1.0, 1.0 ,0,0,0,0,
+                        U_array[fine_grid], Vtemp, Ztemp);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAdditiveCycleAsync
+ *
+ * Asynchronous version of the additive correction when the coarse levels
+ * (> add_end) are cycled multiplicatively. The additive correction
+ * x~ += Lambda r~ (or D_inv r~ for the simple cycle) of levels addlvl..add_end
+ * does not depend on the coarse levels, so the two run concurrently: the
+ * halo exchange of r~ is started first, thread 0 then does the coarse solve
+ * and the multiplicative up-cycle down to level add_end+1, while the other
+ * threads compute the local part of the additive correction. Thread 0 joins
+ * them when it is done, so no thread is left idle during the coarse-level
+ * work. Only thread 0 calls MPI. Messages of the coarse levels are posted
+ * after those of Lambda on every rank, so they are matched in order.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGAdditiveCycleAsync( hypre_ParAMGData *amg_data,
+                                   HYPRE_Int         add_end )
+{
+   hypre_ParCSRMatrix     *Lambda     = hypre_ParAMGDataLambda(amg_data);
+   hypre_ParVector        *Xtilde     = hypre_ParAMGDataXtilde(amg_data);
+   hypre_ParVector        *Rtilde     = hypre_ParAMGDataRtilde(amg_data);
+   HYPRE_Real             *D_inv      = hypre_ParAMGDataDinv(amg_data);
+   HYPRE_Int               simple     = hypre_ParAMGDataSimple(amg_data);
+   HYPRE_Int               num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Real             *x_global   = hypre_VectorData(hypre_ParVectorLocalVector(Xtilde));
+   HYPRE_Real             *r_global   = hypre_VectorData(hypre_ParVectorLocalVector(Rtilde));
+   HYPRE_Int               n_global   = hypre_VectorSize(hypre_ParVectorLocalVector(Xtilde));
+
+   hypre_CSRMatrix        *L_diag = NULL, *L_offd = NULL;
+   HYPRE_Int              *L_diag_i = NULL, *L_diag_j = NULL;
+   HYPRE_Real             *L_diag_data = NULL;
+   hypre_ParCSRCommPkg    *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Real             *send_buf = NULL, *r_offd = NULL;
+   HYPRE_Int               num_sends, i, k, level;
+   HYPRE_Real              sum;
+
+   if (simple < 0)
+   {
+      L_diag      = hypre_ParCSRMatrixDiag(Lambda);
+      L_offd      = hypre_ParCSRMatrixOffd(Lambda);
+      L_diag_i    = hypre_CSRMatrixI(L_diag);
+      L_diag_j    = hypre_CSRMatrixJ(L_diag);
+      L_diag_data = hypre_CSRMatrixData(L_diag);
+      comm_pkg    = hypre_ParCSRMatrixCommPkg(Lambda);
+      num_sends   = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+      send_buf = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                               HYPRE_MEMORY_HOST);
+      r_offd   = hypre_CTAlloc(HYPRE_Real, hypre_CSRMatrixNumCols(L_offd), HYPRE_MEMORY_HOST);
+      for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends); i++)
+      {
+         send_buf[i] = r_global[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, send_buf, r_offd);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, k, level, sum)
+#endif
+   {
+      if (hypre_GetThreadNum() == 0)
+      {
+         hypre_BoomerAMGAdditiveCoarseSolve(amg_data);
+         for (level = num_levels - 1; level > add_end + 1; level--)
+         {
+            hypre_BoomerAMGAdditiveUpLevel(amg_data, level - 1);
+         }
+      }
+
+      /* thread 0 picks up the remaining rows once it is done */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for schedule(dynamic, 256)
+#endif
+      for (i = 0; i < n_global; i++)
+      {
+         if (simple > -1)
+         {
+            x_global[i] += D_inv[i] * r_global[i];
+         }
+         else
+         {
+            sum = 0.0;
+            for (k = L_diag_i[i]; k < L_diag_i[i+1]; k++)
+            {
+               sum += L_diag_data[k] * r_global[L_diag_j[k]];
+            }
+            x_global[i] += sum;
+         }
+      }
+   }
+
+   if (simple < 0)
+   {
+      HYPRE_Int  *L_offd_i    = hypre_CSRMatrixI(L_offd);
+      HYPRE_Int  *L_offd_j    = hypre_CSRMatrixJ(L_offd);
+      HYPRE_Real *L_offd_data = hypre_CSRMatrixData(L_offd);
+
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, k) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n_global; i++)
+      {
+         for (k = L_offd_i[i]; k < L_offd_i[i+1]; k++)
+         {
+            x_global[i] += L_offd_data[k] * r_offd[L_offd_j[k]];
+         }
+      }
+      hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(r_offd, HYPRE_MEMORY_HOST);
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGCycle
  *--------------------------------------------------------------------------*/
@@ -46,6 +260,7 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
    HYPRE_Int       i, j, num_rows;
    HYPRE_Int       n_global;
    HYPRE_Int       rlx_order;
+   HYPRE_Int       async, up_start;
 
  /* Local variables  */
    HYPRE_Int       Solve_err_flag = 0;
@@ -53,8 +268,6 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
    HYPRE_Int       coarse_grid;
    HYPRE_Int       fine_grid;
    HYPRE_Int       rlx_down;
-   HYPRE_Int       rlx_up;
-   HYPRE_Int       rlx_coarse;
    HYPRE_Int      *grid_relax_type;
    HYPRE_Int      *num_grid_sweeps;
    hypre_Vector  **l1_norms;
@@ -116,8 +329,6 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
 
    /* down cycle */
    rlx_down = grid_relax_type[1];
-   rlx_up = grid_relax_type[2];
-   rlx_coarse = grid_relax_type[3];
    for (level = 0; level < num_levels-1; level++)
    {
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
@@ -180,15 +391,13 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
             }
          }
 
-         alpha = -1.0;
-         beta = 1.0;
-         hypre_ParCSRMatrixMatvec(alpha, A_array[fine_grid], U_array[fine_grid],
-                                     beta, Vtemp);
-
-         alpha = 1.0;
-         beta = 0.0;
-         hypre_ParCSRMatrixMatvecT(alpha,R_array[fine_grid],Vtemp,
-                                      beta,F_array[coarse_grid]);
+         /* fused residual and restriction; Vtemp gets the residual of the
+            interior rows of A only */
+         hypre_ParCSRMatrixResidualRestrict(A_array[fine_grid], U_array[fine_grid],
+                                            F_array[fine_grid], R_array[fine_grid], 1,
+                                            Vtemp, F_array[coarse_grid],
+                                            &hypre_ParAMGDataRestrictWork(amg_data),
+                                            &hypre_ParAMGDataRestrictWorkSize(amg_data));
       }
       else /* additive version */
       {
@@ -209,18 +418,25 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
 
    /* additive smoothing and solve coarse grid */
    HYPRE_ANNOTATE_MGLEVEL_BEGIN(num_levels - 1);
+   up_start = num_levels - 1;
+   async = hypre_ParAMGDataAddAsync(amg_data) && addlvl < num_levels &&
+           add_end < num_levels - 1 &&
+           hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[0])) == HYPRE_EXEC_HOST;
    if (addlvl < num_levels)
    {
       if (simple > -1)
       {
-         x_global = hypre_VectorData(hypre_ParVectorLocalVector(Xtilde));
-         r_global = hypre_VectorData(hypre_ParVectorLocalVector(Rtilde));
-         n_global = hypre_VectorSize(hypre_ParVectorLocalVector(Xtilde));
+         if (!async)
+         {
+            x_global = hypre_VectorData(hypre_ParVectorLocalVector(Xtilde));
+            r_global = hypre_VectorData(hypre_ParVectorLocalVector(Rtilde));
+            n_global = hypre_VectorSize(hypre_ParVectorLocalVector(Xtilde));
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-         for (i=0; i < n_global; i++)
-            x_global[i] += D_inv[i]*r_global[i];
+            for (i=0; i < n_global; i++)
+               x_global[i] += D_inv[i]*r_global[i];
+         }
       }
       else
       {
@@ -237,31 +453,27 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
             hypre_ParCSRMatrixMatvec(-1.0, Atilde, Tmptilde, 1.0, Rtilde);
             hypre_ParVectorDestroy(Tmptilde);
          }
-         hypre_ParCSRMatrixMatvec(1.0, Lambda, Rtilde, 1.0, Xtilde);
+         if (!async)
+         {
+            hypre_ParCSRMatrixMatvec(1.0, Lambda, Rtilde, 1.0, Xtilde);
+         }
+      }
+      if (async)
+      {
+         /* additive correction overlapped with the coarse levels */
+         hypre_BoomerAMGAdditiveCycleAsync(amg_data, add_end);
+         up_start = add_end + 1;
       }
       if (addlvl == 0) hypre_ParVectorCopy(Xtilde, U_array[0]);
    }
-   if (add_end < num_levels -1)
+   if (add_end < num_levels -1 && !async)
    {
-      fine_grid = num_levels -1;
-      for (j=0; j < num_grid_sweeps[3]; j++)
-         if (rlx_coarse == 18)
-            hypre_ParCSRRelax(A_array[fine_grid], F_array[fine_grid],
-                              1, 1,
-                              l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
-                              1.0, 1.0 ,0,0,0,0,
-                              U_array[fine_grid], Vtemp, Ztemp);
-         else
-            hypre_BoomerAMGRelaxIF(A_array[fine_grid],F_array[fine_grid],
-                                   NULL, rlx_coarse,0,0,
-                                   relax_weight[fine_grid], omega[fine_grid],
-                                   l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
-                                   U_array[fine_grid], Vtemp, Ztemp);
+      hypre_BoomerAMGAdditiveCoarseSolve(amg_data);
    }
    HYPRE_ANNOTATE_MGLEVEL_END(num_levels - 1);
 
    /* up cycle */
-   for (level = num_levels-1; level > 0; level--)
+   for (level = up_start; level > 0; level--)
    {
       HYPRE_ANNOTATE_MGLEVEL_BEGIN(level);
 
@@ -270,41 +482,7 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
 
       if (level <= addlvl || level > add_end+1) /* multiplicative version */
       {
-         alpha = 1.0;
-         beta = 1.0;
-         hypre_ParCSRMatrixMatvec(alpha, P_array[fine_grid],
-                                     U_array[coarse_grid],
-                                     beta, U_array[fine_grid]);
-         if (rlx_up != 18)
-            /*hypre_BoomerAMGRelax(A_array[fine_grid],F_array[fine_grid],NULL,rlx_up,0,*/
-            for (j=0; j < num_grid_sweeps[2]; j++)
-              hypre_BoomerAMGRelaxIF(A_array[fine_grid],F_array[fine_grid],
-                                     CF_marker_array[fine_grid],
-                                     rlx_up,rlx_order,2,
-                                     relax_weight[fine_grid], omega[fine_grid],
-                                     l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
-                                     U_array[fine_grid], Vtemp, Ztemp);
-         else if (rlx_order)
-         {
-            HYPRE_Int loc_relax_points[2];
-            loc_relax_points[0] = -1;
-            loc_relax_points[1] = 1;
-            for (j=0; j < num_grid_sweeps[2]; j++)
-            for (i=0; i < 2; i++)
-                hypre_ParCSRRelax_L1_Jacobi(A_array[fine_grid],F_array[fine_grid],
-                                            CF_marker_array[fine_grid],
-                                            loc_relax_points[i],
-                                            1.0,
-                                            l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
-                                            U_array[fine_grid], Vtemp);
-         }
-         else
-            for (j=0; j < num_grid_sweeps[2]; j++)
-            hypre_ParCSRRelax(A_array[fine_grid], F_array[fine_grid],
-                              1, 1,
-                              l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
-                              1.0, 1.0 ,0,0,0,0,
-                              U_array[fine_grid], Vtemp, Ztemp);
+         hypre_BoomerAMGAdditiveUpLevel(amg_data, fine_grid);
       }
       else /* additive version */
       {
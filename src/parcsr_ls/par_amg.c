@@ -76,6 +76,7 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    cycle_type;
 
    HYPRE_Int    converge_type;
+   HYPRE_Int    lagged_conv_check;
    HYPRE_Real   tol;
 
    HYPRE_Int    num_sweeps;
@@ -110,6 +111,7 @@ hypre_BoomerAMGCreate()
    HYPRE_Int cheby_eig_est;
    HYPRE_Int cheby_variant;
    HYPRE_Int cheby_scale;
+   HYPRE_Int cheby_ca;
    HYPRE_Real cheby_eig_ratio;
 
    HYPRE_Int block_mode;
@@ -214,6 +216,7 @@ hypre_BoomerAMGCreate()
    fcycle = 0;
    cycle_type = 1;
    converge_type = 0;
+   lagged_conv_check = 0;
    tol = 1.0e-6;
 
    num_sweeps = 1;
@@ -227,6 +230,7 @@ hypre_BoomerAMGCreate()
    cheby_order = 2;
    cheby_variant = 0;
    cheby_scale = 1;
+   cheby_ca = 0;
    cheby_eig_est = 10;
    cheby_eig_ratio = .3;
 
@@ -349,6 +353,7 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetCycleType(amg_data, cycle_type);
    hypre_BoomerAMGSetFCycle(amg_data, fcycle);
    hypre_BoomerAMGSetConvergeType(amg_data, converge_type);
+   hypre_BoomerAMGSetLaggedConvCheck(amg_data, lagged_conv_check);
    hypre_BoomerAMGSetTol(amg_data, tol);
    hypre_BoomerAMGSetNumSweeps(amg_data, num_sweeps);
    hypre_BoomerAMGSetCycleRelaxType(amg_data, relax_down, 1);
@@ -366,6 +371,7 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetChebyEigEst(amg_data, cheby_eig_est);
    hypre_BoomerAMGSetChebyVariant(amg_data, cheby_variant);
    hypre_BoomerAMGSetChebyScale(amg_data, cheby_scale);
+   hypre_BoomerAMGSetChebyCommAvoid(amg_data, cheby_ca);
 
    hypre_BoomerAMGSetNumIterations(amg_data, num_iterations);
 
@@ -377,6 +383,7 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetAddRelaxType(amg_data, add_rlx_type);
    hypre_BoomerAMGSetAddRelaxWt(amg_data, add_rlx_wt);
    hypre_ParAMGDataAddLastLvl(amg_data) = add_last_lvl;
+   hypre_ParAMGDataAddAsync(amg_data) = 0;
    hypre_ParAMGDataLambda(amg_data) = NULL;
    hypre_ParAMGDataXtilde(amg_data) = NULL;
    hypre_ParAMGDataRtilde(amg_data) = NULL;
@@ -404,6 +411,12 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRtemp(amg_data)  = NULL;
    hypre_ParAMGDataPtemp(amg_data)  = NULL;
    hypre_ParAMGDataZtemp(amg_data)  = NULL;
+   hypre_ParAMGDataRestrictWork(amg_data) = NULL;
+   hypre_ParAMGDataRestrictWorkSize(amg_data) = 0;
+   hypre_ParAMGDataNumVectorsMV(amg_data) = 0;
+   hypre_ParAMGDataFArrayMV(amg_data) = NULL;
+   hypre_ParAMGDataUArrayMV(amg_data) = NULL;
+   hypre_ParAMGDataVtempMV(amg_data)  = NULL;
    hypre_ParAMGDataFArray(amg_data) = NULL;
    hypre_ParAMGDataUArray(amg_data) = NULL;
    hypre_ParAMGDataDofFunc(amg_data) = NULL;
@@ -426,6 +439,12 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataMinEigEst(amg_data) = NULL;
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
+   hypre_ParAMGDataChebyCAData(amg_data) = NULL;
+
+   /* Stuff for multicolor Gauss-Seidel */
+   hypre_ParAMGDataNumColors(amg_data) = NULL;
+   hypre_ParAMGDataColorPtr(amg_data) = NULL;
+   hypre_ParAMGDataColorOrder(amg_data) = NULL;
 
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
@@ -470,6 +489,14 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRAP2(amg_data)              = rap2;
    hypre_ParAMGDataKeepTranspose(amg_data)     = keepT;
    hypre_ParAMGDataModularizedMatMat(amg_data) = modu_rap;
+   hypre_ParAMGDataSinglePrecisionLevel(amg_data) = -1;
+   hypre_ParAMGDataReuseHierarchy(amg_data)    = 0;
+   hypre_ParAMGDataReuseAInfo(amg_data)[0]     = -1;
+   hypre_ParAMGDataReuseNumLevels(amg_data)    = 0;
+   hypre_ParAMGDataReuseAPPlans(amg_data)      = NULL;
+   hypre_ParAMGDataReuseRAPPlans(amg_data)     = NULL;
+   hypre_ParAMGDataReuseAPArray(amg_data)      = NULL;
+   hypre_ParAMGDataReusePTArray(amg_data)      = NULL;
 
    /* information for preserving indices as coarse grid points */
    hypre_ParAMGDataCPointsMarker(amg_data)      = NULL;
@@ -658,6 +685,27 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataChebyDS(amg_data), HYPRE_MEMORY_HOST);
    }
 
+   if (hypre_ParAMGDataChebyCAData(amg_data))
+   {
+      for (i = 0; i < num_levels; i++)
+      {
+         hypre_ParCSRRelax_Cheby_CADestroy(hypre_ParAMGDataChebyCAData(amg_data)[i]);
+      }
+      hypre_TFree(hypre_ParAMGDataChebyCAData(amg_data), HYPRE_MEMORY_HOST);
+   }
+
+   if (hypre_ParAMGDataColorOrder(amg_data))
+   {
+      for (i = 0; i < num_levels; i++)
+      {
+         hypre_TFree(hypre_ParAMGDataColorPtr(amg_data)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorOrder(amg_data)[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_ParAMGDataNumColors(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataColorPtr(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataColorOrder(amg_data), HYPRE_MEMORY_HOST);
+   }
+
    if (hypre_ParAMGDataDinv(amg_data))
       hypre_TFree(hypre_ParAMGDataDinv(amg_data), HYPRE_MEMORY_HOST);
 
@@ -673,6 +721,8 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataCFMarkerArray(amg_data)[0], HYPRE_MEMORY_HOST);
    }
    hypre_ParVectorDestroy(hypre_ParAMGDataVtemp(amg_data));
+   hypre_TFree(hypre_ParAMGDataRestrictWork(amg_data), HYPRE_MEMORY_HOST);
+   hypre_BoomerAMGDestroyMultiVec(amg_data);
    hypre_TFree(hypre_ParAMGDataFArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataUArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataAArray(amg_data), HYPRE_MEMORY_HOST);
@@ -820,6 +870,8 @@ hypre_BoomerAMGDestroy( void *data )
    if (hypre_ParAMGDataBVec(amg_data)) hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
    if (hypre_ParAMGDataCommInfo(amg_data)) hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
 
+   hypre_BoomerAMGReuseHierarchyFree(amg_data);
+
    if (new_comm != hypre_MPI_COMM_NULL)
    {
       hypre_MPI_Comm_free (&new_comm);
@@ -1864,6 +1916,43 @@ hypre_BoomerAMGGetConvergeType( void      *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetLaggedConvCheck( void     *data,
+                                   HYPRE_Int lagged  )
+{
+   /* lagged 0: default. residual norm of cycle k is reduced after cycle k
+    *        1:          the reduction of cycle k runs during cycle k+1
+    */
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataLaggedConvCheck(amg_data) = lagged;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetLaggedConvCheck( void      *data,
+                                   HYPRE_Int *lagged  )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *lagged = hypre_ParAMGDataLaggedConvCheck(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetTol( void     *data,
                        HYPRE_Real    tol  )
@@ -4175,6 +4264,27 @@ hypre_BoomerAMGSetChebyScale( void     *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetChebyCommAvoid( void     *data,
+                                  HYPRE_Int cheby_ca)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (cheby_ca < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataChebyCommAvoid(amg_data) = cheby_ca;
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  * hypre_BoomerAMGSetInterpVectors
@@ -4446,6 +4556,23 @@ hypre_BoomerAMGSetAddLastLvl( void *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetAddAsync( void *data,
+                            HYPRE_Int   add_async )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataAddAsync(amg_data) = add_async;
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetNonGalerkinTol( void   *data,
                             HYPRE_Real nongalerkin_tol)
@@ -4563,6 +4690,38 @@ hypre_BoomerAMGSetKeepTranspose( void       *data,
   return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetSinglePrecisionLevel( void      *data,
+                                        HYPRE_Int  sp_level )
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataSinglePrecisionLevel(amg_data) = sp_level;
+  return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetReuseHierarchy( void      *data,
+                                  HYPRE_Int  reuse_hierarchy )
+{
+  hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+  if (!amg_data)
+  {
+     hypre_error_in_arg(1);
+     return hypre_error_flag;
+  }
+
+  hypre_ParAMGDataReuseHierarchy(amg_data) = reuse_hierarchy;
+  return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_DSUPERLU
 HYPRE_Int
 hypre_BoomerAMGSetDSLUThreshold( void   *data,
@@ -79,6 +79,7 @@ typedef struct
    HYPRE_Real    *relax_weight;
    HYPRE_Real    *omega;
    HYPRE_Int      converge_type;
+   HYPRE_Int      lagged_conv_check;
    HYPRE_Real     tol;
    HYPRE_Int      partial_cycle_coarsest_level;
    HYPRE_Int      partial_cycle_control;
@@ -153,6 +154,13 @@ typedef struct
    HYPRE_Real           cheby_fraction;
    HYPRE_Real         **cheby_ds;
    HYPRE_Real         **cheby_coefs;
+   HYPRE_Int            cheby_ca;
+   void               **cheby_ca_data;
+
+   /* multicolor Gauss-Seidel (relax types 40, 41) */
+   HYPRE_Int           *num_colors;
+   HYPRE_Int          **color_ptr;
+   HYPRE_Int          **color_order;
 
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
@@ -168,6 +176,15 @@ typedef struct
    hypre_ParVector   *Rtemp;
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
+   /* per-thread partial sums of hypre_ParCSRMatrixResidualRestrict */
+   HYPRE_Complex     *restrict_work;
+   HYPRE_Int          restrict_work_size;
+
+   /* row-wise multivector hierarchy for multiple right-hand sides */
+   HYPRE_Int          num_vectors_mv;
+   hypre_ParVector  **F_array_mv;
+   hypre_ParVector  **U_array_mv;
+   hypre_ParVector   *Vtemp_mv;
 
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
@@ -226,6 +243,7 @@ typedef struct
    HYPRE_Int      mult_additive;
    HYPRE_Int      simple;
    HYPRE_Int      add_last_lvl;
+   HYPRE_Int      add_async;
    HYPRE_Int      add_P_max_elmts;
    HYPRE_Real     add_trunc_factor;
    HYPRE_Int      add_rlx_type;
@@ -241,6 +259,24 @@ typedef struct
    HYPRE_Int keepTranspose;
    HYPRE_Int modularized_matmat;
 
+   /* levels from which A, P and R are stored in single precision (-1: none) */
+   HYPRE_Int single_precision_level;
+
+   /* numeric-only re-setup: keep CF splittings, P and R when the sparsity
+      of A is unchanged; reuse_A_info holds the local sizes of A (rows, diag
+      and offd nonzeros, offd columns) at the last full setup, and
+      reuse_A_checksum the checksum of its local sparsity pattern */
+   HYPRE_Int          reuse_hierarchy;
+   HYPRE_Int          reuse_A_info[4];
+   hypre_ulonglongint reuse_A_checksum;
+   /* products kept between numeric-only re-setups: A*P and R*(A*P) with
+      their hypre_ParMatmul plans, and P^T when R is not stored */
+   HYPRE_Int             reuse_num_levels;
+   hypre_ParMatmulPlan **reuse_AP_plans;
+   hypre_ParMatmulPlan **reuse_RAP_plans;
+   hypre_ParCSRMatrix  **reuse_AP_array;
+   hypre_ParCSRMatrix  **reuse_PT_array;
+
    /* information for preserving indices as coarse grid points */
    HYPRE_Int      num_C_points;
    HYPRE_Int      C_points_coarse_level;
@@ -317,6 +353,7 @@ typedef struct
 #define hypre_ParAMGDataFCycle(amg_data) ((amg_data)->fcycle)
 #define hypre_ParAMGDataCycleType(amg_data) ((amg_data)->cycle_type)
 #define hypre_ParAMGDataConvergeType(amg_data) ((amg_data)->converge_type)
+#define hypre_ParAMGDataLaggedConvCheck(amg_data) ((amg_data)->lagged_conv_check)
 #define hypre_ParAMGDataTol(amg_data) ((amg_data)->tol)
 #define hypre_ParAMGDataPartialCycleCoarsestLevel(amg_data) ((amg_data)->partial_cycle_coarsest_level)
 #define hypre_ParAMGDataPartialCycleControl(amg_data) ((amg_data)->partial_cycle_control)
@@ -395,6 +432,12 @@ typedef struct
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
+#define hypre_ParAMGDataChebyCommAvoid(amg_data) ((amg_data)->cheby_ca)
+#define hypre_ParAMGDataChebyCAData(amg_data) ((amg_data)->cheby_ca_data)
+
+#define hypre_ParAMGDataNumColors(amg_data) ((amg_data)->num_colors)
+#define hypre_ParAMGDataColorPtr(amg_data) ((amg_data)->color_ptr)
+#define hypre_ParAMGDataColorOrder(amg_data) ((amg_data)->color_order)
 
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
@@ -412,6 +455,12 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataRestrictWork(amg_data) ((amg_data)->restrict_work)
+#define hypre_ParAMGDataRestrictWorkSize(amg_data) ((amg_data)->restrict_work_size)
+#define hypre_ParAMGDataNumVectorsMV(amg_data) ((amg_data)->num_vectors_mv)
+#define hypre_ParAMGDataFArrayMV(amg_data) ((amg_data)->F_array_mv)
+#define hypre_ParAMGDataUArrayMV(amg_data) ((amg_data)->U_array_mv)
+#define hypre_ParAMGDataVtempMV(amg_data) ((amg_data)->Vtemp_mv)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -471,6 +520,7 @@ typedef struct
 #define hypre_ParAMGDataMultAdditive(amg_data) ((amg_data)->mult_additive)
 #define hypre_ParAMGDataSimple(amg_data) ((amg_data)->simple)
 #define hypre_ParAMGDataAddLastLvl(amg_data) ((amg_data)->add_last_lvl)
+#define hypre_ParAMGDataAddAsync(amg_data) ((amg_data)->add_async)
 #define hypre_ParAMGDataMultAddPMaxElmts(amg_data) ((amg_data)->add_P_max_elmts)
 #define hypre_ParAMGDataMultAddTruncFactor(amg_data) ((amg_data)->add_trunc_factor)
 #define hypre_ParAMGDataAddRelaxType(amg_data) ((amg_data)->add_rlx_type)
@@ -490,6 +540,15 @@ typedef struct
 #define hypre_ParAMGDataRAP2(amg_data) ((amg_data)->rap2)
 #define hypre_ParAMGDataKeepTranspose(amg_data) ((amg_data)->keepTranspose)
 #define hypre_ParAMGDataModularizedMatMat(amg_data) ((amg_data)->modularized_matmat)
+#define hypre_ParAMGDataSinglePrecisionLevel(amg_data) ((amg_data)->single_precision_level)
+#define hypre_ParAMGDataReuseHierarchy(amg_data) ((amg_data)->reuse_hierarchy)
+#define hypre_ParAMGDataReuseAInfo(amg_data) ((amg_data)->reuse_A_info)
+#define hypre_ParAMGDataReuseAChecksum(amg_data) ((amg_data)->reuse_A_checksum)
+#define hypre_ParAMGDataReuseNumLevels(amg_data) ((amg_data)->reuse_num_levels)
+#define hypre_ParAMGDataReuseAPPlans(amg_data) ((amg_data)->reuse_AP_plans)
+#define hypre_ParAMGDataReuseRAPPlans(amg_data) ((amg_data)->reuse_RAP_plans)
+#define hypre_ParAMGDataReuseAPArray(amg_data) ((amg_data)->reuse_AP_array)
+#define hypre_ParAMGDataReusePTArray(amg_data) ((amg_data)->reuse_PT_array)
 
 /*indices for the dof which will keep coarsening to the coarse level */
 #define hypre_ParAMGDataNumCPoints(amg_data)  ((amg_data)->num_C_points)
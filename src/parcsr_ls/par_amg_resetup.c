@@ -0,0 +1,557 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/*****************************************************************************
+ *
+ * Numeric-only re-setup of AMG
+ *
+ * When the sparsity pattern of A is the same as at the last full setup
+ * (see hypre_BoomerAMGSetReuseHierarchy), the C/F splittings, P and R are
+ * kept. Only the coarse grid operators and the data of the smoothers that
+ * depend on the values of A (l1 norms, Chebyshev coefficients and ghost
+ * layers, Gaussian elimination on the coarsest level) are recomputed.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseHierarchyRecord
+ *
+ * Saves the local sizes of A and the checksum of its local sparsity pattern
+ * at the end of a full setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReuseHierarchyRecord( void               *amg_vdata,
+                                     hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int        *info     = hypre_ParAMGDataReuseAInfo(amg_data);
+
+   info[0] = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   info[1] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A));
+   info[2] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+   info[3] = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   hypre_ParCSRMatrixPatternChecksum(A, &hypre_ParAMGDataReuseAChecksum(amg_data));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseHierarchyCheck
+ *
+ * Returns reuse = 1 on all processes if the hierarchy of the last full
+ * setup can be kept for A. The previous A_array[0] is not accessed, since
+ * it may have been destroyed by the user.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReuseHierarchyCheck( void               *amg_vdata,
+                                    hypre_ParCSRMatrix *A,
+                                    HYPRE_Int          *reuse )
+{
+   hypre_ParAMGData   *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int          *info            = hypre_ParAMGDataReuseAInfo(amg_data);
+   HYPRE_Int          *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int           local_reuse     = 1;
+   hypre_ulonglongint  checksum        = 0;
+   HYPRE_Int           k;
+
+   *reuse = 0;
+
+   if (!hypre_ParAMGDataReuseHierarchy(amg_data))
+   {
+      return hypre_error_flag;
+   }
+
+   if ( !hypre_ParAMGDataAArray(amg_data) ||
+        hypre_ParAMGDataNumLevels(amg_data) < 2 ||
+        info[0] != hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A)) ||
+        info[1] != hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) ||
+        info[2] != hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A)) ||
+        info[3] != hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)) )
+   {
+      local_reuse = 0;
+   }
+   else
+   {
+      /* same sizes: compare the patterns themselves */
+      hypre_ParCSRMatrixPatternChecksum(A, &checksum);
+      if (checksum != hypre_ParAMGDataReuseAChecksum(amg_data))
+      {
+         local_reuse = 0;
+      }
+   }
+
+   /* options whose setup data are not (only) built from P, R and the
+      coarse grid operators */
+   if ( hypre_ParAMGDataBlockMode(amg_data) ||
+        hypre_ParAMGDataAdditive(amg_data) > -1 ||
+        hypre_ParAMGDataMultAdditive(amg_data) > -1 ||
+        hypre_ParAMGDataSimple(amg_data) > -1 ||
+        hypre_ParAMGInterpVecVariant(amg_data) > 0 ||
+        hypre_ParAMGDataNonGalerkNumTol(amg_data) > 0 ||
+        hypre_ParAMGDataNonGalTolArray(amg_data) ||
+        hypre_ParAMGDataNonGalerkinTol(amg_data) > 0.0 ||
+        hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+        hypre_ParAMGDataSinglePrecisionLevel(amg_data) > -1 ||
+        hypre_ParAMGDataACoarse(amg_data) )
+   {
+      local_reuse = 0;
+   }
+#ifdef HYPRE_USING_DSUPERLU
+   if (hypre_ParAMGDataDSLUSolver(amg_data))
+   {
+      local_reuse = 0;
+   }
+#endif
+   for (k = 0; k < 4; k++)
+   {
+      if (grid_relax_type[k] == 15)
+      {
+         local_reuse = 0;
+      }
+   }
+
+   hypre_MPI_Allreduce(&local_reuse, reuse, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseHierarchyFree
+ *
+ * Frees the products kept by hypre_BoomerAMGSetupNumeric. The coarse grid
+ * operators they produced belong to A_array.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReuseHierarchyFree( void *amg_vdata )
+{
+   hypre_ParAMGData     *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int             num_levels = hypre_ParAMGDataReuseNumLevels(amg_data);
+   hypre_ParMatmulPlan **AP_plans   = hypre_ParAMGDataReuseAPPlans(amg_data);
+   hypre_ParMatmulPlan **RAP_plans  = hypre_ParAMGDataReuseRAPPlans(amg_data);
+   hypre_ParCSRMatrix  **AP_array   = hypre_ParAMGDataReuseAPArray(amg_data);
+   hypre_ParCSRMatrix  **PT_array   = hypre_ParAMGDataReusePTArray(amg_data);
+   HYPRE_Int             level;
+
+   if (!AP_plans)
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = 0; level < num_levels; level++)
+   {
+      hypre_ParMatmulPlanDestroy(AP_plans[level]);
+      hypre_ParMatmulPlanDestroy(RAP_plans[level]);
+      if (AP_array[level])
+      {
+         hypre_ParCSRMatrixDestroy(AP_array[level]);
+      }
+      if (PT_array[level])
+      {
+         hypre_ParCSRMatrixDestroy(PT_array[level]);
+      }
+   }
+   hypre_TFree(AP_plans, HYPRE_MEMORY_HOST);
+   hypre_TFree(RAP_plans, HYPRE_MEMORY_HOST);
+   hypre_TFree(AP_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(PT_array, HYPRE_MEMORY_HOST);
+
+   hypre_ParAMGDataReuseNumLevels(amg_data) = 0;
+   hypre_ParAMGDataReuseAPPlans(amg_data)   = NULL;
+   hypre_ParAMGDataReuseRAPPlans(amg_data)  = NULL;
+   hypre_ParAMGDataReuseAPArray(amg_data)   = NULL;
+   hypre_ParAMGDataReusePTArray(amg_data)   = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReuseStarts
+ *
+ * A_new is a product built on the partitionings of P and R, i.e. on the
+ * row and column starts of A_old. A_new takes them over, so that the
+ * vectors of its level and the operators pointing to them stay valid.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGReuseStarts( hypre_ParCSRMatrix *A_old,
+                            hypre_ParCSRMatrix *A_new )
+{
+   HYPRE_BigInt *row_starts = hypre_ParCSRMatrixRowStarts(A_new);
+   HYPRE_BigInt *col_starts = hypre_ParCSRMatrixColStarts(A_new);
+
+   if (hypre_ParCSRMatrixOwnsRowStarts(A_new) &&
+       row_starts != hypre_ParCSRMatrixRowStarts(A_old) &&
+       row_starts != hypre_ParCSRMatrixColStarts(A_old))
+   {
+      hypre_TFree(row_starts, HYPRE_MEMORY_HOST);
+   }
+   if (hypre_ParCSRMatrixOwnsColStarts(A_new) && col_starts != row_starts &&
+       col_starts != hypre_ParCSRMatrixRowStarts(A_old) &&
+       col_starts != hypre_ParCSRMatrixColStarts(A_old))
+   {
+      hypre_TFree(col_starts, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_ParCSRMatrixRowStarts(A_new)     = hypre_ParCSRMatrixRowStarts(A_old);
+   hypre_ParCSRMatrixColStarts(A_new)     = hypre_ParCSRMatrixColStarts(A_old);
+   hypre_ParCSRMatrixOwnsRowStarts(A_new) = hypre_ParCSRMatrixOwnsRowStarts(A_old);
+   hypre_ParCSRMatrixOwnsColStarts(A_new) = hypre_ParCSRMatrixOwnsColStarts(A_old);
+   hypre_ParCSRMatrixOwnsRowStarts(A_old) = 0;
+   hypre_ParCSRMatrixOwnsColStarts(A_old) = 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupNumeric
+ *
+ * Recomputes the values of the hierarchy for a matrix A with the sparsity
+ * pattern of the last full setup, see hypre_BoomerAMGReuseHierarchyCheck.
+ *
+ * On the host and without dropping of small entries, the coarse grid
+ * operators are formed as R*(A*P) (R = P^T if R is not stored) with
+ * hypre_ParMatmul plans built at the first re-setup; the next re-setups
+ * only recompute the values of A*P and of the coarse grid operators, in
+ * place. Otherwise they are formed as in hypre_BoomerAMGSetup. If a
+ * product fails on any process, the full hypre_BoomerAMGSetup is done.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupNumeric( void               *amg_vdata,
+                             hypre_ParCSRMatrix *A,
+                             hypre_ParVector    *f,
+                             hypre_ParVector    *u )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array         = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParVector    **F_array         = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector    **U_array         = hypre_ParAMGDataUArray(amg_data);
+   HYPRE_Int          **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            relax_order     = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Int            restri_type     = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Int            rap2            = hypre_ParAMGDataRAP2(amg_data);
+   HYPRE_Int            keepTranspose   = hypre_ParAMGDataKeepTranspose(amg_data);
+   HYPRE_Int            amg_print_level = hypre_ParAMGDataPrintLevel(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Real         **cheby_ds        = hypre_ParAMGDataChebyDS(amg_data);
+   HYPRE_Real         **cheby_coefs     = hypre_ParAMGDataChebyCoefs(amg_data);
+   HYPRE_Real          *max_eig_est     = hypre_ParAMGDataMaxEigEst(amg_data);
+   HYPRE_Real          *min_eig_est     = hypre_ParAMGDataMinEigEst(amg_data);
+   HYPRE_BigInt        *row_starts      = hypre_ParCSRMatrixRowStarts(A);
+   hypre_ParVector     *vecs[5];
+   hypre_ParCSRMatrix  *A_H;
+   HYPRE_Int            num_procs, level, j, k;
+   HYPRE_Int            use_plans, plan_error = 0, global_plan_error;
+   hypre_ParMatmulPlan **AP_plans, **RAP_plans;
+   hypre_ParCSRMatrix  **AP_array, **PT_array;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------------
+    * Fine level: A may be a new object, possibly with new row starts
+    *-----------------------------------------------------------------------*/
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   /* the values of A may have been changed in place */
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixDiag(A));
+   hypre_CSRMatrixSellDestroy(hypre_ParCSRMatrixOffd(A));
+
+   A_array[0] = A;
+   F_array[0] = f;
+   U_array[0] = u;
+
+   if (!hypre_ParCSRMatrixOwnsRowStarts(P_array[0]))
+   {
+      hypre_ParCSRMatrixRowStarts(P_array[0]) = row_starts;
+   }
+   if (restri_type && R_array[0] && !hypre_ParCSRMatrixOwnsColStarts(R_array[0]))
+   {
+      hypre_ParCSRMatrixColStarts(R_array[0]) = row_starts;
+   }
+
+   vecs[0] = hypre_ParAMGDataVtemp(amg_data);
+   vecs[1] = hypre_ParAMGDataPtemp(amg_data);
+   vecs[2] = hypre_ParAMGDataRtemp(amg_data);
+   vecs[3] = hypre_ParAMGDataZtemp(amg_data);
+   vecs[4] = hypre_ParAMGDataResidual(amg_data);
+   for (k = 0; k < 5; k++)
+   {
+      if (vecs[k] && !hypre_ParVectorOwnsPartitioning(vecs[k]))
+      {
+         hypre_ParVectorPartitioning(vecs[k]) = row_starts;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Coarse grid operators
+    *-----------------------------------------------------------------------*/
+
+   use_plans = hypre_ParAMGDataADropTol(amg_data) <= 0.0 &&
+               hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) == hypre_MEMORY_HOST;
+
+   if (use_plans && !hypre_ParAMGDataReuseAPPlans(amg_data))
+   {
+      hypre_ParAMGDataReuseNumLevels(amg_data) = num_levels;
+      hypre_ParAMGDataReuseAPPlans(amg_data)   = hypre_CTAlloc(hypre_ParMatmulPlan*, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataReuseRAPPlans(amg_data)  = hypre_CTAlloc(hypre_ParMatmulPlan*, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataReuseAPArray(amg_data)   = hypre_CTAlloc(hypre_ParCSRMatrix*, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataReusePTArray(amg_data)   = hypre_CTAlloc(hypre_ParCSRMatrix*, num_levels, HYPRE_MEMORY_HOST);
+   }
+   AP_plans  = hypre_ParAMGDataReuseAPPlans(amg_data);
+   RAP_plans = hypre_ParAMGDataReuseRAPPlans(amg_data);
+   AP_array  = hypre_ParAMGDataReuseAPArray(amg_data);
+   PT_array  = hypre_ParAMGDataReusePTArray(amg_data);
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (use_plans && AP_plans[level])
+      {
+         hypre_ParCSRMatrix *RT = restri_type ? R_array[level] : PT_array[level];
+
+         if (level == 0)
+         {
+            hypre_ParCSRMatrixRowStarts(AP_array[0]) = row_starts;
+         }
+         plan_error |= hypre_ParMatmulNumeric(AP_plans[level], A_array[level], P_array[level],
+                                              AP_array[level]);
+         plan_error |= hypre_ParMatmulNumeric(RAP_plans[level], RT, AP_array[level],
+                                              A_array[level+1]);
+         continue;
+      }
+
+      /* the transpose of P is kept from the full setup if it was stored */
+      HYPRE_Int keep_T = keepTranspose && !hypre_ParCSRMatrixDiagT(P_array[level]);
+
+      A_H = NULL;
+
+      if (use_plans)
+      {
+         /* first re-setup: build the plans, A_H replaces the operator of
+            the full setup */
+         hypre_ParCSRMatrix *RT = R_array[level];
+
+         if (!restri_type)
+         {
+            hypre_ParCSRMatrixTranspose(P_array[level], &PT_array[level], 1);
+            RT = PT_array[level];
+         }
+         plan_error |= hypre_ParMatmulSymbolic(A_array[level], P_array[level], &AP_plans[level],
+                                               &AP_array[level]);
+         plan_error |= hypre_ParMatmulNumeric(AP_plans[level], A_array[level], P_array[level],
+                                              AP_array[level]);
+         plan_error |= hypre_ParMatmulSymbolic(RT, AP_array[level], &RAP_plans[level], &A_H);
+         plan_error |= hypre_ParMatmulNumeric(RAP_plans[level], RT, AP_array[level], A_H);
+      }
+      else if (restri_type)
+      {
+         hypre_ParCSRMatrix *AP = NULL;
+         if (hypre_ParAMGDataModularizedMatMat(amg_data))
+         {
+            AP  = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+            A_H = hypre_ParCSRMatMat(R_array[level], AP);
+            hypre_CSRMatrixReorder(hypre_ParCSRMatrixDiag(A_H));
+         }
+         else
+         {
+            AP  = hypre_ParMatmul(A_array[level], P_array[level]);
+            A_H = hypre_ParMatmul(R_array[level], AP);
+         }
+         hypre_ParCSRMatrixDestroy(AP);
+      }
+      else if (rap2)
+      {
+         hypre_ParCSRMatrix *Q = NULL;
+         if (hypre_ParAMGDataModularizedMatMat(amg_data))
+         {
+            Q   = hypre_ParCSRMatMat(A_array[level], P_array[level]);
+            A_H = hypre_ParCSRTMatMatKT(P_array[level], Q, keep_T);
+         }
+         else
+         {
+            Q   = hypre_ParMatmul(A_array[level], P_array[level]);
+            A_H = hypre_ParTMatmul(P_array[level], Q);
+         }
+         hypre_ParCSRMatrixDestroy(Q);
+      }
+      else
+      {
+         if (hypre_ParAMGDataModularizedMatMat(amg_data))
+         {
+            A_H = hypre_ParCSRMatrixRAPKT(P_array[level], A_array[level],
+                                          P_array[level], keep_T);
+         }
+         else
+         {
+            hypre_BoomerAMGBuildCoarseOperatorKT(P_array[level], A_array[level],
+                                                 P_array[level], keep_T, &A_H);
+         }
+      }
+
+      hypre_BoomerAMGReuseStarts(A_array[level+1], A_H);
+      hypre_ParCSRMatrixDestroy(A_array[level+1]);
+
+      hypre_ParCSRMatrixDropSmallEntries(A_H, hypre_ParAMGDataADropTol(amg_data),
+                                         hypre_ParAMGDataADropType(amg_data));
+      if (num_procs > 1 && hypre_ParCSRMatrixCommPkg(A_H) == NULL)
+      {
+         hypre_MatvecCommPkgCreate(A_H);
+      }
+      if (hypre_ParAMGDataADropTol(amg_data) <= 0.0)
+      {
+         hypre_ParCSRMatrixSetNumNonzeros(A_H);
+         hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+      }
+      A_array[level+1] = A_H;
+   }
+
+   /* a plan that does not match its operands leaves the coarse grid
+      operators stale or incomplete: redo the full setup instead */
+   if (use_plans)
+   {
+      hypre_MPI_Allreduce(&plan_error, &global_plan_error, 1, HYPRE_MPI_INT,
+                          hypre_MPI_MAX, comm);
+      if (global_plan_error)
+      {
+         HYPRE_ClearError(HYPRE_ERROR_GENERIC);
+         hypre_ParAMGDataReuseAInfo(amg_data)[0] = -1;
+         HYPRE_ANNOTATE_FUNC_END;
+
+         return hypre_BoomerAMGSetup(amg_vdata, A, f, u);
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Smoother data, with the rules of hypre_BoomerAMGSetup. Relaxation
+    * weights computed at the full setup are kept.
+    *-----------------------------------------------------------------------*/
+
+   for (j = 0; j < num_levels; j++)
+   {
+      HYPRE_Real *l1_norm_data = NULL;
+      HYPRE_Int   coarsest     = (j == num_levels - 1);
+      HYPRE_Int   relax_k      = coarsest ? 3 : 1;
+      HYPRE_Int   relax_l      = coarsest ? 3 : 2;
+      HYPRE_Int  *cf_marker    = (relax_order && !coarsest) ? CF_marker_array[j] : NULL;
+
+      if (l1_norms && l1_norms[j])
+      {
+         hypre_SeqVectorDestroy(l1_norms[j]);
+         l1_norms[j] = NULL;
+      }
+
+      if (grid_relax_type[1] == 7 || grid_relax_type[2] == 7 ||
+          (grid_relax_type[3] == 7 && coarsest))
+      {
+         hypre_ParCSRComputeL1Norms(A_array[j], 5, NULL, &l1_norm_data);
+      }
+      else if (grid_relax_type[relax_k] == 18 || grid_relax_type[relax_l] == 18)
+      {
+         hypre_ParCSRComputeL1Norms(A_array[j], 1, cf_marker, &l1_norm_data);
+      }
+      else if (grid_relax_type[relax_k] ==  8 || grid_relax_type[relax_l] ==  8 ||
+               grid_relax_type[relax_k] == 13 || grid_relax_type[relax_l] == 13 ||
+               grid_relax_type[relax_k] == 14 || grid_relax_type[relax_l] == 14)
+      {
+         hypre_ParCSRComputeL1Norms(A_array[j], 4, cf_marker, &l1_norm_data);
+      }
+
+      if (l1_norm_data)
+      {
+         l1_norms[j] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[j]));
+         hypre_VectorData(l1_norms[j]) = l1_norm_data;
+         hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
+      }
+
+      if (grid_relax_type[1] == 7 || grid_relax_type[2] == 7 ||
+          (grid_relax_type[3] == 7 && coarsest))
+      {
+         continue;
+      }
+
+      if (grid_relax_type[1] == 16 || grid_relax_type[2] == 16 ||
+          (grid_relax_type[3] == 16 && coarsest))
+      {
+         HYPRE_Int   scale          = hypre_ParAMGDataChebyScale(amg_data);
+         HYPRE_Int   variant        = hypre_ParAMGDataChebyVariant(amg_data);
+         HYPRE_Int   cheby_order    = hypre_ParAMGDataChebyOrder(amg_data);
+         HYPRE_Int   cheby_eig_est  = hypre_ParAMGDataChebyEigEst(amg_data);
+         HYPRE_Real  cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);
+         HYPRE_Real  max_eig, min_eig = 0;
+
+         hypre_TFree(cheby_coefs[j], HYPRE_MEMORY_HOST);
+         hypre_TFree(cheby_ds[j], HYPRE_MEMORY_HOST);
+
+         if (cheby_eig_est)
+         {
+            hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est,
+                                         &max_eig, &min_eig);
+         }
+         else
+         {
+            hypre_ParCSRMaxEigEstimate(A_array[j], scale, &max_eig);
+         }
+         max_eig_est[j] = max_eig;
+         min_eig_est[j] = min_eig;
+         hypre_ParCSRRelax_Cheby_Setup(A_array[j], max_eig, min_eig, cheby_fraction,
+                                       cheby_order, scale, variant,
+                                       &cheby_coefs[j], &cheby_ds[j]);
+
+         /* the ghost layer keeps copies of the values of A and of the scaling */
+         if (hypre_ParAMGDataChebyCAData(amg_data) && j < hypre_ParAMGDataChebyCommAvoid(amg_data))
+         {
+            hypre_ParCSRRelax_Cheby_CADestroy(hypre_ParAMGDataChebyCAData(amg_data)[j]);
+            hypre_ParAMGDataChebyCAData(amg_data)[j] = NULL;
+            hypre_ParCSRRelax_Cheby_CASetup(A_array[j], cheby_order, scale, cheby_ds[j],
+                                            &hypre_ParAMGDataChebyCAData(amg_data)[j]);
+         }
+      }
+   }
+
+   /* Gaussian elimination on the coarsest level */
+   if (grid_relax_type[3] == 9 || grid_relax_type[3] == 99 || grid_relax_type[3] == 199)
+   {
+      MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
+
+      hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
+      if (new_comm != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&new_comm);
+         hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
+      }
+      hypre_ParAMGDataGSSetup(amg_data) = 0;
+
+      hypre_GaussElimSetup(amg_data, num_levels - 1, grid_relax_type[3]);
+   }
+
+   if (amg_print_level == 1 || amg_print_level == 3)
+   {
+      hypre_BoomerAMGSetupStats(amg_data, A);
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
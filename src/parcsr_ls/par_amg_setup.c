@@ -106,6 +106,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_Vector       **l1_norms = NULL;
    HYPRE_Real         **cheby_ds = NULL;
    HYPRE_Real         **cheby_coefs = NULL;
+   HYPRE_Int           *num_colors = NULL;
+   HYPRE_Int          **color_ptr = NULL;
+   HYPRE_Int          **color_order = NULL;
 
    HYPRE_Int       old_num_levels, num_levels;
    HYPRE_Int       level;
@@ -144,6 +147,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Solver *smoother = NULL;
    HYPRE_Int     smooth_type = hypre_ParAMGDataSmoothType(amg_data);
    HYPRE_Int     smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
+   HYPRE_Int     sp_level = hypre_ParAMGDataSinglePrecisionLevel(amg_data);
    HYPRE_Int     sym;
    HYPRE_Int     nlevel;
    HYPRE_Real    thresh;
@@ -266,6 +270,20 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    if (num_procs == 1) seq_threshold = 0;
    if (setup_type == 0) return hypre_error_flag;
 
+   /* numeric-only re-setup if the sparsity of A has not changed */
+   if (hypre_ParAMGDataReuseHierarchy(amg_data))
+   {
+      HYPRE_Int reuse = 0;
+
+      hypre_BoomerAMGReuseHierarchyCheck(amg_data, A, &reuse);
+      if (reuse)
+      {
+         return hypre_BoomerAMGSetupNumeric(amg_data, A, f, u);
+      }
+   }
+   hypre_ParAMGDataReuseAInfo(amg_data)[0] = -1;
+   hypre_BoomerAMGReuseHierarchyFree(amg_data);
+
    S = NULL;
 
    A_array = hypre_ParAMGDataAArray(amg_data);
@@ -318,7 +336,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    /* probably should disable stuff like smooth num levels at some point */
 
 
-   if (grid_relax_type[0] >= 20) /* block relaxation choosen */
+   if (grid_relax_type[0] >= 20 && grid_relax_type[0] != 40 &&
+       grid_relax_type[0] != 41) /* block relaxation choosen */
    {
 
       if (!((interp_type >= 20 && interp_type != 100) || interp_type == 11 || interp_type == 10 ) )
@@ -441,6 +460,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
          hypre_ParAMGDataZtemp(amg_data) = NULL;
       }
+      hypre_BoomerAMGDestroyMultiVec(amg_data);
 
       if (hypre_ParAMGDataACoarse(amg_data))
       {
@@ -488,6 +508,25 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
+      if (hypre_ParAMGDataColorOrder(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_TFree(hypre_ParAMGDataColorPtr(amg_data)[i], HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_ParAMGDataColorOrder(amg_data)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_ParAMGDataNumColors(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorPtr(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataColorOrder(amg_data), HYPRE_MEMORY_HOST);
+      }
+      if (hypre_ParAMGDataChebyCAData(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_ParCSRRelax_Cheby_CADestroy(hypre_ParAMGDataChebyCAData(amg_data)[i]);
+         }
+         hypre_TFree(hypre_ParAMGDataChebyCAData(amg_data), HYPRE_MEMORY_HOST);
+      }
       if (smooth_num_levels && smoother)
       {
          if (smooth_num_levels > old_num_levels-1)
@@ -2882,6 +2921,55 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       cheby_coefs = hypre_CTAlloc(HYPRE_Real *, num_levels, HYPRE_MEMORY_HOST);
       hypre_ParAMGDataChebyDS(amg_data) = cheby_ds;
       hypre_ParAMGDataChebyCoefs(amg_data) = cheby_coefs;
+      if (hypre_ParAMGDataChebyCommAvoid(amg_data))
+      {
+         hypre_ParAMGDataChebyCAData(amg_data) = hypre_CTAlloc(void *, num_levels, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   /* multicolor Gauss-Seidel: color each level once, reused in every cycle.
+      Only the levels that relax with type 40 or 41 are colored: the down and
+      up cycles below the coarsest level, the coarsest level, or the user
+      relax type when there is no coarsening (see hypre_BoomerAMGCycle) */
+   for (level = 0; level < num_levels; level++)
+   {
+      HYPRE_Int mc_type[2], mc_color = 0;
+
+      if (num_levels == 1)
+      {
+         mc_type[0] = hypre_ParAMGDataUserRelaxType(amg_data);
+         mc_type[1] = mc_type[0];
+      }
+      else if (level < num_levels - 1)
+      {
+         mc_type[0] = grid_relax_type[1];
+         mc_type[1] = grid_relax_type[2];
+      }
+      else
+      {
+         mc_type[0] = grid_relax_type[3];
+         mc_type[1] = grid_relax_type[3];
+      }
+      for (j = 0; j < 2; j++)
+      {
+         mc_color = mc_color || mc_type[j] == 40 || mc_type[j] == 41;
+      }
+
+      if (mc_color &&
+          hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A_array[level])) == HYPRE_EXEC_HOST)
+      {
+         if (!num_colors)
+         {
+            num_colors = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+            color_ptr = hypre_CTAlloc(HYPRE_Int *, num_levels, HYPRE_MEMORY_HOST);
+            color_order = hypre_CTAlloc(HYPRE_Int *, num_levels, HYPRE_MEMORY_HOST);
+            hypre_ParAMGDataNumColors(amg_data) = num_colors;
+            hypre_ParAMGDataColorPtr(amg_data) = color_ptr;
+            hypre_ParAMGDataColorOrder(amg_data) = color_order;
+         }
+         hypre_BoomerAMGRelaxMulticolorSetup(A_array[level], &num_colors[level],
+                                             &color_ptr[level], &color_order[level]);
+      }
    }
 
    /* CG */
@@ -3039,6 +3127,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
                                        cheby_fraction, cheby_order, scale, variant, &coefs, &ds);
          cheby_coefs[j] = coefs;
          cheby_ds[j] = ds;
+         /* ghost layer for the communication-avoiding version on the finest levels */
+         if (j < hypre_ParAMGDataChebyCommAvoid(amg_data))
+         {
+            hypre_ParCSRRelax_Cheby_CASetup(A_array[j], cheby_order, scale, ds,
+                                            &hypre_ParAMGDataChebyCAData(amg_data)[j]);
+         }
       }
       else if (grid_relax_type[1] == 15 || (grid_relax_type[3] == 15 && j == (num_levels-1))  )
       {
@@ -3217,6 +3311,48 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_BoomerAMGSetupStats(amg_data,A);
    }
 
+   /*-----------------------------------------------------------------------
+    * Single precision storage of the coarse levels. A is only converted if
+    * all the relaxations used on its level support it.
+    *-----------------------------------------------------------------------*/
+
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_COMPLEX)
+   if (sp_level > -1 && !block_mode && addlvl >= num_levels)
+   {
+      for (level = hypre_max(sp_level, 0); level < num_levels; level++)
+      {
+         HYPRE_Int k_begin = level < num_levels - 1 ? 1 : 3;
+         HYPRE_Int k_end   = level < num_levels - 1 ? 2 : 3;
+         HYPRE_Int convert_A = level > 0 && smooth_num_levels <= level;
+
+         for (k = k_begin; k <= k_end; k++)
+         {
+            switch (grid_relax_type[k])
+            {
+               case 0: case 3: case 4: case 6: case 7: case 8:
+               case 13: case 14: case 16: case 18:
+                  break;
+               default:
+                  convert_A = 0;
+            }
+         }
+
+         if (convert_A)
+         {
+            hypre_ParCSRMatrixConvertToFloat(A_array[level]);
+         }
+         if (level < num_levels - 1)
+         {
+            hypre_ParCSRMatrixConvertToFloat(P_array[level]);
+            if (restri_type && R_array[level])
+            {
+               hypre_ParCSRMatrixConvertToFloat(R_array[level]);
+            }
+         }
+      }
+   }
+#endif
+
    /* print out CF info to plot grids in matlab (see 'tools/AMGgrids.m') */
 
    if (hypre_ParAMGDataPlotGrids(amg_data))
@@ -3390,6 +3526,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 }
 #endif
 
+   hypre_BoomerAMGReuseHierarchyRecord(amg_data, A);
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return(hypre_error_flag);
@@ -14,6 +14,54 @@
 #include "_hypre_parcsr_ls.h"
 #include "par_amg.h"
 
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveUpdateResidual
+ *
+ * Sets the residual norm of the current cycle to new_resid and updates
+ * the convergence factor and the relative residual norm from it.
+ *--------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGSolveUpdateResidual( hypre_ParAMGData *amg_data,
+                                    HYPRE_Real        new_resid,
+                                    HYPRE_Real        rhs_norm,
+                                    HYPRE_Real        resid_nrm_init,
+                                    HYPRE_Real       *resid_nrm,
+                                    HYPRE_Real       *conv_factor,
+                                    HYPRE_Real       *relative_resid )
+{
+   HYPRE_Real old_resid = *resid_nrm;
+
+   *resid_nrm = new_resid;
+
+   if (old_resid)
+   {
+      *conv_factor = new_resid / old_resid;
+   }
+   else
+   {
+      *conv_factor = new_resid;
+   }
+
+   if (0 == hypre_ParAMGDataConvergeType(amg_data))
+   {
+      if (rhs_norm)
+      {
+         *relative_resid = new_resid / rhs_norm;
+      }
+      else
+      {
+         *relative_resid = new_resid;
+      }
+   }
+   else
+   {
+      *relative_resid = new_resid / resid_nrm_init;
+   }
+
+   hypre_ParAMGDataRelativeResidualNorm(amg_data) = *relative_resid;
+}
+
 /*--------------------------------------------------------------------
  * hypre_BoomerAMGSolve
  *--------------------------------------------------------------------*/
@@ -36,6 +84,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Int      num_levels;
    /* HYPRE_Int      num_unknowns; */
    HYPRE_Int    converge_type;
+   HYPRE_Int    lagged_conv_check;
    HYPRE_Real   tol;
 
    HYPRE_Int block_mode;
@@ -74,11 +123,24 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    HYPRE_Real   resid_nrm_init = 0.0;
    HYPRE_Real   relative_resid;
    HYPRE_Real   rhs_norm = 0.0;
-   HYPRE_Real   old_resid;
    HYPRE_Real   ieee_check = 0.;
 
+   /* lagged convergence check */
+   HYPRE_Int          lagged_pending = 0;
+   HYPRE_Real         lagged_local;
+   HYPRE_Real         lagged_global;
+   hypre_MPI_Request  lagged_request;
+   hypre_MPI_Status   lagged_status;
+
    hypre_ParVector  *Vtemp;
    hypre_ParVector  *Residual;
+   hypre_ParVector  *r_vec;
+
+   if (hypre_ParVectorNumVectors(f) > 1 &&
+       !(hypre_ParAMGDataFArrayMV(amg_data) && f == hypre_ParAMGDataFArrayMV(amg_data)[0]))
+   {
+      return hypre_BoomerAMGSolveMultiVec(amg_vdata, A, f, u);
+   }
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -95,6 +157,7 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    U_array          = hypre_ParAMGDataUArray(amg_data);
 
    converge_type    = hypre_ParAMGDataConvergeType(amg_data);
+   lagged_conv_check = hypre_ParAMGDataLaggedConvCheck(amg_data);
    tol              = hypre_ParAMGDataTol(amg_data);
    min_iter         = hypre_ParAMGDataMinIter(amg_data);
    max_iter         = hypre_ParAMGDataMaxIter(amg_data);
@@ -259,47 +322,58 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
        *    Compute  fine-grid residual and residual norm
        *----------------------------------------------------------------*/
 
-      if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
+      if (lagged_conv_check && tol > 0.)
       {
-         old_resid = resid_nrm;
+         /*------------------------------------------------------------
+          * Lagged check: finish the reduction started after the
+          * previous cycle (it overlapped with this one) and start the
+          * reduction for this cycle.  The loop test below therefore
+          * sees the residual of the previous cycle.
+          *------------------------------------------------------------*/
 
-         if ( amg_logging > 1 )
-         {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Residual );
-            resid_nrm = sqrt(hypre_ParVectorInnerProd( Residual, Residual ));
-         }
-         else
-         {
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], Vtemp);
-            resid_nrm = sqrt(hypre_ParVectorInnerProd(Vtemp, Vtemp));
-         }
+         r_vec = (amg_logging > 1) ? Residual : Vtemp;
+         hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], r_vec);
 
-         if (old_resid)
+         if (lagged_pending)
          {
-            conv_factor = resid_nrm / old_resid;
-         }
-         else
-         {
-            conv_factor = resid_nrm;
-         }
+#ifdef HYPRE_PROFILE
+            hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+            hypre_MPI_Wait(&lagged_request, &lagged_status);
+#ifdef HYPRE_PROFILE
+            hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+            hypre_BoomerAMGSolveUpdateResidual(amg_data, sqrt(lagged_global), rhs_norm,
+                                               resid_nrm_init, &resid_nrm, &conv_factor,
+                                               &relative_resid);
 
-         if (0 == converge_type)
-         {
-            if (rhs_norm)
-            {
-               relative_resid = resid_nrm / rhs_norm;
-            }
-            else
+            if (my_id == 0 && amg_print_level > 1)
             {
-               relative_resid = resid_nrm;
+               hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
+                     resid_nrm, conv_factor, relative_resid);
             }
          }
-         else
-         {
-            relative_resid = resid_nrm / resid_nrm_init;
-         }
 
-         hypre_ParAMGDataRelativeResidualNorm(amg_data) = relative_resid;
+         lagged_local = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(r_vec),
+                                                 hypre_ParVectorLocalVector(r_vec));
+#ifdef HYPRE_PROFILE
+         hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+         hypre_MPI_Iallreduce(&lagged_local, &lagged_global, 1, HYPRE_MPI_REAL,
+                              hypre_MPI_SUM, comm, &lagged_request);
+#ifdef HYPRE_PROFILE
+         hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+         lagged_pending = 1;
+      }
+      else if (amg_print_level > 1 || amg_logging > 1 || tol > 0.)
+      {
+         r_vec = (amg_logging > 1) ? Residual : Vtemp;
+         hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[0], U_array[0], beta, F_array[0], r_vec);
+
+         hypre_BoomerAMGSolveUpdateResidual(amg_data, sqrt(hypre_ParVectorInnerProd(r_vec, r_vec)),
+                                            rhs_norm, resid_nrm_init, &resid_nrm, &conv_factor,
+                                            &relative_resid);
       }
 
       ++cycle_count;
@@ -309,6 +383,27 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       ++hypre_ParAMGDataCumNumIterations(amg_data);
 #endif
 
+      if (my_id == 0 && amg_print_level > 1 && !lagged_pending)
+      {
+         hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
+               resid_nrm, conv_factor, relative_resid);
+      }
+   }
+
+   /* complete the last lagged reduction to report the final residual */
+   if (lagged_pending)
+   {
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+      hypre_MPI_Wait(&lagged_request, &lagged_status);
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+      hypre_BoomerAMGSolveUpdateResidual(amg_data, sqrt(lagged_global), rhs_norm,
+                                         resid_nrm_init, &resid_nrm, &conv_factor,
+                                         &relative_resid);
+
       if (my_id == 0 && amg_print_level > 1)
       {
          hypre_printf("    Cycle %2d   %e    %f     %e \n", cycle_count,
@@ -316,7 +411,8 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
       }
    }
 
-   if (cycle_count == max_iter && tol > 0.)
+   if (cycle_count == max_iter && tol > 0. &&
+       !(lagged_pending && relative_resid < tol))
    {
       Solve_err_flag = 1;
       hypre_error(HYPRE_ERROR_CONV);
@@ -397,3 +493,244 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGDestroyMultiVec
+ *
+ * Frees the multivector hierarchy used by hypre_BoomerAMGSolveMultiVec.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGDestroyMultiVec( hypre_ParAMGData *amg_data )
+{
+   hypre_ParVector **F_array_mv = hypre_ParAMGDataFArrayMV(amg_data);
+   hypre_ParVector **U_array_mv = hypre_ParAMGDataUArrayMV(amg_data);
+   HYPRE_Int         level;
+
+   /* the arrays are NULL terminated */
+   for (level = 0; F_array_mv && F_array_mv[level]; level++)
+   {
+      hypre_ParVectorDestroy(F_array_mv[level]);
+      hypre_ParVectorDestroy(U_array_mv[level]);
+   }
+   hypre_TFree(F_array_mv, HYPRE_MEMORY_HOST);
+   hypre_TFree(U_array_mv, HYPRE_MEMORY_HOST);
+   hypre_ParVectorDestroy(hypre_ParAMGDataVtempMV(amg_data));
+
+   hypre_ParAMGDataNumVectorsMV(amg_data) = 0;
+   hypre_ParAMGDataFArrayMV(amg_data)     = NULL;
+   hypre_ParAMGDataUArrayMV(amg_data)     = NULL;
+   hypre_ParAMGDataVtempMV(amg_data)      = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------
+ * hypre_BoomerAMGSolveMultiVec
+ *
+ * Solve for a multivector f, u. When the cycle components support it, the
+ * vectors are copied into a row-wise (multivec_storage_method = 1)
+ * hierarchy so that each level's A, P and R are read once per sweep for
+ * all right-hand sides; otherwise the vectors are solved one at a time.
+ * The stopping test then uses the norm over all vectors.
+ *--------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSolveMultiVec( void               *amg_vdata,
+                              hypre_ParCSRMatrix *A,
+                              hypre_ParVector    *f,
+                              hypre_ParVector    *u )
+{
+   hypre_ParAMGData    *amg_data      = (hypre_ParAMGData*) amg_vdata;
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int            num_levels    = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   hypre_ParCSRMatrix **A_array       = hypre_ParAMGDataAArray(amg_data);
+   hypre_Vector        *f_local       = hypre_ParVectorLocalVector(f);
+   hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Int            num_vectors   = hypre_VectorNumVectors(f_local);
+   HYPRE_Int            num_rows      = hypre_VectorSize(f_local);
+   HYPRE_Complex       *f_data        = hypre_VectorData(f_local);
+   HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   HYPRE_Int            f_idxstride   = hypre_VectorIndexStride(f_local);
+   HYPRE_Int            f_vecstride   = hypre_VectorVectorStride(f_local);
+   HYPRE_Int            u_idxstride   = hypre_VectorIndexStride(u_local);
+   HYPRE_Int            u_vecstride   = hypre_VectorVectorStride(u_local);
+   HYPRE_Int            additive      = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int            mult_additive = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int            simple        = hypre_ParAMGDataSimple(amg_data);
+   HYPRE_Int            eligible, level, i, j, k;
+
+   eligible = hypre_GetExecPolicy1(hypre_ParVectorMemoryLocation(u)) == HYPRE_EXEC_HOST &&
+              !hypre_ParAMGDataBlockMode(amg_data) &&
+              (additive      < 0 || additive      >= num_levels) &&
+              (mult_additive < 0 || mult_additive >= num_levels) &&
+              (simple        < 0 || simple        >= num_levels) &&
+              hypre_ParAMGDataSmoothNumLevels(amg_data) == 0 &&
+              !hypre_ParAMGDataParticipate(amg_data) &&
+              hypre_ParAMGDataLogging(amg_data) <= 1 &&
+              hypre_ParAMGDataSinglePrecisionLevel(amg_data) < 0;
+#ifdef HYPRE_USING_DSUPERLU
+   eligible = eligible && hypre_ParAMGDataDSLUSolver(amg_data) == NULL;
+#endif
+   for (k = 1; k < 4 && eligible; k++)
+   {
+      /* a single level applies the user relax type once */
+      HYPRE_Int relax_type = num_levels > 1 ? grid_relax_type[k] :
+                             hypre_ParAMGDataUserRelaxType(amg_data);
+
+      if (relax_type == 15 || relax_type == 16 || relax_type == 17 ||
+          relax_type == 40 || relax_type == 41)
+      {
+         eligible = 0;
+      }
+   }
+
+   if (eligible)
+   {
+      hypre_ParVector **F_array = hypre_ParAMGDataFArray(amg_data);
+      hypre_ParVector **U_array = hypre_ParAMGDataUArray(amg_data);
+      hypre_ParVector  *Vtemp   = hypre_ParAMGDataVtemp(amg_data);
+      hypre_ParVector **F_array_mv, **U_array_mv;
+      HYPRE_Complex    *F_mv_data, *U_mv_data;
+      HYPRE_Int         max_rows = 0;
+
+      if (hypre_ParAMGDataNumVectorsMV(amg_data) != num_vectors)
+      {
+         hypre_BoomerAMGDestroyMultiVec(amg_data);
+
+         F_array_mv = hypre_CTAlloc(hypre_ParVector*, num_levels + 1, HYPRE_MEMORY_HOST);
+         U_array_mv = hypre_CTAlloc(hypre_ParVector*, num_levels + 1, HYPRE_MEMORY_HOST);
+         for (level = 0; level < num_levels; level++)
+         {
+            HYPRE_BigInt  global_size  = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+            HYPRE_BigInt *partitioning = hypre_ParCSRMatrixRowStarts(A_array[level]);
+
+            max_rows = hypre_max(max_rows, hypre_ParCSRMatrixNumRows(A_array[level]));
+
+            F_array_mv[level] = hypre_ParMultiVectorCreate(comm, global_size, partitioning, num_vectors);
+            U_array_mv[level] = hypre_ParMultiVectorCreate(comm, global_size, partitioning, num_vectors);
+            hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(F_array_mv[level])) = 1;
+            hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(U_array_mv[level])) = 1;
+            hypre_ParVectorInitialize_v2(F_array_mv[level], HYPRE_MEMORY_HOST);
+            hypre_ParVectorInitialize_v2(U_array_mv[level], HYPRE_MEMORY_HOST);
+            hypre_ParVectorSetPartitioningOwner(F_array_mv[level], 0);
+            hypre_ParVectorSetPartitioningOwner(U_array_mv[level], 0);
+         }
+
+         /* Vtemp holds one level at a time and is resized by the cycle */
+         hypre_ParAMGDataVtempMV(amg_data) =
+            hypre_ParMultiVectorCreate(comm, hypre_ParVectorGlobalSize(Vtemp),
+                                       hypre_ParVectorPartitioning(Vtemp), num_vectors);
+         hypre_VectorMultiVecStorageMethod(
+            hypre_ParVectorLocalVector(hypre_ParAMGDataVtempMV(amg_data))) = 1;
+         hypre_VectorSize(hypre_ParVectorLocalVector(hypre_ParAMGDataVtempMV(amg_data))) = max_rows;
+         hypre_ParVectorInitialize_v2(hypre_ParAMGDataVtempMV(amg_data), HYPRE_MEMORY_HOST);
+         hypre_ParVectorSetPartitioningOwner(hypre_ParAMGDataVtempMV(amg_data), 0);
+
+         hypre_ParAMGDataFArrayMV(amg_data)     = F_array_mv;
+         hypre_ParAMGDataUArrayMV(amg_data)     = U_array_mv;
+         hypre_ParAMGDataNumVectorsMV(amg_data) = num_vectors;
+      }
+
+      F_array_mv = hypre_ParAMGDataFArrayMV(amg_data);
+      U_array_mv = hypre_ParAMGDataUArrayMV(amg_data);
+      F_mv_data  = hypre_VectorData(hypre_ParVectorLocalVector(F_array_mv[0]));
+      U_mv_data  = hypre_VectorData(hypre_ParVectorLocalVector(U_array_mv[0]));
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (j = 0; j < num_vectors; j++)
+         {
+            F_mv_data[i * num_vectors + j] = f_data[i * f_idxstride + j * f_vecstride];
+            U_mv_data[i * num_vectors + j] = u_data[i * u_idxstride + j * u_vecstride];
+         }
+      }
+
+      hypre_ParAMGDataFArray(amg_data) = F_array_mv;
+      hypre_ParAMGDataUArray(amg_data) = U_array_mv;
+      hypre_ParAMGDataVtemp(amg_data)  = hypre_ParAMGDataVtempMV(amg_data);
+
+      hypre_BoomerAMGSolve(amg_vdata, A, F_array_mv[0], U_array_mv[0]);
+
+      hypre_ParAMGDataFArray(amg_data) = F_array;
+      hypre_ParAMGDataUArray(amg_data) = U_array;
+      hypre_ParAMGDataVtemp(amg_data)  = Vtemp;
+      F_array[0] = f;
+      U_array[0] = u;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (j = 0; j < num_vectors; j++)
+         {
+            u_data[i * u_idxstride + j * u_vecstride] = U_mv_data[i * num_vectors + j];
+         }
+      }
+   }
+   else
+   {
+      HYPRE_BigInt     global_size  = hypre_ParVectorGlobalSize(f);
+      HYPRE_BigInt    *partitioning = hypre_ParVectorPartitioning(f);
+      HYPRE_MemoryLocation memory_location = hypre_ParVectorMemoryLocation(u);
+      hypre_ParVector *f_j, *u_j;
+      HYPRE_Complex   *f_j_data, *u_j_data;
+
+      f_j = hypre_ParVectorCreate(comm, global_size, partitioning);
+      u_j = hypre_ParVectorCreate(comm, global_size, partitioning);
+      hypre_ParVectorInitialize_v2(f_j, memory_location);
+      hypre_ParVectorInitialize_v2(u_j, memory_location);
+      hypre_ParVectorSetPartitioningOwner(f_j, 0);
+      hypre_ParVectorSetPartitioningOwner(u_j, 0);
+      f_j_data = hypre_VectorData(hypre_ParVectorLocalVector(f_j));
+      u_j_data = hypre_VectorData(hypre_ParVectorLocalVector(u_j));
+
+      for (j = 0; j < num_vectors; j++)
+      {
+         /* column storage is contiguous per vector, row storage is not */
+         if (f_idxstride == 1 && u_idxstride == 1)
+         {
+            hypre_TMemcpy(f_j_data, f_data + j * f_vecstride, HYPRE_Complex, num_rows,
+                          memory_location, hypre_ParVectorMemoryLocation(f));
+            hypre_TMemcpy(u_j_data, u_data + j * u_vecstride, HYPRE_Complex, num_rows,
+                          memory_location, memory_location);
+         }
+         else
+         {
+            for (i = 0; i < num_rows; i++)
+            {
+               f_j_data[i] = f_data[i * f_idxstride + j * f_vecstride];
+               u_j_data[i] = u_data[i * u_idxstride + j * u_vecstride];
+            }
+         }
+
+         hypre_BoomerAMGSolve(amg_vdata, A, f_j, u_j);
+
+         if (u_idxstride == 1)
+         {
+            hypre_TMemcpy(u_data + j * u_vecstride, u_j_data, HYPRE_Complex, num_rows,
+                          memory_location, memory_location);
+         }
+         else
+         {
+            for (i = 0; i < num_rows; i++)
+            {
+               u_data[i * u_idxstride + j * u_vecstride] = u_j_data[i];
+            }
+         }
+      }
+
+      hypre_ParAMGDataFArray(amg_data)[0] = f;
+      hypre_ParAMGDataUArray(amg_data)[0] = u;
+
+      hypre_ParVectorDestroy(f_j);
+      hypre_ParVectorDestroy(u_j);
+   }
+
+   return hypre_error_flag;
+}
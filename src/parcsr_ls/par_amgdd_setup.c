@@ -66,6 +66,8 @@ hypre_BoomerAMGDDSetup( void               *amgdd_vdata,
    // If the underlying AMG data structure has not yet been set up, call BoomerAMGSetup()
    if (!hypre_ParAMGDataAArray(amg_data))
    {
+      /* the composite grids copy the values of the hierarchy */
+      hypre_ParAMGDataSinglePrecisionLevel(amg_data) = -1;
       hypre_BoomerAMGSetup((void*) amg_data, A, b, x);
    }
 
@@ -0,0 +1,900 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Block PCG for multiple right-hand sides
+ *
+ * All k right-hand sides share one search space.  With P the current block
+ * of search directions (s <= k columns):
+ *
+ *    Q     = A P
+ *    alpha = (P^T Q)^{-1} (P^T R),   X = X + P alpha,   R = R - Q alpha
+ *    Z     = M R
+ *    beta  = -(P^T Q)^{-1} (Q^T Z)
+ *    P     = orth(Z + P beta)
+ *
+ * orth() is a Cholesky QR of the diagonally scaled Gram matrix with
+ * symmetric pivoting; directions whose pivot falls below rank_tol are
+ * numerically dependent on the ones already kept and are dropped, so the
+ * block size shrinks instead of the iteration breaking down (Ji and Li,
+ * "A breakdown-free block conjugate gradient method", BIT 2017).
+ *
+ * Each iteration does one block matvec, k preconditioner applications
+ * (or one, if the preconditioner accepts multivectors) and three global
+ * reductions of small dense blocks.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_block_pcg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGColumnView
+ *
+ * ParVector wrapping column j of a column-wise multivector.  The view
+ * shares the data and the partitioning of v and owns neither.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParVector *
+hypre_ParBlockPCGColumnView( hypre_ParVector *v,
+                             HYPRE_Int        j )
+{
+   hypre_Vector    *v_local = hypre_ParVectorLocalVector(v);
+   hypre_ParVector *view;
+   hypre_Vector    *view_local;
+
+   view = hypre_ParVectorCreate(hypre_ParVectorComm(v),
+                                hypre_ParVectorGlobalSize(v),
+                                hypre_ParVectorPartitioning(v));
+   hypre_ParVectorSetPartitioningOwner(view, 0);
+
+   view_local = hypre_ParVectorLocalVector(view);
+   hypre_VectorData(view_local) = hypre_VectorData(v_local) + j * hypre_VectorVectorStride(v_local);
+   hypre_VectorOwnsData(view_local) = 0;
+   hypre_VectorMemoryLocation(view_local) = hypre_VectorMemoryLocation(v_local);
+   hypre_ParVectorActualLocalSize(view) = hypre_VectorSize(view_local);
+
+   return view;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGLocalColumns
+ *
+ * Seq vector views of the first num_vectors columns of v.  The views are
+ * contiguous in memory, as required by the Mass* kernels.
+ *--------------------------------------------------------------------------*/
+
+static hypre_Vector **
+hypre_ParBlockPCGLocalColumns( hypre_ParVector *v,
+                               HYPRE_Int        num_vectors )
+{
+   hypre_Vector  *v_local = hypre_ParVectorLocalVector(v);
+   HYPRE_Int      size    = hypre_VectorSize(v_local);
+   hypre_Vector **cols;
+   HYPRE_Int      j;
+
+   cols = hypre_TAlloc(hypre_Vector *, num_vectors, HYPRE_MEMORY_HOST);
+   for (j = 0; j < num_vectors; j++)
+   {
+      cols[j] = hypre_SeqVectorCreate(size);
+      hypre_VectorData(cols[j]) = hypre_VectorData(v_local) + j * hypre_VectorVectorStride(v_local);
+      hypre_VectorOwnsData(cols[j]) = 0;
+      hypre_VectorMemoryLocation(cols[j]) = hypre_VectorMemoryLocation(v_local);
+   }
+
+   return cols;
+}
+
+static void
+hypre_ParBlockPCGDestroyLocalColumns( hypre_Vector **cols,
+                                      HYPRE_Int      num_vectors )
+{
+   HYPRE_Int j;
+
+   if (cols)
+   {
+      for (j = 0; j < num_vectors; j++)
+      {
+         hypre_SeqVectorDestroy(cols[j]);
+      }
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGLocalGram
+ *
+ * result[a*ny+b] = <x[a],y[b]> restricted to the local rows.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParBlockPCGLocalGram( hypre_Vector **x,
+                            HYPRE_Int      nx,
+                            hypre_Vector **y,
+                            HYPRE_Int      ny,
+                            HYPRE_Real    *result )
+{
+   HYPRE_Int a;
+
+   for (a = 0; a < nx; a++)
+   {
+      hypre_SeqVectorMassInnerProd(x[a], y, ny, 4, &result[a*ny]);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGAllreduce
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParBlockPCGAllreduce( MPI_Comm    comm,
+                            HYPRE_Real *local,
+                            HYPRE_Real *global,
+                            HYPRE_Int   n )
+{
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local, global, n, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGCholesky
+ *
+ * In-place Cholesky factorization of the s x s SPD matrix M (row-major,
+ * lower triangle used).  Returns 1 if M is not numerically SPD.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParBlockPCGCholesky( HYPRE_Real *M,
+                           HYPRE_Int   s )
+{
+   HYPRE_Int  i, j, l;
+   HYPRE_Real sum;
+
+   for (j = 0; j < s; j++)
+   {
+      sum = M[j*s+j];
+      for (l = 0; l < j; l++)
+      {
+         sum -= M[j*s+l] * M[j*s+l];
+      }
+      if (sum <= 0.0)
+      {
+         return 1;
+      }
+      M[j*s+j] = sqrt(sum);
+      for (i = j+1; i < s; i++)
+      {
+         sum = M[i*s+j];
+         for (l = 0; l < j; l++)
+         {
+            sum -= M[i*s+l] * M[j*s+l];
+         }
+         M[i*s+j] = sum / M[j*s+j];
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGCholeskySolve
+ *
+ * Overwrite the s x k block C (row-major) with L^{-T} L^{-1} C, where L is
+ * the factor computed by hypre_ParBlockPCGCholesky.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParBlockPCGCholeskySolve( HYPRE_Real *L,
+                                HYPRE_Int   s,
+                                HYPRE_Real *C,
+                                HYPRE_Int   k )
+{
+   HYPRE_Int i, j, l;
+
+   for (j = 0; j < k; j++)
+   {
+      for (i = 0; i < s; i++)
+      {
+         for (l = 0; l < i; l++)
+         {
+            C[i*k+j] -= L[i*s+l] * C[l*k+j];
+         }
+         C[i*k+j] /= L[i*s+i];
+      }
+      for (i = s-1; i >= 0; i--)
+      {
+         for (l = i+1; l < s; l++)
+         {
+            C[i*k+j] -= L[l*s+i] * C[l*k+j];
+         }
+         C[i*k+j] /= L[i*s+i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGUpdate
+ *
+ * y[j] += sign * sum_a x[a] C[a*k+j] for j < k, where x has s columns.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParBlockPCGUpdate( hypre_Vector **x,
+                         HYPRE_Int      s,
+                         HYPRE_Real    *C,
+                         HYPRE_Real     sign,
+                         hypre_Vector **y,
+                         HYPRE_Int      k,
+                         HYPRE_Real    *coef )
+{
+   HYPRE_Int a, j;
+
+   for (j = 0; j < k; j++)
+   {
+      for (a = 0; a < s; a++)
+      {
+         coef[a] = sign * C[a*k+j];
+      }
+      hypre_SeqVectorMassAxpy(coef, x, y[j], s, 4);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGOrthonormalize
+ *
+ * Overwrite the leading columns of p with an orthonormal basis of the
+ * numerically independent part of the k columns w, and return its size.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParBlockPCGOrthonormalize( MPI_Comm       comm,
+                                 hypre_Vector **w,
+                                 hypre_Vector **p,
+                                 HYPRE_Int      k,
+                                 HYPRE_Real     rank_tol,
+                                 HYPRE_Real    *G,
+                                 HYPRE_Real    *work )
+{
+   HYPRE_Real *d    = work;
+   HYPRE_Real *coef = work + k;
+   HYPRE_Int  *piv;
+   HYPRE_Int   i, j, l, m, s;
+   HYPRE_Real  tmp;
+
+   hypre_ParBlockPCGLocalGram(w, k, w, k, coef);
+   hypre_ParBlockPCGAllreduce(comm, coef, G, k*k);
+
+   /* scale to unit diagonal; zero columns are never selected as pivots */
+   for (i = 0; i < k; i++)
+   {
+      d[i] = (G[i*k+i] > 0.0) ? sqrt(G[i*k+i]) : 0.0;
+   }
+   for (i = 0; i < k; i++)
+   {
+      for (j = 0; j < k; j++)
+      {
+         G[i*k+j] = (d[i] > 0.0 && d[j] > 0.0) ? G[i*k+j] / (d[i]*d[j]) : 0.0;
+      }
+   }
+
+   /* Cholesky with symmetric pivoting, stopped at the first pivot below
+      rank_tol; afterwards G[piv] = L L^T on the leading s x s block */
+   piv = hypre_TAlloc(HYPRE_Int, k, HYPRE_MEMORY_HOST);
+   for (i = 0; i < k; i++)
+   {
+      piv[i] = i;
+   }
+   for (s = 0; s < k; s++)
+   {
+      m = s;
+      for (i = s+1; i < k; i++)
+      {
+         if (G[i*k+i] > G[m*k+m])
+         {
+            m = i;
+         }
+      }
+      if (G[m*k+m] <= rank_tol)
+      {
+         break;
+      }
+      if (m != s)
+      {
+         for (j = 0; j < k; j++)
+         {
+            tmp = G[s*k+j]; G[s*k+j] = G[m*k+j]; G[m*k+j] = tmp;
+         }
+         for (i = 0; i < k; i++)
+         {
+            tmp = G[i*k+s]; G[i*k+s] = G[i*k+m]; G[i*k+m] = tmp;
+         }
+         l = piv[s]; piv[s] = piv[m]; piv[m] = l;
+      }
+      G[s*k+s] = sqrt(G[s*k+s]);
+      for (i = s+1; i < k; i++)
+      {
+         G[i*k+s] /= G[s*k+s];
+      }
+      for (i = s+1; i < k; i++)
+      {
+         for (j = s+1; j <= i; j++)
+         {
+            G[i*k+j] -= G[i*k+s] * G[j*k+s];
+            G[j*k+i]  = G[i*k+j];
+         }
+      }
+   }
+
+   /* p[l] = (w[piv[l]]/d[piv[l]] - sum_{m<l} L[l][m] p[m]) / L[l][l] */
+   for (l = 0; l < s; l++)
+   {
+      hypre_SeqVectorCopy(w[piv[l]], p[l]);
+      if (l > 0)
+      {
+         for (m = 0; m < l; m++)
+         {
+            coef[m] = -G[l*k+m] * d[piv[l]];
+         }
+         hypre_SeqVectorMassAxpy(coef, p, p[l], l, 4);
+      }
+      hypre_SeqVectorScale(1.0 / (d[piv[l]] * G[l*k+l]), p[l]);
+   }
+
+   hypre_TFree(piv, HYPRE_MEMORY_HOST);
+
+   return s;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ParBlockPCGCreate( void )
+{
+   hypre_ParBlockPCGData *block_pcg_data;
+
+   block_pcg_data = hypre_CTAlloc(hypre_ParBlockPCGData, 1, HYPRE_MEMORY_HOST);
+
+   /* set defaults */
+   (block_pcg_data -> tol)              = 1.0e-06;
+   (block_pcg_data -> a_tol)            = 0.0;
+   (block_pcg_data -> rank_tol)         = 1.0e-10;
+   (block_pcg_data -> max_iter)         = 1000;
+   (block_pcg_data -> precond_multivec) = 0;
+   (block_pcg_data -> precond)          = NULL;
+   (block_pcg_data -> precond_setup)    = NULL;
+   (block_pcg_data -> precond_data)     = NULL;
+   (block_pcg_data -> print_level)      = 0;
+   (block_pcg_data -> logging)          = 0;
+   (block_pcg_data -> num_vectors)      = 0;
+
+   return (void *) block_pcg_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGDestroyWorkspace
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParBlockPCGDestroyWorkspace( hypre_ParBlockPCGData *block_pcg_data )
+{
+   HYPRE_Int k = (block_pcg_data -> num_vectors);
+   HYPRE_Int j;
+
+   if ((block_pcg_data -> r_cols))
+   {
+      for (j = 0; j < k; j++)
+      {
+         hypre_ParVectorDestroy((block_pcg_data -> r_cols)[j]);
+         hypre_ParVectorDestroy((block_pcg_data -> z_cols)[j]);
+      }
+      hypre_TFree((block_pcg_data -> r_cols), HYPRE_MEMORY_HOST);
+      hypre_TFree((block_pcg_data -> z_cols), HYPRE_MEMORY_HOST);
+   }
+   hypre_ParBlockPCGDestroyLocalColumns((block_pcg_data -> p_local_cols), k);
+   hypre_ParBlockPCGDestroyLocalColumns((block_pcg_data -> q_local_cols), k);
+   hypre_ParVectorDestroy((block_pcg_data -> r));
+   hypre_ParVectorDestroy((block_pcg_data -> z));
+   hypre_ParVectorDestroy((block_pcg_data -> p));
+   hypre_ParVectorDestroy((block_pcg_data -> q));
+
+   (block_pcg_data -> r_cols)       = NULL;
+   (block_pcg_data -> z_cols)       = NULL;
+   (block_pcg_data -> p_local_cols) = NULL;
+   (block_pcg_data -> q_local_cols) = NULL;
+   (block_pcg_data -> r)            = NULL;
+   (block_pcg_data -> z)            = NULL;
+   (block_pcg_data -> p)            = NULL;
+   (block_pcg_data -> q)            = NULL;
+   (block_pcg_data -> num_vectors)  = 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParBlockPCGDestroy( void *block_pcg_vdata )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   if (block_pcg_data)
+   {
+      hypre_ParBlockPCGDestroyWorkspace(block_pcg_data);
+      hypre_TFree(block_pcg_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParBlockPCGSetup( void               *block_pcg_vdata,
+                        hypre_ParCSRMatrix *A,
+                        hypre_ParVector    *b,
+                        hypre_ParVector    *x )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+   MPI_Comm               comm           = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt           global_size    = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt          *row_starts     = hypre_ParCSRMatrixRowStarts(A);
+   HYPRE_Int              k              = hypre_ParVectorNumVectors(b);
+   hypre_ParVector       *r;
+   hypre_ParVector      **work[4];
+   HYPRE_Int              i, j;
+
+   if (hypre_VectorIndexStride(hypre_ParVectorLocalVector(b)) != 1 ||
+       hypre_ParVectorNumVectors(x) != k)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Block PCG needs column-wise multivectors b and x of equal width\n");
+      return hypre_error_flag;
+   }
+
+   (block_pcg_data -> A) = A;
+
+   /* the workspace borrows the row partitioning of A, so rebuild it whenever
+      A comes with a different size or layout, not only a different width */
+   r = (block_pcg_data -> r);
+   if ((block_pcg_data -> num_vectors) != k ||
+       hypre_ParVectorPartitioning(r) != row_starts ||
+       hypre_ParVectorGlobalSize(r)   != global_size ||
+       hypre_ParVectorFirstIndex(r)   != row_starts[0] ||
+       hypre_ParVectorLastIndex(r)    != row_starts[1] - 1)
+   {
+      hypre_ParBlockPCGDestroyWorkspace(block_pcg_data);
+
+      work[0] = &(block_pcg_data -> r);
+      work[1] = &(block_pcg_data -> z);
+      work[2] = &(block_pcg_data -> p);
+      work[3] = &(block_pcg_data -> q);
+      for (i = 0; i < 4; i++)
+      {
+         *work[i] = hypre_ParMultiVectorCreate(comm, global_size, row_starts, k);
+         hypre_ParVectorInitialize(*work[i]);
+         hypre_ParVectorSetPartitioningOwner(*work[i], 0);
+      }
+
+      (block_pcg_data -> r_cols) = hypre_TAlloc(hypre_ParVector *, k, HYPRE_MEMORY_HOST);
+      (block_pcg_data -> z_cols) = hypre_TAlloc(hypre_ParVector *, k, HYPRE_MEMORY_HOST);
+      for (j = 0; j < k; j++)
+      {
+         (block_pcg_data -> r_cols)[j] = hypre_ParBlockPCGColumnView((block_pcg_data -> r), j);
+         (block_pcg_data -> z_cols)[j] = hypre_ParBlockPCGColumnView((block_pcg_data -> z), j);
+      }
+      (block_pcg_data -> p_local_cols) = hypre_ParBlockPCGLocalColumns((block_pcg_data -> p), k);
+      (block_pcg_data -> q_local_cols) = hypre_ParBlockPCGLocalColumns((block_pcg_data -> q), k);
+      (block_pcg_data -> num_vectors)  = k;
+   }
+
+   if ((block_pcg_data -> precond_setup))
+   {
+      if ((block_pcg_data -> precond_multivec))
+      {
+         (block_pcg_data -> precond_setup)((block_pcg_data -> precond_data),
+                                           (HYPRE_ParCSRMatrix) A,
+                                           (HYPRE_ParVector) b, (HYPRE_ParVector) x);
+      }
+      else
+      {
+         /* the setup only needs vectors of the right layout */
+         (block_pcg_data -> precond_setup)((block_pcg_data -> precond_data),
+                                           (HYPRE_ParCSRMatrix) A,
+                                           (HYPRE_ParVector) (block_pcg_data -> r_cols)[0],
+                                           (HYPRE_ParVector) (block_pcg_data -> z_cols)[0]);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGPrecond
+ *
+ * z = M r for all k columns.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParBlockPCGPrecond( hypre_ParBlockPCGData *block_pcg_data )
+{
+   hypre_ParCSRMatrix *A = (block_pcg_data -> A);
+   HYPRE_Int           k = (block_pcg_data -> num_vectors);
+   HYPRE_Int           j;
+
+   if (!(block_pcg_data -> precond))
+   {
+      hypre_ParVectorCopy((block_pcg_data -> r), (block_pcg_data -> z));
+      return;
+   }
+
+   hypre_ParVectorSetConstantValues((block_pcg_data -> z), 0.0);
+   if ((block_pcg_data -> precond_multivec))
+   {
+      (block_pcg_data -> precond)((block_pcg_data -> precond_data), (HYPRE_ParCSRMatrix) A,
+                                  (HYPRE_ParVector) (block_pcg_data -> r),
+                                  (HYPRE_ParVector) (block_pcg_data -> z));
+   }
+   else
+   {
+      for (j = 0; j < k; j++)
+      {
+         (block_pcg_data -> precond)((block_pcg_data -> precond_data), (HYPRE_ParCSRMatrix) A,
+                                     (HYPRE_ParVector) (block_pcg_data -> r_cols)[j],
+                                     (HYPRE_ParVector) (block_pcg_data -> z_cols)[j]);
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParBlockPCGSolve( void               *block_pcg_vdata,
+                        hypre_ParCSRMatrix *A,
+                        hypre_ParVector    *b,
+                        hypre_ParVector    *x )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+   MPI_Comm               comm           = hypre_ParCSRMatrixComm(A);
+
+   HYPRE_Real             tol            = (block_pcg_data -> tol);
+   HYPRE_Real             a_tol          = (block_pcg_data -> a_tol);
+   HYPRE_Real             rank_tol       = (block_pcg_data -> rank_tol);
+   HYPRE_Int              max_iter       = (block_pcg_data -> max_iter);
+   HYPRE_Int              print_level    = (block_pcg_data -> print_level);
+   HYPRE_Int              k              = (block_pcg_data -> num_vectors);
+
+   hypre_ParVector       *r              = (block_pcg_data -> r);
+   hypre_ParVector       *p              = (block_pcg_data -> p);
+   hypre_ParVector       *q              = (block_pcg_data -> q);
+   hypre_Vector         **p_cols         = (block_pcg_data -> p_local_cols);
+   hypre_Vector         **q_cols         = (block_pcg_data -> q_local_cols);
+   hypre_Vector         **r_cols;
+   hypre_Vector         **z_cols;
+   hypre_Vector         **b_cols;
+   hypre_Vector         **x_cols;
+
+   HYPRE_Real            *local, *global, *PtQ, *C, *G, *work;
+   HYPRE_Real            *b_norm, *r_norm, *eps;
+   HYPRE_Real             rel_norm, max_rel_norm;
+   HYPRE_Int              converged, iter, s, i, j;
+   HYPRE_Int              my_id;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (k < 1 || hypre_ParVectorNumVectors(b) != k || hypre_ParVectorNumVectors(x) != k)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Block PCG: call Setup with this b and x first\n");
+      return hypre_error_flag;
+   }
+
+   r_cols = hypre_ParBlockPCGLocalColumns(r, k);
+   z_cols = hypre_ParBlockPCGLocalColumns((block_pcg_data -> z), k);
+   b_cols = hypre_ParBlockPCGLocalColumns(b, k);
+   x_cols = hypre_ParBlockPCGLocalColumns(x, k);
+
+   local  = hypre_CTAlloc(HYPRE_Real, 2*k*k + 2*k, HYPRE_MEMORY_HOST);
+   global = hypre_CTAlloc(HYPRE_Real, 2*k*k + 2*k, HYPRE_MEMORY_HOST);
+   PtQ    = hypre_CTAlloc(HYPRE_Real, k*k, HYPRE_MEMORY_HOST);
+   C      = hypre_CTAlloc(HYPRE_Real, k*k, HYPRE_MEMORY_HOST);
+   G      = hypre_CTAlloc(HYPRE_Real, k*k, HYPRE_MEMORY_HOST);
+   work   = hypre_CTAlloc(HYPRE_Real, k*k + k, HYPRE_MEMORY_HOST);
+   b_norm = hypre_CTAlloc(HYPRE_Real, k, HYPRE_MEMORY_HOST);
+   r_norm = hypre_CTAlloc(HYPRE_Real, k, HYPRE_MEMORY_HOST);
+   eps    = hypre_CTAlloc(HYPRE_Real, k, HYPRE_MEMORY_HOST);
+
+   /* R = B - A X */
+   hypre_ParVectorCopy(b, r);
+   hypre_ParCSRMatrixMatvec(-1.0, A, x, 1.0, r);
+
+   for (j = 0; j < k; j++)
+   {
+      local[j]   = hypre_SeqVectorInnerProd(b_cols[j], b_cols[j]);
+      local[k+j] = hypre_SeqVectorInnerProd(r_cols[j], r_cols[j]);
+   }
+   hypre_ParBlockPCGAllreduce(comm, local, global, 2*k);
+
+   converged = 1;
+   max_rel_norm = 0.0;
+   for (j = 0; j < k; j++)
+   {
+      b_norm[j] = sqrt(global[j]);
+      r_norm[j] = sqrt(global[k+j]);
+      if (b_norm[j] == 0.0)
+      {
+         /* relative to the initial residual, as for a zero rhs in PCG */
+         b_norm[j] = r_norm[j];
+      }
+      eps[j] = hypre_max(tol * b_norm[j], a_tol);
+      converged = converged && (r_norm[j] <= eps[j]);
+      rel_norm = (b_norm[j] > 0.0) ? r_norm[j] / b_norm[j] : 0.0;
+      max_rel_norm = hypre_max(max_rel_norm, rel_norm);
+   }
+
+   if (print_level > 1 && my_id == 0)
+   {
+      hypre_printf("Block PCG with %d right-hand sides\n", k);
+      hypre_printf("Iters  block size  max ||r||_2/||b||_2\n");
+      hypre_printf("-----  ----------  -------------------\n");
+      hypre_printf("%5d  %10d  %e\n", 0, k, max_rel_norm);
+   }
+
+   iter = 0;
+   s    = 0;
+   if (!converged)
+   {
+      /* P = orth(M R) */
+      hypre_ParBlockPCGPrecond(block_pcg_data);
+      s = hypre_ParBlockPCGOrthonormalize(comm, z_cols, p_cols, k, rank_tol, G, work);
+   }
+
+   while (!converged && s > 0 && iter < max_iter)
+   {
+      iter++;
+
+      /* Q = A P on the s active columns */
+      hypre_VectorNumVectors(hypre_ParVectorLocalVector(p)) = s;
+      hypre_VectorNumVectors(hypre_ParVectorLocalVector(q)) = s;
+      hypre_ParCSRMatrixMatvec(1.0, A, p, 0.0, q);
+
+      /* one reduction for P^T Q (s x s) and P^T R (s x k) */
+      hypre_ParBlockPCGLocalGram(p_cols, s, q_cols, s, local);
+      hypre_ParBlockPCGLocalGram(p_cols, s, r_cols, k, local + s*s);
+      hypre_ParBlockPCGAllreduce(comm, local, global, s*s + s*k);
+
+      hypre_TMemcpy(PtQ, global, HYPRE_Real, s*s, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      if (hypre_ParBlockPCGCholesky(PtQ, s))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Block PCG: P^T A P is not positive definite\n");
+         break;
+      }
+
+      /* alpha = (P^T Q)^{-1} P^T R;  X += P alpha;  R -= Q alpha */
+      hypre_TMemcpy(C, global + s*s, HYPRE_Real, s*k, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_ParBlockPCGCholeskySolve(PtQ, s, C, k);
+      hypre_ParBlockPCGUpdate(p_cols, s, C,  1.0, x_cols, k, work);
+      hypre_ParBlockPCGUpdate(q_cols, s, C, -1.0, r_cols, k, work);
+
+      hypre_ParBlockPCGPrecond(block_pcg_data);
+
+      /* one reduction for Q^T Z (s x k) and the residual norms */
+      hypre_ParBlockPCGLocalGram(q_cols, s, z_cols, k, local);
+      for (j = 0; j < k; j++)
+      {
+         local[s*k+j] = hypre_SeqVectorInnerProd(r_cols[j], r_cols[j]);
+      }
+      hypre_ParBlockPCGAllreduce(comm, local, global, s*k + k);
+
+      converged = 1;
+      max_rel_norm = 0.0;
+      for (j = 0; j < k; j++)
+      {
+         r_norm[j] = sqrt(global[s*k+j]);
+         converged = converged && (r_norm[j] <= eps[j]);
+         rel_norm = (b_norm[j] > 0.0) ? r_norm[j] / b_norm[j] : 0.0;
+         max_rel_norm = hypre_max(max_rel_norm, rel_norm);
+      }
+
+      if (print_level > 1 && my_id == 0)
+      {
+         hypre_printf("%5d  %10d  %e\n", iter, s, max_rel_norm);
+      }
+
+      if (converged)
+      {
+         break;
+      }
+
+      /* P = orth(Z + P beta) with beta = -(P^T Q)^{-1} Q^T Z */
+      for (i = 0; i < s*k; i++)
+      {
+         C[i] = global[i];
+      }
+      hypre_ParBlockPCGCholeskySolve(PtQ, s, C, k);
+      hypre_ParBlockPCGUpdate(p_cols, s, C, -1.0, z_cols, k, work);
+
+      s = hypre_ParBlockPCGOrthonormalize(comm, z_cols, p_cols, k, rank_tol, G, work);
+   }
+
+   hypre_VectorNumVectors(hypre_ParVectorLocalVector(p)) = k;
+   hypre_VectorNumVectors(hypre_ParVectorLocalVector(q)) = k;
+
+   (block_pcg_data -> num_iterations)    = iter;
+   (block_pcg_data -> block_size)        = s;
+   (block_pcg_data -> rel_residual_norm) = max_rel_norm;
+
+   if (!converged && hypre_error_flag == 0)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_ParBlockPCGDestroyLocalColumns(r_cols, k);
+   hypre_ParBlockPCGDestroyLocalColumns(z_cols, k);
+   hypre_ParBlockPCGDestroyLocalColumns(b_cols, k);
+   hypre_ParBlockPCGDestroyLocalColumns(x_cols, k);
+   hypre_TFree(local,  HYPRE_MEMORY_HOST);
+   hypre_TFree(global, HYPRE_MEMORY_HOST);
+   hypre_TFree(PtQ,    HYPRE_MEMORY_HOST);
+   hypre_TFree(C,      HYPRE_MEMORY_HOST);
+   hypre_TFree(G,      HYPRE_MEMORY_HOST);
+   hypre_TFree(work,   HYPRE_MEMORY_HOST);
+   hypre_TFree(b_norm, HYPRE_MEMORY_HOST);
+   hypre_TFree(r_norm, HYPRE_MEMORY_HOST);
+   hypre_TFree(eps,    HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Set/Get routines
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParBlockPCGSetTol( void       *block_pcg_vdata,
+                         HYPRE_Real  tol )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   if (tol < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (block_pcg_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParBlockPCGSetAbsoluteTol( void       *block_pcg_vdata,
+                                 HYPRE_Real  a_tol )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   if (a_tol < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (block_pcg_data -> a_tol) = a_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParBlockPCGSetRankTol( void       *block_pcg_vdata,
+                             HYPRE_Real  rank_tol )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   if (rank_tol < 0.0 || rank_tol >= 1.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (block_pcg_data -> rank_tol) = rank_tol;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParBlockPCGSetMaxIter( void      *block_pcg_vdata,
+                             HYPRE_Int  max_iter )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   if (max_iter < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (block_pcg_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParBlockPCGSetPrecond( void                    *block_pcg_vdata,
+                             HYPRE_PtrToParSolverFcn  precond,
+                             HYPRE_PtrToParSolverFcn  precond_setup,
+                             HYPRE_Solver             precond_data )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   (block_pcg_data -> precond)       = precond;
+   (block_pcg_data -> precond_setup) = precond_setup;
+   (block_pcg_data -> precond_data)  = precond_data;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParBlockPCGSetPrecondMultivec( void      *block_pcg_vdata,
+                                     HYPRE_Int  precond_multivec )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   (block_pcg_data -> precond_multivec) = precond_multivec;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParBlockPCGSetPrintLevel( void      *block_pcg_vdata,
+                                HYPRE_Int  print_level )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   (block_pcg_data -> print_level) = print_level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParBlockPCGSetLogging( void      *block_pcg_vdata,
+                             HYPRE_Int  logging )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   (block_pcg_data -> logging) = logging;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParBlockPCGGetNumIterations( void      *block_pcg_vdata,
+                                   HYPRE_Int *num_iterations )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   *num_iterations = (block_pcg_data -> num_iterations);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParBlockPCGGetFinalRelativeResidualNorm( void       *block_pcg_vdata,
+                                               HYPRE_Real *relative_residual_norm )
+{
+   hypre_ParBlockPCGData *block_pcg_data = (hypre_ParBlockPCGData *) block_pcg_vdata;
+
+   *relative_residual_norm = (block_pcg_data -> rel_residual_norm);
+
+   return hypre_error_flag;
+}
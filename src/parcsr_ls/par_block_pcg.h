@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#ifndef hypre_PAR_BLOCK_PCG_HEADER
+#define hypre_PAR_BLOCK_PCG_HEADER
+
+/*--------------------------------------------------------------------------
+ * hypre_ParBlockPCGData
+ *
+ * Block preconditioned conjugate gradient for k right-hand sides stored in
+ * one (column-wise) multivector.  All k systems share a single Krylov
+ * search space, so the matvec and the inner products act on blocks of
+ * vectors, and the search directions are re-orthonormalized every iteration
+ * with a rank-revealing Cholesky so linearly dependent directions are
+ * dropped instead of causing breakdown.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Real            tol;
+   HYPRE_Real            a_tol;
+   HYPRE_Real            rank_tol;
+   HYPRE_Int             max_iter;
+   HYPRE_Int             precond_multivec;
+
+   hypre_ParCSRMatrix   *A;
+   HYPRE_Int             num_vectors;
+   hypre_ParVector      *r;
+   hypre_ParVector      *z;
+   hypre_ParVector      *p;
+   hypre_ParVector      *q;
+
+   /* non-owning views of the individual columns of r, z, p and q */
+   hypre_ParVector     **r_cols;
+   hypre_ParVector     **z_cols;
+   hypre_Vector        **p_local_cols;
+   hypre_Vector        **q_local_cols;
+
+   HYPRE_PtrToParSolverFcn precond;
+   HYPRE_PtrToParSolverFcn precond_setup;
+   HYPRE_Solver          precond_data;
+
+   /* log info */
+   HYPRE_Int             num_iterations;
+   HYPRE_Int             block_size;
+   HYPRE_Real            rel_residual_norm;
+   HYPRE_Int             print_level;
+   HYPRE_Int             logging;
+
+} hypre_ParBlockPCGData;
+
+#define hypre_ParBlockPCGDataTol(data)              ((data) -> tol)
+#define hypre_ParBlockPCGDataAbsoluteTol(data)      ((data) -> a_tol)
+#define hypre_ParBlockPCGDataRankTol(data)          ((data) -> rank_tol)
+#define hypre_ParBlockPCGDataMaxIter(data)          ((data) -> max_iter)
+#define hypre_ParBlockPCGDataPrecondMultivec(data)  ((data) -> precond_multivec)
+#define hypre_ParBlockPCGDataA(data)                ((data) -> A)
+#define hypre_ParBlockPCGDataNumVectors(data)       ((data) -> num_vectors)
+#define hypre_ParBlockPCGDataNumIterations(data)    ((data) -> num_iterations)
+#define hypre_ParBlockPCGDataBlockSize(data)        ((data) -> block_size)
+#define hypre_ParBlockPCGDataRelResidualNorm(data)  ((data) -> rel_residual_norm)
+#define hypre_ParBlockPCGDataPrintLevel(data)       ((data) -> print_level)
+#define hypre_ParBlockPCGDataLogging(data)          ((data) -> logging)
+
+#endif
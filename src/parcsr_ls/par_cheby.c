@@ -343,3 +343,485 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to rela
    return hypre_error_flag;
 }
 
+
+/******************************************************************************
+
+Communication-avoiding Chebyshev relaxation
+
+The polynomial p(A) of degree order-1 applied to the residual needs order
+matvecs, i.e. order halo exchanges in hypre_ParCSRRelax_Cheby_Solve.  Here the
+rows within distance order-1 of the local rows (in the graph of A) are fetched
+once in the setup, so that one exchange of u and f on a ghost layer of depth
+order per application is enough.  The matvecs are then done locally on the
+extended matrix, with the ghost rows computed redundantly; the number of
+valid rows shrinks by one layer per matvec.
+
+The extended numbering is: local rows first, then the ghost points of
+distance 1 (in the order of col_map_offd), distance 2, ...
+
+*****************************************************************************/
+
+typedef struct
+{
+   HYPRE_Int             depth;          /* number of ghost layers */
+   HYPRE_Int            *layer_ptr;      /* layer d is [layer_ptr[d], layer_ptr[d+1]) */
+   hypre_CSRMatrix      *A_ext;          /* rows of layers 0..depth-1 */
+   hypre_ParCSRCommPkg  *comm_pkg;       /* fetches all ghost points at once */
+   HYPRE_Int            *recv_map;       /* recv buffer position -> extended index */
+   HYPRE_Real           *ds_ext;         /* scaling on layers 0..depth-1 */
+   HYPRE_Real           *u_ext;
+   HYPRE_Real           *f_ext;
+   HYPRE_Real           *r_ext;
+   HYPRE_Real           *w_ext;
+   HYPRE_Real           *v_ext;
+   HYPRE_Real           *send_buf;
+   HYPRE_Real           *recv_buf;
+
+} hypre_ParChebyCAData;
+
+/* find the extended index of global point c, -1 if it is not (yet) known */
+static HYPRE_Int
+hypre_ParChebyCAFindIndex( HYPRE_BigInt   c,
+                           HYPRE_BigInt   first_row,
+                           HYPRE_Int      num_rows,
+                           HYPRE_Int      num_layers,
+                           HYPRE_BigInt **layer_ids,
+                           HYPRE_Int     *layer_ptr )
+{
+   HYPRE_Int d, k;
+
+   if (c >= first_row && c < first_row + (HYPRE_BigInt) num_rows)
+   {
+      return (HYPRE_Int) (c - first_row);
+   }
+   for (d = 1; d <= num_layers; d++)
+   {
+      k = hypre_BigBinarySearch(layer_ids[d], c, layer_ptr[d+1] - layer_ptr[d]);
+      if (k > -1)
+      {
+         return layer_ptr[d] + k;
+      }
+   }
+
+   return -1;
+}
+
+HYPRE_Int hypre_ParCSRRelax_Cheby_CASetup(hypre_ParCSRMatrix *A, /* matrix to relax with */
+                                          HYPRE_Int order,       /* polynomial order */
+                                          HYPRE_Int scale,       /* scale by diagonal?*/
+                                          HYPRE_Real *ds_data,   /* from Cheby_Setup */
+                                          void **ca_data_ptr)
+{
+   MPI_Comm         comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag        = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real      *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real      *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int        num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_BigInt    *col_map_offd  = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_BigInt     first_row     = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_BigInt     global_num_rows = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt    *row_starts    = hypre_ParCSRMatrixRowStarts(A);
+
+   hypre_ParChebyCAData *ca_data;
+   hypre_ParCSRCommPkg  *comm_pkg, *layer_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_CSRMatrix     **ghost_rows;
+   HYPRE_BigInt        **layer_ids;
+   HYPRE_BigInt         *ghost_ids, *new_ids;
+   HYPRE_Int            *layer_ptr, *recv_map;
+   HYPRE_Int            *A_ext_i, *A_ext_j, *send_map;
+   HYPRE_Real           *A_ext_data, *send_buf, *recv_buf;
+   HYPRE_Int             depth, d, i, j, k, n, row, num_new, num_ghosts;
+   HYPRE_Int             num_ext_rows, nnz, num_sends, num_elmts;
+   void                 *request;
+
+   *ca_data_ptr = NULL;
+
+   if (hypre_GetExecPolicy1(hypre_ParCSRMatrixMemoryLocation(A)) != HYPRE_EXEC_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   if (order > 4)
+      order = 4;
+   if (order < 1)
+      order = 1;
+
+   /* one residual matvec plus order-1 matvecs for p(A) */
+   depth = order;
+
+   if (hypre_ParCSRMatrixAssumedPartition(A) == NULL)
+   {
+      hypre_ParCSRMatrixCreateAssumedPartition(A);
+      hypre_ParCSRMatrixOwnsAssumedPartition(A) = 1;
+   }
+
+   layer_ptr  = hypre_CTAlloc(HYPRE_Int, depth + 2, HYPRE_MEMORY_HOST);
+   layer_ids  = hypre_CTAlloc(HYPRE_BigInt *, depth + 1, HYPRE_MEMORY_HOST);
+   ghost_rows = hypre_CTAlloc(hypre_CSRMatrix *, depth, HYPRE_MEMORY_HOST);
+
+   /* layer 1 are the columns of offd */
+   layer_ptr[1] = num_rows;
+   layer_ptr[2] = num_rows + num_cols_offd;
+   layer_ids[1] = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(layer_ids[1], col_map_offd, HYPRE_BigInt, num_cols_offd,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   /* fetch the rows of layer d; their new columns are layer d+1 */
+   for (d = 1; d < depth; d++)
+   {
+      n = layer_ptr[d+1] - layer_ptr[d];
+      hypre_ParCSRFindExtendCommPkg(comm, global_num_rows, first_row, num_rows, row_starts,
+                                    hypre_ParCSRMatrixAssumedPartition(A),
+                                    n, layer_ids[d], &layer_pkg);
+      hypre_ParcsrGetExternalRowsInit(A, n, layer_ids[d], layer_pkg, 1, &request);
+      ghost_rows[d] = hypre_ParcsrGetExternalRowsWait(request);
+      hypre_MatvecCommPkgDestroy(layer_pkg);
+
+      nnz = hypre_CSRMatrixNumNonzeros(ghost_rows[d]);
+      new_ids = hypre_TAlloc(HYPRE_BigInt, nnz, HYPRE_MEMORY_HOST);
+      num_new = 0;
+      for (k = 0; k < nnz; k++)
+      {
+         HYPRE_BigInt c = hypre_CSRMatrixBigJ(ghost_rows[d])[k];
+         if (hypre_ParChebyCAFindIndex(c, first_row, num_rows, d, layer_ids, layer_ptr) < 0)
+         {
+            new_ids[num_new++] = c;
+         }
+      }
+      hypre_BigQsort0(new_ids, 0, num_new - 1);
+      for (i = 0, k = 0; i < num_new; i++)
+      {
+         if (i == 0 || new_ids[i] != new_ids[i-1])
+         {
+            new_ids[k++] = new_ids[i];
+         }
+      }
+      layer_ids[d+1] = new_ids;
+      layer_ptr[d+2] = layer_ptr[d+1] + k;
+   }
+
+   /*-----------------------------------------------------------
+    * Extended matrix: local rows, then the ghost rows by layer
+    *-----------------------------------------------------------*/
+
+   num_ext_rows = layer_ptr[depth];
+   nnz = A_diag_i[num_rows] + A_offd_i[num_rows];
+   for (d = 1; d < depth; d++)
+   {
+      nnz += hypre_CSRMatrixNumNonzeros(ghost_rows[d]);
+   }
+
+   ca_data = hypre_CTAlloc(hypre_ParChebyCAData, 1, HYPRE_MEMORY_HOST);
+   ca_data->depth = depth;
+   ca_data->layer_ptr = layer_ptr;
+   ca_data->A_ext = hypre_CSRMatrixCreate(num_ext_rows, layer_ptr[depth+1], nnz);
+   hypre_CSRMatrixInitialize_v2(ca_data->A_ext, 0, HYPRE_MEMORY_HOST);
+   A_ext_i    = hypre_CSRMatrixI(ca_data->A_ext);
+   A_ext_j    = hypre_CSRMatrixJ(ca_data->A_ext);
+   A_ext_data = hypre_CSRMatrixData(ca_data->A_ext);
+
+   nnz = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = A_diag_i[i]; k < A_diag_i[i+1]; k++)
+      {
+         A_ext_j[nnz] = A_diag_j[k];
+         A_ext_data[nnz++] = A_diag_data[k];
+      }
+      for (k = A_offd_i[i]; k < A_offd_i[i+1]; k++)
+      {
+         A_ext_j[nnz] = num_rows + A_offd_j[k];
+         A_ext_data[nnz++] = A_offd_data[k];
+      }
+      A_ext_i[i+1] = nnz;
+   }
+   row = num_rows;
+   for (d = 1; d < depth; d++)
+   {
+      HYPRE_Int    *g_i    = hypre_CSRMatrixI(ghost_rows[d]);
+      HYPRE_BigInt *g_j    = hypre_CSRMatrixBigJ(ghost_rows[d]);
+      HYPRE_Real   *g_data = hypre_CSRMatrixData(ghost_rows[d]);
+
+      for (i = 0; i < hypre_CSRMatrixNumRows(ghost_rows[d]); i++)
+      {
+         for (k = g_i[i]; k < g_i[i+1]; k++)
+         {
+            /* all columns of a layer d row are in the layers up to d+1 */
+            j = hypre_ParChebyCAFindIndex(g_j[k], first_row, num_rows, d + 1,
+                                          layer_ids, layer_ptr);
+            hypre_assert(j > -1);
+            A_ext_j[nnz] = j;
+            A_ext_data[nnz++] = g_data[k];
+         }
+         A_ext_i[++row] = nnz;
+      }
+      hypre_CSRMatrixDestroy(ghost_rows[d]);
+   }
+
+   /*-----------------------------------------------------------
+    * One communication package for all ghost points; it needs
+    * the ids sorted, recv_map takes them to the extended index
+    *-----------------------------------------------------------*/
+
+   num_ghosts = layer_ptr[depth+1] - num_rows;
+   ghost_ids = hypre_TAlloc(HYPRE_BigInt, num_ghosts, HYPRE_MEMORY_HOST);
+   recv_map  = hypre_TAlloc(HYPRE_Int, num_ghosts, HYPRE_MEMORY_HOST);
+   for (d = 1; d <= depth; d++)
+   {
+      for (i = layer_ptr[d]; i < layer_ptr[d+1]; i++)
+      {
+         ghost_ids[i - num_rows] = layer_ids[d][i - layer_ptr[d]];
+         recv_map[i - num_rows] = i;
+      }
+      hypre_TFree(layer_ids[d], HYPRE_MEMORY_HOST);
+   }
+   hypre_BigQsortbi(ghost_ids, recv_map, 0, num_ghosts - 1);
+
+   hypre_ParCSRFindExtendCommPkg(comm, global_num_rows, first_row, num_rows, row_starts,
+                                 hypre_ParCSRMatrixAssumedPartition(A),
+                                 num_ghosts, ghost_ids, &comm_pkg);
+   hypre_TFree(ghost_ids, HYPRE_MEMORY_HOST);
+   hypre_TFree(layer_ids, HYPRE_MEMORY_HOST);
+   hypre_TFree(ghost_rows, HYPRE_MEMORY_HOST);
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   num_elmts = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   send_map  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+
+   /* u and f travel together, see hypre_ParCSRRelax_Cheby_CASolve */
+   send_buf = hypre_CTAlloc(HYPRE_Real, 2 * num_elmts, HYPRE_MEMORY_HOST);
+   recv_buf = hypre_CTAlloc(HYPRE_Real, 2 * num_ghosts, HYPRE_MEMORY_HOST);
+
+   ca_data->comm_pkg = comm_pkg;
+   ca_data->recv_map = recv_map;
+   ca_data->send_buf = send_buf;
+   ca_data->recv_buf = recv_buf;
+   ca_data->u_ext = hypre_CTAlloc(HYPRE_Real, layer_ptr[depth+1], HYPRE_MEMORY_HOST);
+   ca_data->f_ext = hypre_CTAlloc(HYPRE_Real, layer_ptr[depth+1], HYPRE_MEMORY_HOST);
+   ca_data->r_ext = hypre_CTAlloc(HYPRE_Real, num_ext_rows, HYPRE_MEMORY_HOST);
+   ca_data->w_ext = hypre_CTAlloc(HYPRE_Real, num_ext_rows, HYPRE_MEMORY_HOST);
+   ca_data->v_ext = hypre_CTAlloc(HYPRE_Real, num_ext_rows, HYPRE_MEMORY_HOST);
+
+   /* the scaling of the ghost rows does not change, get it once */
+   if (scale)
+   {
+      ca_data->ds_ext = hypre_CTAlloc(HYPRE_Real, layer_ptr[depth+1], HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_elmts; i++)
+      {
+         send_buf[i] = ds_data[send_map[i]];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, send_buf, recv_buf);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      for (i = 0; i < num_rows; i++)
+      {
+         ca_data->ds_ext[i] = ds_data[i];
+      }
+      for (i = 0; i < num_ghosts; i++)
+      {
+         ca_data->ds_ext[recv_map[i]] = recv_buf[i];
+      }
+   }
+
+   *ca_data_ptr = (void *) ca_data;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int hypre_ParCSRRelax_Cheby_CADestroy(void *data)
+{
+   hypre_ParChebyCAData *ca_data = (hypre_ParChebyCAData *) data;
+
+   if (ca_data)
+   {
+      hypre_TFree(ca_data->layer_ptr, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(ca_data->A_ext);
+      hypre_MatvecCommPkgDestroy(ca_data->comm_pkg);
+      hypre_TFree(ca_data->recv_map, HYPRE_MEMORY_HOST);
+      hypre_TFree(ca_data->ds_ext, HYPRE_MEMORY_HOST);
+      hypre_TFree(ca_data->u_ext, HYPRE_MEMORY_HOST);
+      hypre_TFree(ca_data->f_ext, HYPRE_MEMORY_HOST);
+      hypre_TFree(ca_data->r_ext, HYPRE_MEMORY_HOST);
+      hypre_TFree(ca_data->w_ext, HYPRE_MEMORY_HOST);
+      hypre_TFree(ca_data->v_ext, HYPRE_MEMORY_HOST);
+      hypre_TFree(ca_data->send_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(ca_data->recv_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(ca_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/* v = A_ext x on the first num_rows rows of the extended matrix */
+static void
+hypre_ParChebyCAMatvec( hypre_CSRMatrix *A_ext,
+                        HYPRE_Int        num_rows,
+                        HYPRE_Real      *x,
+                        HYPRE_Real      *v )
+{
+   HYPRE_Int  *A_i    = hypre_CSRMatrixI(A_ext);
+   HYPRE_Int  *A_j    = hypre_CSRMatrixJ(A_ext);
+   HYPRE_Real *A_data = hypre_CSRMatrixData(A_ext);
+   HYPRE_Int   i, k;
+   HYPRE_Real  sum;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,k,sum) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      sum = 0.0;
+      for (k = A_i[i]; k < A_i[i+1]; k++)
+      {
+         sum += A_data[k] * x[A_j[k]];
+      }
+      v[i] = sum;
+   }
+}
+
+HYPRE_Int hypre_ParCSRRelax_Cheby_CASolve(void *data,
+                                          hypre_ParCSRMatrix *A, /* matrix to relax with */
+                                          hypre_ParVector *f,    /* right-hand side */
+                                          HYPRE_Real *coefs,
+                                          HYPRE_Int order,       /* polynomial order */
+                                          HYPRE_Int scale,       /* scale by diagonal?*/
+                                          hypre_ParVector *u)    /* initial/updated approximation */
+{
+   hypre_ParChebyCAData *ca_data = (hypre_ParChebyCAData *) data;
+   HYPRE_Real *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+
+   HYPRE_Int             depth     = ca_data->depth;
+   HYPRE_Int            *layer_ptr = ca_data->layer_ptr;
+   hypre_CSRMatrix      *A_ext     = ca_data->A_ext;
+   hypre_ParCSRCommPkg  *comm_pkg  = ca_data->comm_pkg;
+   HYPRE_Int            *recv_map  = ca_data->recv_map;
+   HYPRE_Real           *ds_ext    = ca_data->ds_ext;
+   HYPRE_Real           *u_ext     = ca_data->u_ext;
+   HYPRE_Real           *f_ext     = ca_data->f_ext;
+   HYPRE_Real           *r_ext     = ca_data->r_ext;
+   HYPRE_Real           *w_ext     = ca_data->w_ext;
+   HYPRE_Real           *v_ext     = ca_data->v_ext;
+   HYPRE_Real           *send_buf  = ca_data->send_buf;
+   HYPRE_Real           *recv_buf  = ca_data->recv_buf;
+
+   HYPRE_Int  num_rows   = layer_ptr[1];
+   HYPRE_Int  num_ghosts = layer_ptr[depth+1] - num_rows;
+   HYPRE_Int  num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int  num_elmts  = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Int *send_map   = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int  i, j, cheby_order, nr;
+   HYPRE_Real mult;
+
+   if (order > 4)
+      order = 4;
+   if (order < 1)
+      order = 1;
+
+   /* the ghost layer was built for a different order */
+   if (order != depth)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Chebyshev order differs from the setup\n");
+      return hypre_error_flag;
+   }
+
+   cheby_order = order - 1;
+
+   /* the only communication: u and f on all ghost layers */
+   for (i = 0; i < num_elmts; i++)
+   {
+      send_buf[2*i]   = u_data[send_map[i]];
+      send_buf[2*i+1] = f_data[send_map[i]];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVec(1, comm_pkg, 2, send_buf, recv_buf);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      u_ext[i] = u_data[i];
+      f_ext[i] = f_data[i];
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (i = 0; i < num_ghosts; i++)
+   {
+      u_ext[recv_map[i]] = recv_buf[2*i];
+      f_ext[recv_map[i]] = recv_buf[2*i+1];
+   }
+
+   /* residual on layers 0..depth-1: r = f - A*u (scaled: D^(-1/2)(f - A*u)) */
+   nr = layer_ptr[depth];
+   hypre_ParChebyCAMatvec(A_ext, nr, u_ext, v_ext);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < nr; j++)
+   {
+      r_ext[j] = f_ext[j] - v_ext[j];
+      if (scale)
+      {
+         r_ext[j] *= ds_ext[j];
+      }
+      w_ext[j] = r_ext[j] * coefs[cheby_order];
+   }
+
+   /* each matvec loses one layer */
+   for (i = cheby_order - 1; i >= 0; i--)
+   {
+      mult = coefs[i];
+      if (scale)
+      {
+         /* v = D^(-1/2)AD^(-1/2)w */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < nr; j++)
+         {
+            w_ext[j] *= ds_ext[j];
+         }
+         nr = layer_ptr[i + 1];
+         hypre_ParChebyCAMatvec(A_ext, nr, w_ext, v_ext);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < nr; j++)
+         {
+            w_ext[j] = mult * r_ext[j] + ds_ext[j] * v_ext[j];
+         }
+      }
+      else
+      {
+         nr = layer_ptr[i + 1];
+         hypre_ParChebyCAMatvec(A_ext, nr, w_ext, v_ext);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = 0; j < nr; j++)
+         {
+            w_ext[j] = mult * r_ext[j] + v_ext[j];
+         }
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < num_rows; j++)
+   {
+      u_data[j] += scale ? ds_ext[j] * w_ext[j] : w_ext[j];
+   }
+
+   return hypre_error_flag;
+}
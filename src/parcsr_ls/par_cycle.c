@@ -95,6 +95,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    hypre_Vector   *l1_norms_level;
    HYPRE_Real    **ds = hypre_ParAMGDataChebyDS(amg_data);
    HYPRE_Real    **coefs = hypre_ParAMGDataChebyCoefs(amg_data);
+   HYPRE_Int      *num_colors = hypre_ParAMGDataNumColors(amg_data);
+   HYPRE_Int     **color_ptr = hypre_ParAMGDataColorPtr(amg_data);
+   HYPRE_Int     **color_order = hypre_ParAMGDataColorOrder(amg_data);
    HYPRE_Int       seq_cg = 0;
    HYPRE_Int       partial_cycle_coarsest_level;
    HYPRE_Int       partial_cycle_control;
@@ -490,10 +493,20 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                { /* scaled Chebyshev */
                   HYPRE_Int scale = hypre_ParAMGDataChebyScale(amg_data);
                   HYPRE_Int variant = hypre_ParAMGDataChebyVariant(amg_data);
-                  hypre_ParCSRRelax_Cheby_Solve(A_array[level], Aux_F,
-                                                ds[level], coefs[level],
-                                                cheby_order, scale,
-                                                variant, Aux_U, Vtemp, Ztemp );
+                  void **ca_data = hypre_ParAMGDataChebyCAData(amg_data);
+                  if (ca_data && ca_data[level])
+                  {
+                     hypre_ParCSRRelax_Cheby_CASolve(ca_data[level], A_array[level], Aux_F,
+                                                     coefs[level], cheby_order, scale,
+                                                     Aux_U);
+                  }
+                  else
+                  {
+                     hypre_ParCSRRelax_Cheby_Solve(A_array[level], Aux_F,
+                                                   ds[level], coefs[level],
+                                                   cheby_order, scale,
+                                                   variant, Aux_U, Vtemp, Ztemp );
+                  }
                }
                else if (relax_type == 17)
                {
@@ -511,6 +524,42 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                     Aux_U, Vtemp);
                   }
                }
+               else if ((relax_type == 40 || relax_type == 41) && color_order)
+               {
+                  /* multicolor Gauss-Seidel with the coloring from setup */
+                  HYPRE_Int mc_points[2] = {0, 0};
+                  HYPRE_Int mc_num_points = 1;
+                  HYPRE_Int ipt;
+
+                  if (old_version)
+                  {
+                     mc_points[0] = relax_points;
+                  }
+                  else if (relax_local == 1 && cycle_param < 3)
+                  {
+                     /* CF down cycle, FC up cycle */
+                     mc_num_points = 2;
+                     mc_points[0] = cycle_param < 2 ? 1 : -1;
+                     mc_points[1] = -mc_points[0];
+                  }
+
+                  for (ipt = 0; ipt < mc_num_points; ipt++)
+                  {
+                     Solve_err_flag = hypre_BoomerAMGRelaxMulticolorGaussSeidel(A_array[level],
+                                                                                Aux_F,
+                                                                                CF_marker_array[level],
+                                                                                mc_points[ipt],
+                                                                                relax_weight[level],
+                                                                                omega[level],
+                                                                                num_colors[level],
+                                                                                color_ptr[level],
+                                                                                color_order[level],
+                                                                                Aux_U,
+                                                                                Vtemp,
+                                                                                Ztemp,
+                                                                                relax_type == 41);
+                  }
+               }
                else if (old_version)
                {
                   Solve_err_flag = hypre_BoomerAMGRelax(A_array[level],
@@ -602,8 +651,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       {
          /*---------------------------------------------------------------
           * Visit coarser level next.
-          * Compute residual using hypre_ParCSRMatrixMatvec.
-          * Perform restriction using hypre_ParCSRMatrixMatvecT.
+          * Compute residual and restrict it in one pass using
+          * hypre_ParCSRMatrixResidualRestrict.
           * Reset counters and cycling parameters for coarse level
           *--------------------------------------------------------------*/
 
@@ -612,43 +661,31 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
          hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
 
-         alpha = -1.0;
-         beta = 1.0;
-
          if (block_mode)
          {
+            alpha = -1.0;
+            beta = 1.0;
+
             hypre_ParVectorCopy(F_array[fine_grid],Vtemp);
             hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
                                           beta, Vtemp);
-         }
-         else
-         {
-            // JSP: avoid unnecessary copy using out-of-place version of SpMV
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
-                                               beta, F_array[fine_grid], Vtemp);
-         }
 
-         alpha = 1.0;
-         beta = 0.0;
+            alpha = 1.0;
+            beta = 0.0;
 
-         if (block_mode)
-         {
             hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
                                            beta, F_array[coarse_grid]);
          }
          else
          {
-            if (restri_type)
-            {
-               /* RL: no transpose for R */
-               hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
-                                        beta, F_array[coarse_grid]);
-            }
-            else
-            {
-               hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
-                                         beta, F_array[coarse_grid]);
-            }
+            /* fused residual and restriction, RL: no transpose for R;
+               Vtemp holds the whole residual only when R is not transposed,
+               otherwise that of the interior rows of A */
+            hypre_ParCSRMatrixResidualRestrict(A_array[fine_grid], U_array[fine_grid],
+                                               F_array[fine_grid], R_array[fine_grid],
+                                               !restri_type, Vtemp, F_array[coarse_grid],
+                                               &hypre_ParAMGDataRestrictWork(amg_data),
+                                               &hypre_ParAMGDataRestrictWorkSize(amg_data));
          }
 
          HYPRE_ANNOTATE_MGLEVEL_END(level);
@@ -197,6 +197,155 @@ HYPRE_Int hypre_GaussElimSetup (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
    return hypre_error_flag;
 }
 
+/* Multivector version of hypre_GaussElimSolve (host memory): the k right-hand
+ * sides are gathered together and solved with one factorization (99) or one
+ * dgemm against the inverse (199) */
+static HYPRE_Int hypre_GaussElimSolveMultiVec (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
+{
+   hypre_ParCSRMatrix *A = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int n = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int error_flag = 0;
+
+   if (n)
+   {
+      MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
+      hypre_Vector *f_local = hypre_ParVectorLocalVector(hypre_ParAMGDataFArray(amg_data)[level]);
+      hypre_Vector *u_local = hypre_ParVectorLocalVector(hypre_ParAMGDataUArray(amg_data)[level]);
+      HYPRE_Real *f_data = hypre_VectorData(f_local);
+      HYPRE_Real *u_data = hypre_VectorData(u_local);
+      HYPRE_Int num_vectors = hypre_VectorNumVectors(f_local);
+      HYPRE_Int f_idxstride = hypre_VectorIndexStride(f_local);
+      HYPRE_Int f_vecstride = hypre_VectorVectorStride(f_local);
+      HYPRE_Int u_idxstride = hypre_VectorIndexStride(u_local);
+      HYPRE_Int u_vecstride = hypre_VectorVectorStride(u_local);
+      HYPRE_Int *comm_info = hypre_ParAMGDataCommInfo(amg_data);
+      HYPRE_Int *displs, *info, *mv_info, *mv_displs;
+      HYPRE_Int n_global = (HYPRE_Int) hypre_ParCSRMatrixGlobalNumRows(A);
+      HYPRE_Int new_num_procs;
+      HYPRE_Int first_row_index = (HYPRE_Int) hypre_ParCSRMatrixFirstRowIndex(A);
+      HYPRE_Real *b_local, *b_mat;
+      HYPRE_Int i, v;
+
+      hypre_MPI_Comm_size(new_comm, &new_num_procs);
+      info = &comm_info[0];
+      displs = &comm_info[new_num_procs];
+
+      mv_info   = hypre_TAlloc(HYPRE_Int, new_num_procs, HYPRE_MEMORY_HOST);
+      mv_displs = hypre_TAlloc(HYPRE_Int, new_num_procs, HYPRE_MEMORY_HOST);
+      for (i = 0; i < new_num_procs; i++)
+      {
+         mv_info[i]   = info[i] * num_vectors;
+         mv_displs[i] = displs[i] * num_vectors;
+      }
+
+      /* gather the right-hand sides row-wise: b_mat[i*num_vectors + v] */
+      b_local = hypre_TAlloc(HYPRE_Real, n * num_vectors,        HYPRE_MEMORY_HOST);
+      b_mat   = hypre_TAlloc(HYPRE_Real, n_global * num_vectors, HYPRE_MEMORY_HOST);
+      for (i = 0; i < n; i++)
+      {
+         for (v = 0; v < num_vectors; v++)
+         {
+            b_local[i*num_vectors + v] = f_data[i*f_idxstride + v*f_vecstride];
+         }
+      }
+
+      hypre_MPI_Allgatherv (b_local, n * num_vectors, HYPRE_MPI_REAL, b_mat, mv_info,
+                            mv_displs, HYPRE_MPI_REAL, new_comm);
+
+      if (relax_type == 9 || relax_type == 99)
+      {
+         HYPRE_Real *A_mat = hypre_ParAMGDataAMat(amg_data);
+         HYPRE_Real *A_tmp, *b_vec;
+         HYPRE_Int   my_info;
+
+         A_tmp = hypre_TAlloc(HYPRE_Real, n_global*n_global,    HYPRE_MEMORY_HOST);
+         b_vec = hypre_TAlloc(HYPRE_Real, n_global*num_vectors, HYPRE_MEMORY_HOST);
+
+         /* column-major n_global x num_vectors */
+         for (i = 0; i < n_global; i++)
+         {
+            for (v = 0; v < num_vectors; v++)
+            {
+               b_vec[v*n_global + i] = b_mat[i*num_vectors + v];
+            }
+         }
+
+         if (relax_type == 9)
+         {
+            for (v = 0; v < num_vectors; v++)
+            {
+               HYPRE_Real *b_v = b_vec + v*n_global;
+
+               for (i = 0; i < n_global*n_global; i++)
+               {
+                  A_tmp[i] = A_mat[i];
+               }
+               hypre_gselim(A_tmp, b_v, n_global, error_flag);
+            }
+         }
+         else if (relax_type == 99) /* use pivoting */
+         {
+            HYPRE_Int *piv = hypre_CTAlloc(HYPRE_Int, n_global, HYPRE_MEMORY_HOST);
+
+            for (i = 0; i < n_global*n_global; i++)
+            {
+               A_tmp[i] = A_mat[i];
+            }
+
+            /* write over A with LU, then solve for all columns of b_vec */
+            hypre_dgetrf(&n_global, &n_global, A_tmp, &n_global, piv, &my_info);
+            hypre_dgetrs("N", &n_global, &num_vectors, A_tmp, &n_global, piv, b_vec, &n_global, &my_info);
+
+            hypre_TFree(piv, HYPRE_MEMORY_HOST);
+         }
+
+         for (i = 0; i < n; i++)
+         {
+            for (v = 0; v < num_vectors; v++)
+            {
+               u_data[i*u_idxstride + v*u_vecstride] = b_vec[v*n_global + first_row_index + i];
+            }
+         }
+
+         hypre_TFree(A_tmp, HYPRE_MEMORY_HOST);
+         hypre_TFree(b_vec, HYPRE_MEMORY_HOST);
+      }
+      else if (relax_type == 199)
+      {
+         HYPRE_Real *Ainv = hypre_ParAMGDataAInv(amg_data);
+
+         char cN = 'N', cT = 'T';
+         HYPRE_Real one = 1.0, zero = 0.0;
+
+         /* b_mat and b_local are num_vectors x n_global and num_vectors x n
+          * column-major, so u^T = b^T Ainv^T */
+         hypre_dgemm(&cN, &cT, &num_vectors, &n, &n_global, &one, b_mat, &num_vectors,
+                     Ainv, &n, &zero, b_local, &num_vectors);
+
+         for (i = 0; i < n; i++)
+         {
+            for (v = 0; v < num_vectors; v++)
+            {
+               u_data[i*u_idxstride + v*u_vecstride] = b_local[i*num_vectors + v];
+            }
+         }
+      }
+
+      hypre_TFree(mv_info,   HYPRE_MEMORY_HOST);
+      hypre_TFree(mv_displs, HYPRE_MEMORY_HOST);
+      hypre_TFree(b_local,   HYPRE_MEMORY_HOST);
+      hypre_TFree(b_mat,     HYPRE_MEMORY_HOST);
+   }
+
+   if (error_flag)
+   {
+      hypre_error(HYPRE_ERROR_GENERIC);
+   }
+
+   return hypre_error_flag;
+}
+
 /* relax_type = 9, 99, 199, see par_relax.c for 19 and 98 */
 HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYPRE_Int relax_type)
 {
@@ -214,7 +363,11 @@ HYPRE_Int hypre_GaussElimSolve (hypre_ParAMGData *amg_data, HYPRE_Int level, HYP
       hypre_GaussElimSetup(amg_data, level, relax_type);
    }
 
-   if (n)
+   if (hypre_ParVectorNumVectors(hypre_ParAMGDataFArray(amg_data)[level]) > 1)
+   {
+      hypre_GaussElimSolveMultiVec(amg_data, level, relax_type);
+   }
+   else if (n)
    {
       MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
       hypre_ParVector *f = hypre_ParAMGDataFArray(amg_data)[level];
@@ -98,6 +98,21 @@ hypre_ILUCreate()
    /* reordering_type default to use local RCM */
    hypre_ParILUDataReorderingType(ilu_data) = 1;
 
+   /* triangular solves default to sequential substitution */
+   hypre_ParILUDataTriSolve(ilu_data) = 0;
+   hypre_ParILUDataLowerJacobiIters(ilu_data) = 5;
+   hypre_ParILUDataUpperJacobiIters(ilu_data) = 5;
+   hypre_ParILUDataNumLLevels(ilu_data) = 0;
+   hypre_ParILUDataLLevelPtr(ilu_data) = NULL;
+   hypre_ParILUDataLLevelRows(ilu_data) = NULL;
+   hypre_ParILUDataNumULevels(ilu_data) = 0;
+   hypre_ParILUDataULevelPtr(ilu_data) = NULL;
+   hypre_ParILUDataULevelRows(ilu_data) = NULL;
+
+   /* iterative setup */
+   hypre_ParILUDataIterSetupMaxIter(ilu_data) = 5;
+   hypre_ParILUDataIterSetupTol(ilu_data) = 0.0;
+
    /* see hypre_ILUSetType for more default values */
    hypre_ParILUDataTestOption(ilu_data) = 0;
 
@@ -315,6 +330,9 @@ hypre_ILUDestroy( void *data )
       hypre_ParILUDataUEnd(ilu_data) = NULL;
    }
 
+   /* level sets of the factors */
+   hypre_ILUDestroyLevelSets(ilu_data);
+
    /* Factors */
    if(hypre_ParILUDataMatL(ilu_data))
    {
@@ -583,6 +601,48 @@ hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type )
    return hypre_error_flag;
 }
 
+/* Set type of triangular solves with the L and U factors */
+HYPRE_Int
+hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataTriSolve(ilu_data) = tri_solve;
+   return hypre_error_flag;
+}
+/* Set number of Jacobi iterations for the L solve (tri_solve = 2) */
+HYPRE_Int
+hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataLowerJacobiIters(ilu_data) = lower_jacobi_iters;
+   return hypre_error_flag;
+}
+/* Set number of Jacobi iterations for the U solve (tri_solve = 2) */
+HYPRE_Int
+hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataUpperJacobiIters(ilu_data) = upper_jacobi_iters;
+   return hypre_error_flag;
+}
+
+/* Set max number of sweeps of the iterative ILU setup (ilu_type 2) */
+HYPRE_Int
+hypre_ILUSetIterativeSetupMaxIter( void *ilu_vdata, HYPRE_Int iter_setup_max_iter )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataIterSetupMaxIter(ilu_data) = iter_setup_max_iter;
+   return hypre_error_flag;
+}
+/* Set stop tolerance of the iterative ILU setup (ilu_type 2) */
+HYPRE_Int
+hypre_ILUSetIterativeSetupTolerance( void *ilu_vdata, HYPRE_Real iter_setup_tol )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   hypre_ParILUDataIterSetupTol(ilu_data) = iter_setup_tol;
+   return hypre_error_flag;
+}
+
 /* Set KDim (for GMRES) for Solver of Schur System */
 HYPRE_Int
 hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim )
@@ -842,6 +902,11 @@ hypre_ILUWriteSolverParams(void *ilu_vdata)
             }
 #endif
          break;
+      case 2:
+            hypre_printf("Block Jacobi with iterative ILU(%d), %d sweeps \n", hypre_ParILUDataLfil(ilu_data),
+                         hypre_ParILUDataIterSetupMaxIter(ilu_data));
+            hypre_printf("Operator Complexity (Fill factor) = %f \n", hypre_ParILUDataOperatorComplexity(ilu_data));
+         break;
       case 1:
             hypre_printf("Block Jacobi with ILUT \n");
             hypre_printf("drop tolerance for B = %e, E&F = %e, S = %e \n", hypre_ParILUDataDroptol(ilu_data)[0],hypre_ParILUDataDroptol(ilu_data)[1],hypre_ParILUDataDroptol(ilu_data)[2]);
@@ -4173,6 +4238,8 @@ hypre_CSRMatrixScale(hypre_CSRMatrix *A, HYPRE_Real scalar)
 {
    HYPRE_Real  *data = hypre_CSRMatrixData(A);
    HYPRE_Int   i,k;
+   /* the SELL copy no longer matches the values */
+   hypre_CSRMatrixSellDestroy(A);
    k = hypre_CSRMatrixNumNonzeros(A);
    for(i = 0 ; i < k ; i ++)
    {
@@ -4345,6 +4412,8 @@ hypre_CSRMatrixDropInplace(hypre_CSRMatrix *A, HYPRE_Real droptol, HYPRE_Int max
       hypre_TFree(A_data, HYPRE_MEMORY_DEVICE);
    }
 
+   /* the SELL copy no longer matches the pattern */
+   hypre_CSRMatrixSellDestroy(A);
    hypre_CSRMatrixI(A) = new_i;
    hypre_CSRMatrixJ(A) = new_j;
    hypre_CSRMatrixData(A) = new_data;
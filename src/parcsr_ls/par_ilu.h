@@ -135,6 +135,22 @@ typedef struct hypre_ParILUData_struct
    /* local reordering */
    HYPRE_Int            reordering_type;
 
+   /* host triangular solves with L and U (BJ ILU only) */
+   HYPRE_Int            tri_solve;/* 0 sequential, 1 level-scheduled, 2 Jacobi iterations */
+   HYPRE_Int            lower_jacobi_iters;
+   HYPRE_Int            upper_jacobi_iters;
+   /* level sets of L and U: rows of level k are level_rows[level_ptr[k]:level_ptr[k+1]-1] */
+   HYPRE_Int            num_L_levels;
+   HYPRE_Int            *L_level_ptr;
+   HYPRE_Int            *L_level_rows;
+   HYPRE_Int            num_U_levels;
+   HYPRE_Int            *U_level_ptr;
+   HYPRE_Int            *U_level_rows;
+
+   /* iterative ILU setup (ilu_type 2) */
+   HYPRE_Int            iter_setup_max_iter;/* max number of sweeps */
+   HYPRE_Real           iter_setup_tol;/* stop tol for the residual of the factorization */
+
 } hypre_ParILUData;
 
 #define hypre_ParILUDataTestOption(ilu_data)                   ((ilu_data) -> test_opt)
@@ -207,6 +223,17 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataRhs(ilu_data)                          ((ilu_data) -> rhs)
 #define hypre_ParILUDataX(ilu_data)                            ((ilu_data) -> x)
 #define hypre_ParILUDataReorderingType(ilu_data)               ((ilu_data) -> reordering_type)
+#define hypre_ParILUDataTriSolve(ilu_data)                     ((ilu_data) -> tri_solve)
+#define hypre_ParILUDataLowerJacobiIters(ilu_data)             ((ilu_data) -> lower_jacobi_iters)
+#define hypre_ParILUDataUpperJacobiIters(ilu_data)             ((ilu_data) -> upper_jacobi_iters)
+#define hypre_ParILUDataNumLLevels(ilu_data)                   ((ilu_data) -> num_L_levels)
+#define hypre_ParILUDataLLevelPtr(ilu_data)                    ((ilu_data) -> L_level_ptr)
+#define hypre_ParILUDataLLevelRows(ilu_data)                   ((ilu_data) -> L_level_rows)
+#define hypre_ParILUDataNumULevels(ilu_data)                   ((ilu_data) -> num_U_levels)
+#define hypre_ParILUDataULevelPtr(ilu_data)                    ((ilu_data) -> U_level_ptr)
+#define hypre_ParILUDataULevelRows(ilu_data)                   ((ilu_data) -> U_level_rows)
+#define hypre_ParILUDataIterSetupMaxIter(ilu_data)             ((ilu_data) -> iter_setup_max_iter)
+#define hypre_ParILUDataIterSetupTol(ilu_data)                 ((ilu_data) -> iter_setup_tol)
 /* Schur System */
 #define hypre_ParILUDataSchurGMRESKDim(ilu_data)               ((ilu_data) -> ss_kDim)
 #define hypre_ParILUDataSchurGMRESMaxIter(ilu_data)            ((ilu_data) -> ss_max_iter)
@@ -82,6 +82,8 @@ hypre_ILUSetup( void               *ilu_vdata,
    //   HYPRE_Int            m;/* m = n-LU */
    /* reordering option */
    HYPRE_Int            reordering_type = hypre_ParILUDataReorderingType(ilu_data);
+   /* triangular solve option */
+   HYPRE_Int            tri_solve       = hypre_ParILUDataTriSolve(ilu_data);
    HYPRE_Int            num_procs,  my_id;
 
    hypre_ParVector      *Utemp               = NULL;
@@ -285,6 +287,19 @@ hypre_ILUSetup( void               *ilu_vdata,
       hypre_TFree(CF_marker_array, HYPRE_MEMORY_HOST);
       CF_marker_array = NULL;
    }
+#ifndef HYPRE_USING_CUDA
+   if (hypre_ParILUDataXTemp(ilu_data))
+   {
+      hypre_ParVectorDestroy(hypre_ParILUDataXTemp(ilu_data));
+      hypre_ParILUDataXTemp(ilu_data) = NULL;
+   }
+   if (hypre_ParILUDataYTemp(ilu_data))
+   {
+      hypre_ParVectorDestroy(hypre_ParILUDataYTemp(ilu_data));
+      hypre_ParILUDataYTemp(ilu_data) = NULL;
+   }
+#endif
+   hypre_ILUDestroyLevelSets(ilu_data);
 
 
    /* clear old l1_norm data, if created */
@@ -405,7 +420,7 @@ hypre_ILUSetup( void               *ilu_vdata,
          case 40: case 41:/* ddPQ */
             hypre_ILUGetPermddPQ(matA, &perm, &qperm, tol_ddPQ, &nLU, &nI, reordering_type);
             break;
-         case 0: case 1:
+         case 0: case 1: case 2:
             hypre_ILUGetLocalPerm(matA, &perm, &nLU, reordering_type);
             break;
          default:
@@ -417,6 +432,13 @@ hypre_ILUSetup( void               *ilu_vdata,
    /* factorization */
    switch(ilu_type)
    {
+      case 2:
+#ifndef HYPRE_USING_CUDA
+               hypre_ILUSetupILUKIter(matA, fill_level, perm, hypre_ParILUDataIterSetupMaxIter(ilu_data),
+                                      hypre_ParILUDataIterSetupTol(ilu_data), &matL, &matD, &matU, &u_end); //BJ + iterative ILU(k)
+               break;
+#endif
+               /* no device version of the iterative setup, same as ilu_type 0 */
       case 0:
 #ifdef HYPRE_USING_CUDA
                /* only apply the setup of ILU0 with cusparse */
@@ -557,6 +579,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector,
                   hypre_ParKrylovAxpy,
+                  hypre_ParKrylovAxpyInnerProd,
                   hypre_ParKrylovIdentitySetup, //parCSR A -- inactive
                   hypre_ParKrylovIdentity ); //parCSR A -- inactive
             schur_solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
@@ -837,6 +860,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector,
                   hypre_ParKrylovAxpy,
+                  hypre_ParKrylovAxpyInnerProd,
                   hypre_ParKrylovIdentitySetup, //parCSR A -- inactive
                   hypre_ParKrylovIdentity ); //parCSR A -- inactive
             schur_solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
@@ -962,6 +986,7 @@ hypre_ILUSetup( void               *ilu_vdata,
                      hypre_ParKrylovClearVector,
                      hypre_ParKrylovScaleVector,
                      hypre_ParKrylovAxpy,
+                     hypre_ParKrylovAxpyInnerProd,
                      hypre_ParKrylovIdentitySetup, //parCSR A -- inactive
                      hypre_ParKrylovIdentity ); //parCSR A -- inactive
             schur_solver = ( (HYPRE_Solver) hypre_GMRESCreate( gmres_functions ) );
@@ -1039,6 +1064,35 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_ParILUDataUTempLower(ilu_data)         = Utemp_lower;
    hypre_ParILUDataMatAFakeDiagonal(ilu_data)   = A_diag_fake;
 #endif
+
+#ifndef HYPRE_USING_CUDA
+   /* analysis for the host triangular solves of the BJ variants, the level
+    * order only pays off with several threads */
+   if (ilu_type == 0 || ilu_type == 1 || ilu_type == 2)
+   {
+      if (tri_solve == 1 && hypre_NumThreads() > 1)
+      {
+         hypre_ILUSetupLevelSets(hypre_ParCSRMatrixDiag(matL), n, 0,
+                                 &hypre_ParILUDataNumLLevels(ilu_data),
+                                 &hypre_ParILUDataLLevelPtr(ilu_data),
+                                 &hypre_ParILUDataLLevelRows(ilu_data));
+         hypre_ILUSetupLevelSets(hypre_ParCSRMatrixDiag(matU), n, 1,
+                                 &hypre_ParILUDataNumULevels(ilu_data),
+                                 &hypre_ParILUDataULevelPtr(ilu_data),
+                                 &hypre_ParILUDataULevelRows(ilu_data));
+      }
+      else if (tri_solve == 2)
+      {
+         /* second iterate of the Jacobi sweeps */
+         Xtemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(matA),
+                                       hypre_ParCSRMatrixGlobalNumRows(matA),
+                                       hypre_ParCSRMatrixRowStarts(matA));
+         hypre_ParVectorInitialize(Xtemp);
+         hypre_ParVectorSetPartitioningOwner(Xtemp,0);
+      }
+   }
+#endif
+
    hypre_ParILUDataMatA(ilu_data)               = matA;
    hypre_ParILUDataXTemp(ilu_data)              = Xtemp;
    hypre_ParILUDataYTemp(ilu_data)              = Ytemp;
@@ -1070,7 +1124,7 @@ hypre_ILUSetup( void               *ilu_vdata,
 #ifdef HYPRE_USING_CUDA
    HYPRE_Int nnzBEF = 0;
    HYPRE_Int nnzG;/* Global nnz */
-   if (ilu_type == 0 && fill_level == 0)
+   if ((ilu_type == 0 || ilu_type == 2) && fill_level == 0)
    {
       /* The nnz is for sure 1.0 in this case */
       hypre_ParILUDataOperatorComplexity(ilu_data) =  1.0;
@@ -1104,7 +1158,7 @@ hypre_ILUSetup( void               *ilu_vdata,
    {
       hypre_ParILUDataOperatorComplexity(ilu_data) =  1.0;
    }
-   else if (ilu_type == 0 || ilu_type == 1 || ilu_type == 10 || ilu_type == 11)
+   else if (ilu_type == 0 || ilu_type == 1 || ilu_type == 2 || ilu_type == 10 || ilu_type == 11)
    {
       if (matBLU_d)
       {
@@ -1187,6 +1241,98 @@ hypre_ILUSetup( void               *ilu_vdata,
    return hypre_error_flag;
 }
 
+/* Compute the level sets of a triangular factor for the level-scheduled
+ * substitution in hypre_ILUSolveLULevels.
+ * T = diagonal block of L (upper = 0) or U (upper = 1), without the diagonal,
+ *    in the permuted numbering. Only the first n rows and columns are used.
+ * A row depends on the rows in its columns, so that the level of a row is one
+ * more than the largest level of these. Rows in the same level are independent
+ * and are listed in increasing order.
+ * num_levelsp = number of levels
+ * level_ptrp = start of each level in level_rowsp, of size num_levels+1
+ * level_rowsp = rows sorted by level
+ */
+HYPRE_Int
+hypre_ILUSetupLevelSets( hypre_CSRMatrix  *T,
+                         HYPRE_Int         n,
+                         HYPRE_Int         upper,
+                         HYPRE_Int        *num_levelsp,
+                         HYPRE_Int       **level_ptrp,
+                         HYPRE_Int       **level_rowsp )
+{
+   HYPRE_Int            *T_i           = hypre_CSRMatrixI(T);
+   HYPRE_Int            *T_j           = hypre_CSRMatrixJ(T);
+   HYPRE_Int            *level;
+   HYPRE_Int            *level_ptr;
+   HYPRE_Int            *level_rows;
+   HYPRE_Int             num_levels    = 0;
+   HYPRE_Int             i, ii, j, col, lev;
+
+   level = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   /* rows of L depend on earlier rows, rows of U on later rows */
+   for (ii = 0; ii < n; ii++)
+   {
+      i = upper ? n-1-ii : ii;
+      lev = 0;
+      for (j = T_i[i]; j < T_i[i+1]; j++)
+      {
+         col = T_j[j];
+         if (col < n)
+         {
+            lev = hypre_max(lev, level[col] + 1);
+         }
+      }
+      level[i] = lev;
+      num_levels = hypre_max(num_levels, lev + 1);
+   }
+
+   /* bucket the rows by level */
+   level_ptr  = hypre_CTAlloc(HYPRE_Int, num_levels+1, HYPRE_MEMORY_HOST);
+   level_rows = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      level_ptr[level[i]+1]++;
+   }
+   for (lev = 0; lev < num_levels; lev++)
+   {
+      level_ptr[lev+1] += level_ptr[lev];
+   }
+   for (i = 0; i < n; i++)
+   {
+      level_rows[level_ptr[level[i]]++] = i;
+   }
+   for (lev = num_levels; lev > 0; lev--)
+   {
+      level_ptr[lev] = level_ptr[lev-1];
+   }
+   level_ptr[0] = 0;
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+
+   *num_levelsp = num_levels;
+   *level_ptrp  = level_ptr;
+   *level_rowsp = level_rows;
+
+   return hypre_error_flag;
+}
+
+/* Free the level sets of the L and U factors, if any */
+HYPRE_Int
+hypre_ILUDestroyLevelSets( void *ilu_vdata )
+{
+   hypre_ParILUData     *ilu_data      = (hypre_ParILUData*) ilu_vdata;
+
+   hypre_TFree(hypre_ParILUDataLLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_ParILUDataNumLLevels(ilu_data) = 0;
+   hypre_ParILUDataNumULevels(ilu_data) = 0;
+
+   return hypre_error_flag;
+}
+
 #ifdef HYPRE_USING_CUDA
 
 /* Extract submatrix from diagonal part of A into a new CSRMatrix without sort rows
@@ -5233,6 +5379,383 @@ hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *permp, HYPR
    return hypre_error_flag;
 }
 
+/* Sum over k < kmax of L(i,k)*U(k,j) for the iterative ILU, with the row of L
+ * and the column of U (in CSC form) both sorted by increasing index.
+ */
+static inline HYPRE_Real
+hypre_ILUSetupILUKIterDot( HYPRE_Int   kmax,
+                           HYPRE_Int  *L_j,
+                           HYPRE_Real *L_data,
+                           HYPRE_Int   l_start,
+                           HYPRE_Int   l_end,
+                           HYPRE_Int  *Ut_j,
+                           HYPRE_Int  *Ut_pos,
+                           HYPRE_Real *U_data,
+                           HYPRE_Int   u_start,
+                           HYPRE_Int   u_end )
+{
+   HYPRE_Real sum = 0.0;
+   HYPRE_Int  kl, ku;
+
+   while (l_start < l_end && u_start < u_end)
+   {
+      kl = L_j[l_start];
+      ku = Ut_j[u_start];
+      if (kl >= kmax || ku >= kmax)
+      {
+         break;
+      }
+      if (kl == ku)
+      {
+         sum += L_data[l_start++] * U_data[Ut_pos[u_start++]];
+      }
+      else if (kl < ku)
+      {
+         l_start++;
+      }
+      else
+      {
+         u_start++;
+      }
+   }
+
+   return sum;
+}
+
+/* Iterative ILU(k), block Jacobi only (nLU = n)
+ * The fixed-point sweeps of Chow and Patel, "Fine-grained parallel incomplete
+ * LU factorization", SIAM J. Sci. Comput. 37 (2015). The pattern comes from
+ * the ILU(k) symbolic factorization, and the entries of L and U satisfy
+ *    l_ij = (a_ij - sum_{k<j} l_ik u_kj) / u_jj,   i > j
+ *    u_ij =  a_ij - sum_{k<i} l_ik u_kj,           i <= j
+ * Each sweep computes all the entries from these equations with the values
+ * of the previous sweep (Jacobi-style), the rows are split over the OpenMP
+ * threads. The result does not depend on the number of threads.
+ * A: input matrix
+ * lfil: level of fill-in, the k in ILU(k)
+ * perm: permutation array indicating ordering of factorization
+ * max_iter: max number of sweeps
+ * tol: stop when the norm of A - LU on the pattern, relative to that of A,
+ *    drops below tol. No check for tol = 0.
+ * Lptr, Dptr, Uptr: L, D, U factors, in the format of hypre_ILUSetupILUK
+ */
+HYPRE_Int
+hypre_ILUSetupILUKIter(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int max_iter,
+      HYPRE_Real tol, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr,
+      HYPRE_Int **u_end)
+{
+   HYPRE_Real              local_nnz, total_nnz;
+   HYPRE_Int               i, ii, j, k, col, icol, iter;
+   HYPRE_Int               *iw;
+   HYPRE_Int               *rperm;
+   MPI_Comm                comm = hypre_ParCSRMatrixComm(A);
+
+   /* data objects for A */
+   hypre_CSRMatrix         *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real              *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int               n              = hypre_CSRMatrixNumRows(A_diag);
+
+   /* data objects for L, D, U */
+   hypre_ParCSRMatrix      *matL;
+   hypre_ParCSRMatrix      *matU;
+   hypre_CSRMatrix         *L_diag;
+   hypre_CSRMatrix         *U_diag;
+   HYPRE_Real              *D_data;
+   HYPRE_Real              *L_diag_data   = NULL;
+   HYPRE_Int               *L_diag_i;
+   HYPRE_Int               *L_diag_j      = NULL;
+   HYPRE_Real              *U_diag_data   = NULL;
+   HYPRE_Int               *U_diag_i;
+   HYPRE_Int               *U_diag_j      = NULL;
+   HYPRE_Int               *S_diag_i;
+   HYPRE_Int               *S_diag_j      = NULL;
+
+   /* entries of A on the pattern of L, D and U, and U by columns */
+   HYPRE_Real              *AL_data       = NULL;
+   HYPRE_Real              *AU_data       = NULL;
+   HYPRE_Real              *AD_data;
+   HYPRE_Real              *UD_data;
+   /* values computed by the current sweep */
+   HYPRE_Real              *L_new_data    = NULL;
+   HYPRE_Real              *U_new_data    = NULL;
+   HYPRE_Real              *UD_new_data;
+   HYPRE_Real              *swap;
+   HYPRE_Int               *Ut_i;
+   HYPRE_Int               *Ut_j          = NULL;
+   HYPRE_Int               *Ut_pos        = NULL;
+   HYPRE_Int               nnz_L, nnz_U;
+
+   HYPRE_Real              norm_A, norm_R, r, sum, diag;
+
+   /*
+    * 1: Symbolic factorization, the pattern is that of ILU(k)
+    */
+   D_data   = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_DEVICE);
+   L_diag_i = hypre_CTAlloc(HYPRE_Int, (n+1), HYPRE_MEMORY_DEVICE);
+   U_diag_i = hypre_CTAlloc(HYPRE_Int, (n+1), HYPRE_MEMORY_DEVICE);
+   S_diag_i = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_DEVICE);
+
+   iw = hypre_CTAlloc(HYPRE_Int, 4*n, HYPRE_MEMORY_HOST);
+   rperm = iw + 3*n;
+   for (i = 0; i < n; i++)
+   {
+      rperm[perm[i]] = i;
+   }
+
+   hypre_ILUSetupILUKSymbolic(n, A_diag_i, A_diag_j, lfil, perm, rperm, iw,
+         n, L_diag_i, U_diag_i, S_diag_i, &L_diag_j, &U_diag_j, &S_diag_j, u_end);
+
+   nnz_L = L_diag_i[n];
+   nnz_U = U_diag_i[n];
+   L_diag_data = hypre_CTAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_DEVICE);
+   U_diag_data = hypre_CTAlloc(HYPRE_Real, nnz_U, HYPRE_MEMORY_DEVICE);
+   AL_data = hypre_CTAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+   AU_data = hypre_CTAlloc(HYPRE_Real, nnz_U, HYPRE_MEMORY_HOST);
+   AD_data = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   UD_data = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   L_new_data = hypre_TAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_DEVICE);
+   U_new_data = hypre_TAlloc(HYPRE_Real, nnz_U, HYPRE_MEMORY_DEVICE);
+   UD_new_data = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+
+   /* the rows of L and the columns of U are merged, so both need to be sorted */
+   for (ii = 0; ii < n; ii++)
+   {
+      hypre_qsort0(L_diag_j, L_diag_i[ii], L_diag_i[ii+1]-1);
+   }
+   Ut_i = hypre_CTAlloc(HYPRE_Int, n+1, HYPRE_MEMORY_HOST);
+   Ut_j = hypre_TAlloc(HYPRE_Int, nnz_U, HYPRE_MEMORY_HOST);
+   Ut_pos = hypre_TAlloc(HYPRE_Int, nnz_U, HYPRE_MEMORY_HOST);
+   for (j = 0; j < nnz_U; j++)
+   {
+      Ut_i[U_diag_j[j]+1]++;
+   }
+   for (i = 0; i < n; i++)
+   {
+      Ut_i[i+1] += Ut_i[i];
+   }
+   for (ii = 0; ii < n; ii++)
+   {
+      for (j = U_diag_i[ii]; j < U_diag_i[ii+1]; j++)
+      {
+         k = Ut_i[U_diag_j[j]]++;
+         Ut_j[k] = ii;
+         Ut_pos[k] = j;
+      }
+   }
+   for (i = n; i > 0; i--)
+   {
+      Ut_i[i] = Ut_i[i-1];
+   }
+   Ut_i[0] = 0;
+
+   /* copy A into the pattern, iw is -1 after the symbolic factorization */
+   norm_A = 0.0;
+   for (ii = 0; ii < n; ii++)
+   {
+      for (j = L_diag_i[ii]; j < L_diag_i[ii+1]; j++)
+      {
+         iw[L_diag_j[j]] = j;
+      }
+      for (j = U_diag_i[ii]; j < U_diag_i[ii+1]; j++)
+      {
+         iw[U_diag_j[j]] = j;
+      }
+      i = perm[ii];
+      for (j = A_diag_i[i]; j < A_diag_i[i+1]; j++)
+      {
+         col = rperm[A_diag_j[j]];
+         icol = iw[col];
+         if (col < ii)
+         {
+            AL_data[icol] = A_diag_data[j];
+         }
+         else if (col == ii)
+         {
+            AD_data[ii] = A_diag_data[j];
+         }
+         else
+         {
+            AU_data[icol] = A_diag_data[j];
+         }
+         norm_A += A_diag_data[j] * A_diag_data[j];
+      }
+      for (j = L_diag_i[ii]; j < L_diag_i[ii+1]; j++)
+      {
+         iw[L_diag_j[j]] = -1;
+      }
+      for (j = U_diag_i[ii]; j < U_diag_i[ii+1]; j++)
+      {
+         iw[U_diag_j[j]] = -1;
+      }
+   }
+   norm_A = sqrt(norm_A);
+
+   /*
+    * 2: Initial guess L = lower(A) D(A)^{-1}, U = upper(A)
+    */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii, j, diag) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < n; ii++)
+   {
+      UD_data[ii] = AD_data[ii];
+      for (j = L_diag_i[ii]; j < L_diag_i[ii+1]; j++)
+      {
+         diag = AD_data[L_diag_j[j]];
+         L_diag_data[j] = fabs(diag) < MAT_TOL ? AL_data[j] : AL_data[j] / diag;
+      }
+      for (j = U_diag_i[ii]; j < U_diag_i[ii+1]; j++)
+      {
+         U_diag_data[j] = AU_data[j];
+      }
+   }
+
+   /*
+    * 3: Fixed-point sweeps
+    */
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      norm_R = 0.0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii, j, col, sum, diag, r) reduction(+:norm_R) HYPRE_SMP_SCHEDULE
+#endif
+      for (ii = 0; ii < n; ii++)
+      {
+         /* L part */
+         for (j = L_diag_i[ii]; j < L_diag_i[ii+1]; j++)
+         {
+            col = L_diag_j[j];
+            sum = hypre_ILUSetupILUKIterDot(col, L_diag_j, L_diag_data, L_diag_i[ii], j,
+                                            Ut_j, Ut_pos, U_diag_data, Ut_i[col], Ut_i[col+1]);
+            diag = UD_data[col];
+            r = AL_data[j] - sum - L_diag_data[j] * diag;
+            norm_R += r * r;
+            L_new_data[j] = (AL_data[j] - sum) / (fabs(diag) < MAT_TOL ? 1e-06 : diag);
+         }
+
+         /* diagonal */
+         sum = hypre_ILUSetupILUKIterDot(ii, L_diag_j, L_diag_data, L_diag_i[ii], L_diag_i[ii+1],
+                                         Ut_j, Ut_pos, U_diag_data, Ut_i[ii], Ut_i[ii+1]);
+         r = AD_data[ii] - sum - UD_data[ii];
+         norm_R += r * r;
+         UD_new_data[ii] = AD_data[ii] - sum;
+
+         /* U part */
+         for (j = U_diag_i[ii]; j < U_diag_i[ii+1]; j++)
+         {
+            col = U_diag_j[j];
+            sum = hypre_ILUSetupILUKIterDot(ii, L_diag_j, L_diag_data, L_diag_i[ii], L_diag_i[ii+1],
+                                            Ut_j, Ut_pos, U_diag_data, Ut_i[col], Ut_i[col+1]);
+            r = AU_data[j] - sum - U_diag_data[j];
+            norm_R += r * r;
+            U_new_data[j] = AU_data[j] - sum;
+         }
+      }
+
+      swap = L_diag_data;  L_diag_data = L_new_data;  L_new_data = swap;
+      swap = U_diag_data;  U_diag_data = U_new_data;  U_new_data = swap;
+      swap = UD_data;      UD_data = UD_new_data;     UD_new_data = swap;
+
+      /* norm_R is the residual before this sweep */
+      if (tol > 0.0 && sqrt(norm_R) <= tol * norm_A)
+      {
+         break;
+      }
+   }
+   hypre_TFree(L_new_data, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(U_new_data, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(UD_new_data, HYPRE_MEMORY_HOST);
+
+   /* diagonal part (we store the inverse) */
+   for (ii = 0; ii < n; ii++)
+   {
+      D_data[ii] = fabs(UD_data[ii]) < MAT_TOL ? 1e+06 : 1. / UD_data[ii];
+   }
+
+   /*
+    * 4: Assemble L and U, see hypre_ILUSetupILUK
+    */
+   matL = hypre_ParCSRMatrixCreate( comm,
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixRowStarts(A),
+         hypre_ParCSRMatrixColStarts(A),
+         0 /* num_cols_offd */,
+         nnz_L,
+         0 /* num_nonzeros_offd */);
+
+   /* Have A own coarse_partitioning instead of L */
+   hypre_ParCSRMatrixSetColStartsOwner(matL,0);
+   hypre_ParCSRMatrixSetRowStartsOwner(matL,0);
+   L_diag = hypre_ParCSRMatrixDiag(matL);
+   hypre_CSRMatrixI(L_diag) = L_diag_i;
+   if (nnz_L > 0)
+   {
+      hypre_CSRMatrixData(L_diag) = L_diag_data;
+      hypre_CSRMatrixJ(L_diag) = L_diag_j;
+   }
+   else
+   {
+      /* we allocated some initial length, so free them */
+      hypre_TFree(L_diag_j, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(L_diag_data, HYPRE_MEMORY_DEVICE);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) nnz_L;
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matL) = total_nnz;
+
+   matU = hypre_ParCSRMatrixCreate( comm,
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixRowStarts(A),
+         hypre_ParCSRMatrixColStarts(A),
+         0,
+         nnz_U,
+         0 );
+
+   /* Have A own coarse_partitioning instead of U */
+   hypre_ParCSRMatrixSetColStartsOwner(matU,0);
+   hypre_ParCSRMatrixSetRowStartsOwner(matU,0);
+   U_diag = hypre_ParCSRMatrixDiag(matU);
+   hypre_CSRMatrixI(U_diag) = U_diag_i;
+   if (nnz_U > 0)
+   {
+      hypre_CSRMatrixData(U_diag) = U_diag_data;
+      hypre_CSRMatrixJ(U_diag) = U_diag_j;
+   }
+   else
+   {
+      /* we allocated some initial length, so free them */
+      hypre_TFree(U_diag_j, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(U_diag_data, HYPRE_MEMORY_DEVICE);
+   }
+   /* store (global) total number of nonzeros */
+   local_nnz = (HYPRE_Real) nnz_U;
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matU) = total_nnz;
+
+   /* free */
+   hypre_TFree(iw, HYPRE_MEMORY_HOST);
+   hypre_TFree(S_diag_i, HYPRE_MEMORY_DEVICE);
+   hypre_TFree(AL_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(AU_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(AD_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(UD_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_pos, HYPRE_MEMORY_HOST);
+
+   /* set matrix pointers */
+   *Lptr = matL;
+   *Dptr = D_data;
+   *Uptr = matU;
+
+   return hypre_error_flag;
+}
+
 /* ILUT
  * A: input matrix
  * lfil: maximum nnz per row in L and U
@@ -77,6 +77,7 @@ hypre_ILUSolve( void               *ilu_vdata,
    HYPRE_Int            print_level    = hypre_ParILUDataPrintLevel(ilu_data);
    HYPRE_Int            max_iter       = hypre_ParILUDataMaxIter(ilu_data);
    HYPRE_Real           *norms         = hypre_ParILUDataRelResNorms(ilu_data);
+   HYPRE_Int            tri_solve      = hypre_ParILUDataTriSolve(ilu_data);
    hypre_ParVector      *Ftemp         = hypre_ParILUDataFTemp(ilu_data);
    hypre_ParVector      *Utemp         = hypre_ParILUDataUTemp(ilu_data);
    hypre_ParVector      *Xtemp         = hypre_ParILUDataXTemp(ilu_data);
@@ -245,13 +246,32 @@ hypre_ILUSolve( void               *ilu_vdata,
 
       /* Do one solve on LUe=r */
       switch(ilu_type){
-         case 0: case 1:
+         case 0: case 1: case 2:
 #ifdef HYPRE_USING_CUDA
             /* Apply GPU-accelerated LU solve */
             hypre_ILUSolveCusparseLU(matA, matL_des, matU_des, matBL_info, matBU_info, matBLU_d, ilu_solve_policy,
                                     ilu_solve_buffer, F_array, U_array, perm, n, Utemp, Ftemp);//BJ-cusparse
 #else
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            if (tri_solve == 1 && hypre_ParILUDataLLevelPtr(ilu_data))
+            {
+               hypre_ILUSolveLULevels(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                                      hypre_ParILUDataNumLLevels(ilu_data),
+                                      hypre_ParILUDataLLevelPtr(ilu_data),
+                                      hypre_ParILUDataLLevelRows(ilu_data),
+                                      hypre_ParILUDataNumULevels(ilu_data),
+                                      hypre_ParILUDataULevelPtr(ilu_data),
+                                      hypre_ParILUDataULevelRows(ilu_data)); //BJ, level-scheduled
+            }
+            else if (tri_solve == 2)
+            {
+               hypre_ILUSolveLUIter(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                                    Xtemp, hypre_ParILUDataLowerJacobiIters(ilu_data),
+                                    hypre_ParILUDataUpperJacobiIters(ilu_data)); //BJ, Jacobi
+            }
+            else
+            {
+               hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            }
 #endif
             break;
          case 10: case 11:
@@ -793,6 +813,207 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 }
 
 
+/* Incomplete LU solve with level-scheduled substitution
+ * Same as hypre_ILUSolveLU, but the rows of the L and U factors are visited
+ * level by level (see hypre_ILUSetupLevelSets). The rows in a level are
+ * independent and are split over the OpenMP threads, with a barrier between
+ * levels. Each row is computed exactly as in hypre_ILUSolveLU, so the result
+ * does not depend on the number of threads.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLULevels(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+                       hypre_ParVector    *u, HYPRE_Int *perm,
+                       HYPRE_Int nLU, hypre_ParCSRMatrix *L,
+                       HYPRE_Real* D, hypre_ParCSRMatrix *U,
+                       hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                       HYPRE_Int num_L_levels, HYPRE_Int *L_level_ptr, HYPRE_Int *L_level_rows,
+                       HYPRE_Int num_U_levels, HYPRE_Int *U_level_ptr, HYPRE_Int *U_level_rows)
+{
+   hypre_CSRMatrix *L_diag = hypre_ParCSRMatrixDiag(L);
+   HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int       *L_diag_i = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int       *L_diag_j = hypre_CSRMatrixJ(L_diag);
+
+   hypre_CSRMatrix *U_diag = hypre_ParCSRMatrixDiag(U);
+   HYPRE_Real      *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int       *U_diag_i = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int       *U_diag_j = hypre_CSRMatrixJ(U_diag);
+
+   hypre_Vector    *utemp_local = hypre_ParVectorLocalVector(utemp);
+   HYPRE_Real      *utemp_data  = hypre_VectorData(utemp_local);
+
+   hypre_Vector    *ftemp_local = hypre_ParVectorLocalVector(ftemp);
+   HYPRE_Real      *ftemp_data  = hypre_VectorData(ftemp_local);
+
+   HYPRE_Real      alpha;
+   HYPRE_Real      beta;
+   HYPRE_Real      value;
+   HYPRE_Int       i, j, k, lev;
+
+   /* begin */
+   alpha = -1.0;
+   beta = 1.0;
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, j, k, lev, value)
+#endif
+   {
+      /* L solve - Forward solve, the diagonal of L is identity */
+      for (lev = 0; lev < num_L_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (k = L_level_ptr[lev]; k < L_level_ptr[lev+1]; k++)
+         {
+            i = L_level_rows[k];
+            value = ftemp_data[perm[i]];
+            for (j = L_diag_i[i]; j < L_diag_i[i+1]; j++)
+            {
+               value -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+            }
+            utemp_data[perm[i]] = value;
+         }
+      }
+
+      /* U solve - Backward substitution, D is stored as its inverse */
+      for (lev = 0; lev < num_U_levels; lev++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (k = U_level_ptr[lev]; k < U_level_ptr[lev+1]; k++)
+         {
+            i = U_level_rows[k];
+            value = utemp_data[perm[i]];
+            for (j = U_diag_i[i]; j < U_diag_i[i+1]; j++)
+            {
+               value -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
+            }
+            utemp_data[perm[i]] = value * D[i];
+         }
+      }
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
+
+   return hypre_error_flag;
+}
+
+/* Jacobi iterations x_i <- D_i (b_i - sum_j T_ij x_j) on a triangular factor
+ * T without its diagonal, starting from x_i = D_i b_i. D = NULL stands for a
+ * unit diagonal. Entries are addressed through perm, as in hypre_ILUSolveLU.
+ * x and work are overwritten, returns the one holding the last iterate.
+ */
+static HYPRE_Real *
+hypre_ILUSolveJacobiIter(HYPRE_Int nLU, HYPRE_Int *perm,
+                         HYPRE_Int *T_i, HYPRE_Int *T_j, HYPRE_Real *T_data,
+                         HYPRE_Real *D, HYPRE_Real *b, HYPRE_Real *x,
+                         HYPRE_Real *work, HYPRE_Int num_iters)
+{
+   HYPRE_Real      *x_old = x;
+   HYPRE_Real      *x_new = work;
+   HYPRE_Real      *swap;
+   HYPRE_Real      value;
+   HYPRE_Int       i, j, iter;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < nLU; i++)
+   {
+      x_old[perm[i]] = D ? D[i] * b[perm[i]] : b[perm[i]];
+   }
+
+   for (iter = 0; iter < num_iters; iter++)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i, j, value) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         value = b[perm[i]];
+         for (j = T_i[i]; j < T_i[i+1]; j++)
+         {
+            value -= T_data[j] * x_old[perm[T_j[j]]];
+         }
+         x_new[perm[i]] = D ? D[i] * value : value;
+      }
+      swap = x_old; x_old = x_new; x_new = swap;
+   }
+
+   return x_old;
+}
+
+/* Incomplete LU solve with approximate triangular solves
+ * The L and U solves of hypre_ILUSolveLU are replaced by a fixed number of
+ * Jacobi iterations each, which are fully parallel over the rows. Since L and
+ * U are triangular the iterations are exact after as many sweeps as there are
+ * levels, and a few sweeps are usually enough for a preconditioner.
+ * xtemp is an additional work vector.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+                     hypre_ParVector    *u, HYPRE_Int *perm,
+                     HYPRE_Int nLU, hypre_ParCSRMatrix *L,
+                     HYPRE_Real* D, hypre_ParCSRMatrix *U,
+                     hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                     hypre_ParVector *xtemp, HYPRE_Int lower_jacobi_iters,
+                     HYPRE_Int upper_jacobi_iters)
+{
+   hypre_CSRMatrix *L_diag = hypre_ParCSRMatrixDiag(L);
+   hypre_CSRMatrix *U_diag = hypre_ParCSRMatrixDiag(U);
+
+   HYPRE_Real      *utemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(utemp));
+   HYPRE_Real      *ftemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(ftemp));
+   HYPRE_Real      *xtemp_data  = hypre_VectorData(hypre_ParVectorLocalVector(xtemp));
+   HYPRE_Real      *y, *x;
+
+   HYPRE_Real      alpha;
+   HYPRE_Real      beta;
+   HYPRE_Int       i;
+
+   /* begin */
+   alpha = -1.0;
+   beta = 1.0;
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+   /* L solve, y ends up in utemp or xtemp */
+   y = hypre_ILUSolveJacobiIter(nLU, perm, hypre_CSRMatrixI(L_diag), hypre_CSRMatrixJ(L_diag),
+                                hypre_CSRMatrixData(L_diag), NULL, ftemp_data,
+                                utemp_data, xtemp_data, lower_jacobi_iters);
+
+   /* U solve, the residual is no longer needed and ftemp becomes work space */
+   x = hypre_ILUSolveJacobiIter(nLU, perm, hypre_CSRMatrixI(U_diag), hypre_CSRMatrixJ(U_diag),
+                                hypre_CSRMatrixData(U_diag), D, y,
+                                y == utemp_data ? xtemp_data : utemp_data,
+                                ftemp_data, upper_jacobi_iters);
+
+   if (x != utemp_data)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nLU; i++)
+      {
+         utemp_data[perm[i]] = x[perm[i]];
+      }
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
+
+   return hypre_error_flag;
+}
+
 /* Incomplete LU solve RAS
  * L, D and U factors only have local scope (no off-diagonal processor terms)
  * so apart from the residual calculation (which uses A), the solves with the
@@ -178,6 +178,61 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdStart
+ *
+ * Starts result[k] = <x[k],y[k]>, k < n, as one non-blocking reduction.
+ * local must stay untouched until hypre_ParKrylovInnerProdWait returns.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdStart( HYPRE_Int           n,
+                               void              **x,
+                               void              **y,
+                               HYPRE_Real         *local,
+                               HYPRE_Real         *result,
+                               hypre_MPI_Request  *request )
+{
+   HYPRE_Int k;
+
+   for (k = 0; k < n; k++)
+   {
+      local[k] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector((hypre_ParVector *) x[k]),
+                                          hypre_ParVectorLocalVector((hypre_ParVector *) y[k]));
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Iallreduce(local, result, n, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                        hypre_ParVectorComm((hypre_ParVector *) x[0]), request);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdWait
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdWait( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Wait(request, &status);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -188,6 +243,17 @@ hypre_ParKrylovMassInnerProd( void *x,
    return ( hypre_ParVectorMassInnerProd( (hypre_ParVector *) x,(hypre_ParVector **) y, k, unroll, (HYPRE_Real*)result ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovMassInnerProdMult
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_ParKrylovMassInnerProdMult( void **x, HYPRE_Int nx,
+                                  void **y, HYPRE_Int k, HYPRE_Int unroll, void *result )
+{
+   return ( hypre_ParVectorMassInnerProdMult( (hypre_ParVector **) x, nx, (hypre_ParVector **) y, k,
+            unroll, (HYPRE_Real *) result ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassDotpTwo
  *--------------------------------------------------------------------------*/
@@ -247,6 +313,50 @@ hypre_ParKrylovAxpy( HYPRE_Complex alpha,
                                  (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovAxpyInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParKrylovAxpyInnerProd( HYPRE_Complex alpha,
+                              void   *x,
+                              void   *y )
+{
+   return ( hypre_ParVectorAxpyInnerProd( alpha, (hypre_ParVector *) x,
+                                          (hypre_ParVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovAxpy2InnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParKrylovAxpy2InnerProd( HYPRE_Complex alpha,
+                               void   *x,
+                               void   *y,
+                               HYPRE_Complex beta,
+                               void   *z,
+                               void   *w )
+{
+   return ( hypre_ParVectorAxpy2InnerProd( alpha, (hypre_ParVector *) x,
+                                           (hypre_ParVector *) y,
+                                           beta, (hypre_ParVector *) z,
+                                           (hypre_ParVector *) w ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovXpay
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovXpay( HYPRE_Complex beta,
+                     void   *x,
+                     void   *y )
+{
+   return ( hypre_ParVectorXpay( beta, (hypre_ParVector *) x,
+                                 (hypre_ParVector *) y ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassAxpy
  *--------------------------------------------------------------------------*/
@@ -34,6 +34,12 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 {
    HYPRE_Int relax_error = 0;
 
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      return hypre_BoomerAMGRelaxMultiVec(A, f, cf_marker, relax_type, relax_points, relax_weight,
+                                          omega, l1_norms, u, Vtemp, Ztemp);
+   }
+
    /*---------------------------------------------------------------------------------------
     * Switch statement to direct control based on relax_type:
     *     relax_type =  0 -> Jacobi or CF-Jacobi
@@ -68,6 +74,10 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
     *     relax_type = 20 -> Kaczmarz
     *     relax_type = 29 -> Direct solve: use gaussian elimination & BLAS
     *                        (with pivoting) (old version)
+    *     relax_type = 40 -> hybrid multicolor Gauss-Seidel/SOR
+    *     relax_type = 41 -> hybrid multicolor Symm. Gauss-Seidel/SSOR
+    *                        (the coloring is set up by BoomerAMG; without
+    *                        one these are the same as 3 and 6)
     *     relax_type = 98 -> Direct solve, Gaussian elimination
     *     relax_type = 99 -> Direct solve, Gaussian elimination
     *     relax_type = 199-> Direct solve, Gaussian elimination
@@ -145,6 +155,12 @@ hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          hypre_BoomerAMGRelaxKaczmarz(A, f, omega, l1_norms, u);
          break;
 
+      case 40: /* hybrid multicolor Gauss-Seidel, no coloring given */
+      case 41: /* hybrid multicolor Symm. Gauss-Seidel, no coloring given */
+         hypre_BoomerAMGRelaxMulticolorGaussSeidel(A, f, cf_marker, relax_points, relax_weight, omega,
+                                                   0, NULL, NULL, u, Vtemp, Ztemp, relax_type == 41);
+         break;
+
       case 98: /* Direct solve: use gaussian elimination & BLAS (with pivoting) */
          relax_error = hypre_BoomerAMGRelax98GaussElimPivot(A, f, u);
          break;
@@ -173,6 +189,8 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
    HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
    HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   float               *A_diag_fdata  = hypre_CSRMatrixFloatData(A_diag);
+   float               *A_offd_fdata  = hypre_CSRMatrixFloatData(A_offd);
    hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
    HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
    HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
@@ -234,40 +252,84 @@ hypre_BoomerAMGRelaxWeightedJacobi_core( hypre_ParCSRMatrix *A,
    /*-----------------------------------------------------------------
     * Relax all points.
     *-----------------------------------------------------------------*/
+   if (A_diag_fdata || A_offd_fdata)
+   {
+      /* single precision storage, see hypre_ParCSRMatrixConvertToFloat */
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
 #endif
-   for (i = 0; i < num_rows; i++)
-   {
-      const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
-
-      /*-----------------------------------------------------------
-       * If i is of the right type ( C or F or All ) and diagonal is
-       * nonzero, relax point i; otherwise, skip it.
-       * Relax only C or F points as determined by relax_points.
-       *-----------------------------------------------------------*/
-      if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+      for (i = 0; i < num_rows; i++)
       {
-         res = f_data[i];
-         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
-         {
-            ii = A_diag_j[jj];
-            res -= A_diag_data[jj] * Vtemp_data[ii];
-         }
-         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         const HYPRE_Complex di = l1_norms ? l1_norms[i] : (HYPRE_Complex) A_diag_fdata[A_diag_i[i]];
+
+         /*-----------------------------------------------------------
+          * If i is of the right type ( C or F or All ) and diagonal is
+          * nonzero, relax point i; otherwise, skip it.
+          * Relax only C or F points as determined by relax_points.
+          *-----------------------------------------------------------*/
+         if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
          {
-            ii = A_offd_j[jj];
-            res -= A_offd_data[jj] * v_ext_data[ii];
-         }
+            res = f_data[i];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= (HYPRE_Complex) A_diag_fdata[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= (HYPRE_Complex) A_offd_fdata[jj] * v_ext_data[ii];
+            }
 
-         if (Skip_diag)
-         {
-            u_data[i] *= one_minus_weight;
-            u_data[i] += relax_weight * res / di;
+            if (Skip_diag)
+            {
+               u_data[i] *= one_minus_weight;
+               u_data[i] += relax_weight * res / di;
+            }
+            else
+            {
+               u_data[i] += relax_weight * res / di;
+            }
          }
-         else
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii,jj,res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+         /*-----------------------------------------------------------
+          * If i is of the right type ( C or F or All ) and diagonal is
+          * nonzero, relax point i; otherwise, skip it.
+          * Relax only C or F points as determined by relax_points.
+          *-----------------------------------------------------------*/
+         if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
          {
-            u_data[i] += relax_weight * res / di;
+            res = f_data[i];
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               res -= A_diag_data[jj] * Vtemp_data[ii];
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               res -= A_offd_data[jj] * v_ext_data[ii];
+            }
+
+            if (Skip_diag)
+            {
+               u_data[i] *= one_minus_weight;
+               u_data[i] += relax_weight * res / di;
+            }
+            else
+            {
+               u_data[i] += relax_weight * res / di;
+            }
          }
       }
    }
@@ -632,6 +694,8 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
    HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
    HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
    HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   float               *A_diag_fdata  = hypre_CSRMatrixFloatData(A_diag);
+   float               *A_offd_fdata  = hypre_CSRMatrixFloatData(A_offd);
    hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
    HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
    HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
@@ -651,13 +715,27 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
 
    const HYPRE_Real     one_minus_omega  = 1.0 - omega;
    HYPRE_Int            num_procs, my_id, num_threads, j, num_sends;
+   HYPRE_Int            overlap;
+   /* single precision storage, see hypre_ParCSRMatrixConvertToFloat */
+   const HYPRE_Int      use_float = A_diag_fdata || A_offd_fdata;
 
-   hypre_ParCSRCommHandle *comm_handle;
+   hypre_ParCSRCommHandle *comm_handle = NULL;
 
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    num_threads = forced_seq ? 1 : hypre_NumThreads();
 
+   if (use_float && Topo_order)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Topological ordering requires HYPRE_Complex matrix values\n");
+      return hypre_error_flag;
+   }
+
+   /* relax the interior rows while the halo exchange is in flight, then the
+    * boundary rows. This changes the order in which the rows are relaxed. */
+   overlap = num_procs > 1 && num_threads == 1 && !Topo_order &&
+             hypre_HandleRelaxHaloOverlap(hypre_handle());
+
    /* GS order: forward or backward */
    const HYPRE_Int gs_order = GS_order > 0 ? 1 : -1;
    /* for symmetric GS, a forward followed by a backward */
@@ -677,7 +755,7 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
 
 #if defined(HYPRE_USING_PERSISTENT_COMM)
    // JSP: persistent comm can be similarly used for other smoothers
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 #endif
 
    if (num_procs > 1)
@@ -724,12 +802,15 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
       comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
 #endif
 
+      if (!overlap)
+      {
 #if defined(HYPRE_USING_PERSISTENT_COMM)
-      hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
+         hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
 #else
-      hypre_ParCSRCommHandleDestroy(comm_handle);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
 #endif
-      comm_handle = NULL;
+         comm_handle = NULL;
+      }
 
 #ifdef HYPRE_PROFILE
       hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
@@ -788,7 +869,14 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
             const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
             const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
 
-            if (non_scale)
+            if (use_float)
+            {
+               hypre_HybridGaussSeidelFloat(A_diag_i, A_diag_j, A_diag_fdata, A_offd_i, A_offd_j, A_offd_fdata,
+                                            f_data, cf_marker, relax_points, non_scale, relax_weight, omega,
+                                            one_minus_omega, prod, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                            ns, ne, ibegin, iend, iorder, NULL, Skip_diag);
+            }
+            else if (non_scale)
             {
                hypre_HybridGaussSeidelNSThreads(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
                                                 f_data, cf_marker, relax_points, l1_norms, u_data, Vtemp_data, v_ext_data,
@@ -803,6 +891,71 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
          } /* for (sweep = 0; sweep < num_sweeps; sweep++) */
       } /* for (j = 0; j < num_threads; j++) */
    }
+   else if (overlap)
+   {
+      HYPRE_Int  sweep;
+      HYPRE_Int *halo_rows;
+      HYPRE_Int  num_interior;
+
+      hypre_ParCSRMatrixSetHaloRowOrder(A);
+      halo_rows    = hypre_ParCSRMatrixHaloRowOrder(A);
+      num_interior = hypre_ParCSRMatrixNumInteriorRows(A);
+
+      /* The rows are relaxed in the order of halo_rows (interior rows first)
+       * or in its reverse. The first sweep is split in two parts, the interior
+       * rows, relaxed while the halo is in flight, and the boundary rows. */
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+         const HYPRE_Int num_parts = sweep == 0 ? 2 : 1;
+         HYPRE_Int       part;
+
+         for (part = 0; part < num_parts; part++)
+         {
+            const HYPRE_Int lo = num_parts == 1 || part == 0 ? 0 : num_interior;
+            const HYPRE_Int hi = num_parts == 1 || part == 1 ? num_rows : num_interior;
+            const HYPRE_Int ibegin = iorder > 0 ? lo : hi - 1;
+            const HYPRE_Int iend = iorder > 0 ? hi : lo - 1;
+
+            if (num_parts == 2 && part == 1)
+            {
+#ifdef HYPRE_PROFILE
+               hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+               hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_ext_data);
+#else
+               hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+               comm_handle = NULL;
+#ifdef HYPRE_PROFILE
+               hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+            }
+
+            if (use_float)
+            {
+               hypre_HybridGaussSeidelFloat(A_diag_i, A_diag_j, A_diag_fdata, A_offd_i, A_offd_j, A_offd_fdata,
+                                            f_data, cf_marker, relax_points, non_scale, relax_weight, omega,
+                                            one_minus_omega, prod, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                            0, num_rows, ibegin, iend, iorder, halo_rows, Skip_diag);
+            }
+            else if (non_scale)
+            {
+               hypre_HybridGaussSeidelPermNS(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                             f_data, cf_marker, relax_points, l1_norms, u_data, v_ext_data,
+                                             ibegin, iend, iorder, halo_rows, Skip_diag);
+            }
+            else
+            {
+               hypre_HybridGaussSeidelPerm(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                           f_data, cf_marker, relax_points, relax_weight, omega, one_minus_omega,
+                                           prod, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                           ibegin, iend, iorder, halo_rows, Skip_diag);
+            }
+         }
+      } /* for (sweep = 0; sweep < num_sweeps; sweep++) */
+   }
    else /* if (num_threads > 1) */
    {
       HYPRE_Int sweep;
@@ -818,6 +971,13 @@ hypre_BoomerAMGRelaxHybridGaussSeidel_core( hypre_ParCSRMatrix *A,
                                              f_data, cf_marker, relax_points, u_data, NULL, v_ext_data,
                                              ibegin, iend, iorder, proc_ordering);
          }
+         else if (use_float)
+         {
+            hypre_HybridGaussSeidelFloat(A_diag_i, A_diag_j, A_diag_fdata, A_offd_i, A_offd_j, A_offd_fdata,
+                                         f_data, cf_marker, relax_points, non_scale, relax_weight, omega,
+                                         one_minus_omega, prod, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                         0, num_rows, ibegin, iend, iorder, NULL, Skip_diag);
+         }
          else
          {
             if (non_scale)
@@ -1685,3 +1845,752 @@ hypre_BoomerAMGRelax12TwoStageGaussSeidel( hypre_ParCSRMatrix *A,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorSetup
+ *
+ * Greedy distance-1 coloring of the graph of A_diag + A_diag^T. On return,
+ * color_order lists the local rows grouped by color: the rows of color c are
+ * color_order[color_ptr[c]], ..., color_order[color_ptr[c+1]-1]. Rows of the
+ * same color are not coupled in A_diag and can be relaxed concurrently.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorSetup( hypre_ParCSRMatrix  *A,
+                                     HYPRE_Int           *num_colors_ptr,
+                                     HYPRE_Int          **color_ptr_ptr,
+                                     HYPRE_Int          **color_order_ptr )
+{
+   hypre_CSRMatrix *A_diag    = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i  = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j  = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int        num_rows  = hypre_CSRMatrixNumRows(A_diag);
+   hypre_CSRMatrix *AT_diag;
+   HYPRE_Int       *AT_diag_i;
+   HYPRE_Int       *AT_diag_j;
+   HYPRE_Int       *color;
+   HYPRE_Int       *mark;
+   HYPRE_Int       *color_ptr;
+   HYPRE_Int       *color_order;
+   HYPRE_Int        num_colors = 0;
+   HYPRE_Int        i, jj, c;
+
+   /* rows coupled through either A_diag or its transpose must differ */
+   hypre_CSRMatrixTransposeHost(A_diag, &AT_diag, 0);
+   AT_diag_i = hypre_CSRMatrixI(AT_diag);
+   AT_diag_j = hypre_CSRMatrixJ(AT_diag);
+
+   color = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   /* mark[c] == i: color c is used by a neighbor of row i */
+   mark  = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (c = 0; c < num_rows + 1; c++)
+   {
+      mark[c] = -1;
+   }
+
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+      {
+         if (A_diag_j[jj] < i)
+         {
+            mark[color[A_diag_j[jj]]] = i;
+         }
+      }
+      for (jj = AT_diag_i[i]; jj < AT_diag_i[i+1]; jj++)
+      {
+         if (AT_diag_j[jj] < i)
+         {
+            mark[color[AT_diag_j[jj]]] = i;
+         }
+      }
+      for (c = 0; mark[c] == i; c++);
+      color[i] = c;
+      num_colors = hypre_max(num_colors, c + 1);
+   }
+
+   /* bucket the rows by color, keeping the natural order within a color */
+   color_ptr = hypre_CTAlloc(HYPRE_Int, num_colors + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      color_ptr[color[i] + 1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      color_ptr[c + 1] += color_ptr[c];
+      mark[c] = color_ptr[c];
+   }
+   color_order = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      color_order[mark[color[i]]++] = i;
+   }
+
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(mark, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(AT_diag);
+
+   *num_colors_ptr  = num_colors;
+   *color_ptr_ptr   = color_ptr;
+   *color_order_ptr = color_order;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorGaussSeidel
+ *
+ * Hybrid multicolor Gauss-Seidel/SOR: Jacobi off-processor, Gauss-Seidel
+ * on-processor with the rows visited color by color (relax types 40, 41).
+ * The rows of a color are relaxed in parallel, so the result does not
+ * depend on the number of threads. Symm = 1 follows the forward sweep by
+ * one over the colors in reverse order (symmetric GS/SSOR). relax_weight and
+ * omega enter the update as in hypre_HybridGaussSeidel (types 3 and 6), with
+ * Vtemp holding u from before the sweeps.
+ * Without a coloring, or for device data, this falls back to hybrid GS.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorGaussSeidel( hypre_ParCSRMatrix *A,
+                                           hypre_ParVector    *f,
+                                           HYPRE_Int          *cf_marker,
+                                           HYPRE_Int           relax_points,
+                                           HYPRE_Real          relax_weight,
+                                           HYPRE_Real          omega,
+                                           HYPRE_Int           num_colors,
+                                           HYPRE_Int          *color_ptr,
+                                           HYPRE_Int          *color_order,
+                                           hypre_ParVector    *u,
+                                           hypre_ParVector    *Vtemp,
+                                           hypre_ParVector    *Ztemp,
+                                           HYPRE_Int           Symm )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_Vector        *u_local       = hypre_ParVectorLocalVector(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(u_local);
+   HYPRE_Complex       *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex       *Vtemp_data    = Vtemp ? hypre_VectorData(hypre_ParVectorLocalVector(Vtemp)) : NULL;
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+
+   const HYPRE_Real     one_minus_omega = 1.0 - omega;
+   const HYPRE_Int      num_sweeps      = Symm ? 2 : 1;
+   /* if relax_weight and omega are both 1.0 */
+   const HYPRE_Int      non_scale       = relax_weight == 1.0 && omega == 1.0;
+   const HYPRE_Real     prod            = 1.0 - relax_weight * omega;
+   HYPRE_Int            num_procs, num_sends, begin, end, sweep, k, c, j;
+
+   hypre_ParCSRCommHandle *comm_handle;
+
+   if (!color_order || (!non_scale && !Vtemp_data) ||
+       hypre_CSRMatrixFloatData(A_diag) || hypre_CSRMatrixFloatData(A_offd) ||
+       hypre_GetExecPolicy1(hypre_VectorMemoryLocation(u_local)) != HYPRE_EXEC_HOST)
+   {
+      return hypre_BoomerAMGRelax(A, f, cf_marker, Symm ? 6 : 3, relax_points, relax_weight,
+                                  omega, NULL, u, Vtemp, Ztemp);
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (num_procs > 1)
+   {
+      if (!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin      = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end        = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+      v_buf_data = hypre_CTAlloc(HYPRE_Real, end, HYPRE_MEMORY_HOST);
+      v_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = begin; j < end; j++)
+      {
+         v_buf_data[j - begin] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, v_ext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      comm_handle = NULL;
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+   }
+
+   if (!non_scale)
+   {
+      hypre_ParVectorCopy(u, Vtemp);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   for (sweep = 0; sweep < num_sweeps; sweep++)
+   {
+      for (k = 0; k < num_colors; k++)
+      {
+         c = sweep == 0 ? k : num_colors - 1 - k;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+         for (j = color_ptr[c]; j < color_ptr[c+1]; j++)
+         {
+            const HYPRE_Int i = color_order[j];
+            HYPRE_Int       jj;
+            HYPRE_Complex   res, res0, res2;
+
+            if ( (relax_points == 0 || cf_marker[i] == relax_points) &&
+                 A_diag_data[A_diag_i[i]] != 0.0 )
+            {
+               res = f_data[i];
+               for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+               {
+                  res -= A_offd_data[jj] * v_ext_data[A_offd_j[jj]];
+               }
+               if (non_scale)
+               {
+                  for (jj = A_diag_i[i] + 1; jj < A_diag_i[i+1]; jj++)
+                  {
+                     res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+                  }
+                  u_data[i] = res / A_diag_data[A_diag_i[i]];
+               }
+               else
+               {
+                  res0 = 0.0;
+                  res2 = 0.0;
+                  for (jj = A_diag_i[i] + 1; jj < A_diag_i[i+1]; jj++)
+                  {
+                     res0 -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+                     res2 += A_diag_data[jj] * Vtemp_data[A_diag_j[jj]];
+                  }
+                  u_data[i] *= prod;
+                  u_data[i] += relax_weight * (omega * res + res0 + one_minus_omega * res2) /
+                               A_diag_data[A_diag_i[i]];
+               }
+            }
+         }
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVecHaloStart, hypre_BoomerAMGRelaxMultiVecHaloWait
+ *
+ * Exchange of the halo of a row-wise multivector u. The start allocates
+ * v_ext_data (and v_buf_data without persistent communication), both are
+ * freed by the caller. With persistent communication, the handle of the
+ * comm_pkg for num_vectors is used; its buffers hold one vector after the
+ * other, so the wait transposes the received halo into v_ext_data.
+ *--------------------------------------------------------------------------*/
+
+static void *
+hypre_BoomerAMGRelaxMultiVecHaloStart( hypre_ParCSRMatrix  *A,
+                                       HYPRE_Complex       *u_data,
+                                       HYPRE_Int            num_vectors,
+                                       HYPRE_Complex      **v_buf_ptr,
+                                       HYPRE_Complex      **v_ext_ptr )
+{
+   hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Int            num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Int            num_sends, send_size, i, v;
+   HYPRE_Complex       *v_buf_data;
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+#endif
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   *v_ext_ptr = hypre_TAlloc(HYPRE_Complex, num_cols_offd * num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentMultiVecCommHandle(1, comm_pkg, num_vectors);
+   v_buf_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+   *v_buf_ptr = NULL;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,v) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < send_size; i++)
+   {
+      const HYPRE_Complex *u_i = u_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * num_vectors;
+
+      for (v = 0; v < num_vectors; v++)
+      {
+         v_buf_data[v * send_size + i] = u_i[v];
+      }
+   }
+
+   hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+
+   return (void *) persistent_comm_handle;
+#else
+   v_buf_data = hypre_TAlloc(HYPRE_Complex, send_size * num_vectors, HYPRE_MEMORY_HOST);
+   *v_buf_ptr = v_buf_data;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,v) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < send_size; i++)
+   {
+      const HYPRE_Complex *u_i = u_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * num_vectors;
+
+      for (v = 0; v < num_vectors; v++)
+      {
+         v_buf_data[i * num_vectors + v] = u_i[v];
+      }
+   }
+
+   return (void *) hypre_ParCSRCommHandleCreateMultiVec(1, comm_pkg, num_vectors,
+                                                        v_buf_data, *v_ext_ptr);
+#endif
+}
+
+static void
+hypre_BoomerAMGRelaxMultiVecHaloWait( hypre_ParCSRMatrix  *A,
+                                      void                *comm_handle,
+                                      HYPRE_Int            num_vectors,
+                                      HYPRE_Complex       *v_ext_data )
+{
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle =
+      (hypre_ParCSRPersistentCommHandle *) comm_handle;
+   HYPRE_Int      num_cols_offd = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A));
+   HYPRE_Complex *v_recv_data;
+   HYPRE_Int      i, v;
+
+   v_recv_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+   hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, v_recv_data);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,v) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      for (v = 0; v < num_vectors; v++)
+      {
+         v_ext_data[i * num_vectors + v] = v_recv_data[v * num_cols_offd + i];
+      }
+   }
+#else
+   hypre_ParCSRCommHandleDestroy((hypre_ParCSRCommHandle *) comm_handle);
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVecJacobi
+ *
+ * Weighted (l1-)Jacobi on a row-wise multivector, see
+ * hypre_BoomerAMGRelaxWeightedJacobi_core.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGRelaxMultiVecJacobi( hypre_ParCSRMatrix *A,
+                                    hypre_ParVector    *f,
+                                    HYPRE_Int          *cf_marker,
+                                    HYPRE_Int           relax_points,
+                                    HYPRE_Real          relax_weight,
+                                    HYPRE_Real         *l1_norms,
+                                    hypre_ParVector    *u,
+                                    hypre_ParVector    *Vtemp,
+                                    HYPRE_Int           Skip_diag )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_vectors   = hypre_ParVectorNumVectors(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex       *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex       *Vtemp_data    = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+   HYPRE_Complex       *res_data;
+
+   const HYPRE_Complex  zero             = 0.0;
+   const HYPRE_Real     one_minus_weight = 1.0 - relax_weight;
+
+   HYPRE_Int num_procs, i, v;
+   void     *comm_handle = NULL;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (num_procs > 1)
+   {
+      comm_handle = hypre_BoomerAMGRelaxMultiVecHaloStart(A, u_data, num_vectors, &v_buf_data, &v_ext_data);
+   }
+
+   /*-----------------------------------------------------------------
+    * Copy current approximation into temporary vector.
+    *-----------------------------------------------------------------*/
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows * num_vectors; i++)
+   {
+      Vtemp_data[i] = u_data[i];
+   }
+
+   if (num_procs > 1)
+   {
+      hypre_BoomerAMGRelaxMultiVecHaloWait(A, comm_handle, num_vectors, v_ext_data);
+      comm_handle = NULL;
+   }
+
+   res_data = hypre_TAlloc(HYPRE_Complex, hypre_NumThreads() * num_vectors, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------
+    * Relax all points.
+    *-----------------------------------------------------------------*/
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,v)
+#endif
+   {
+      HYPRE_Complex *res = res_data + hypre_GetThreadNum() * num_vectors;
+      HYPRE_Int      ii, jj;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         const HYPRE_Complex di = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+         if ( (relax_points == 0 || cf_marker[i] == relax_points) && di != zero )
+         {
+            HYPRE_Complex *u_i = u_data + i * num_vectors;
+
+            for (v = 0; v < num_vectors; v++)
+            {
+               res[v] = f_data[i * num_vectors + v];
+            }
+            for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               for (v = 0; v < num_vectors; v++)
+               {
+                  res[v] -= A_diag_data[jj] * Vtemp_data[ii * num_vectors + v];
+               }
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               for (v = 0; v < num_vectors; v++)
+               {
+                  res[v] -= A_offd_data[jj] * v_ext_data[ii * num_vectors + v];
+               }
+            }
+
+            for (v = 0; v < num_vectors; v++)
+            {
+               if (Skip_diag)
+               {
+                  u_i[v] *= one_minus_weight;
+               }
+               u_i[v] += relax_weight * res[v] / di;
+            }
+         }
+      }
+   }
+
+   hypre_TFree(res_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVecHybridGaussSeidel
+ *
+ * Hybrid Gauss-Seidel/SOR on a row-wise multivector, see
+ * hypre_BoomerAMGRelaxHybridGaussSeidel_core. The halo exchange is not
+ * overlapped with the relaxation.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGRelaxMultiVecHybridGaussSeidel( hypre_ParCSRMatrix *A,
+                                               hypre_ParVector    *f,
+                                               HYPRE_Int          *cf_marker,
+                                               HYPRE_Int           relax_points,
+                                               HYPRE_Real          relax_weight,
+                                               HYPRE_Real          omega,
+                                               HYPRE_Real         *l1_norms,
+                                               hypre_ParVector    *u,
+                                               hypre_ParVector    *Vtemp,
+                                               HYPRE_Int           GS_order,
+                                               HYPRE_Int           Symm,
+                                               HYPRE_Int           Skip_diag )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real          *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real          *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_vectors   = hypre_ParVectorNumVectors(u);
+   HYPRE_Complex       *u_data        = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex       *f_data        = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex       *Vtemp_data    = Vtemp ? hypre_VectorData(hypre_ParVectorLocalVector(Vtemp)) : NULL;
+   HYPRE_Complex       *v_ext_data    = NULL;
+   HYPRE_Complex       *v_buf_data    = NULL;
+   HYPRE_Complex       *res_data;
+
+   const HYPRE_Real     one_minus_omega = 1.0 - omega;
+   HYPRE_Int            num_procs, num_threads, j;
+
+   void                *comm_handle;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   num_threads = hypre_NumThreads();
+
+   /* GS order: forward or backward */
+   const HYPRE_Int gs_order = GS_order > 0 ? 1 : -1;
+   /* for symmetric GS, a forward followed by a backward */
+   const HYPRE_Int num_sweeps = Symm ? 2 : 1;
+   /* if relax_weight and omega are both 1.0 */
+   const HYPRE_Int non_scale = relax_weight == 1.0 && omega == 1.0;
+   /* */
+   const HYPRE_Real prod = 1.0 - relax_weight * omega;
+
+   if (num_procs > 1)
+   {
+      comm_handle = hypre_BoomerAMGRelaxMultiVecHaloStart(A, u_data, num_vectors, &v_buf_data, &v_ext_data);
+      hypre_BoomerAMGRelaxMultiVecHaloWait(A, comm_handle, num_vectors, v_ext_data);
+   }
+
+   if ( (num_threads > 1 || !non_scale) && Vtemp_data )
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+      for (j = 0; j < num_rows * num_vectors; j++)
+      {
+         Vtemp_data[j] = u_data[j];
+      }
+   }
+
+   res_data = hypre_TAlloc(HYPRE_Complex, 3 * num_threads * num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE
+#endif
+   for (j = 0; j < num_threads; j++)
+   {
+      HYPRE_Int ns, ne, sweep;
+
+      if (num_threads > 1)
+      {
+         hypre_partition1D(num_rows, num_threads, j, &ns, &ne);
+      }
+      else
+      {
+         ns = 0;
+         ne = num_rows;
+      }
+
+      for (sweep = 0; sweep < num_sweeps; sweep++)
+      {
+         const HYPRE_Int iorder = num_sweeps == 1 ? gs_order : sweep == 0 ? 1 : -1;
+         const HYPRE_Int ibegin = iorder > 0 ? ns : ne - 1;
+         const HYPRE_Int iend = iorder > 0 ? ne : ns - 1;
+
+         hypre_HybridGaussSeidelMultiVec(A_diag_i, A_diag_j, A_diag_data, A_offd_i, A_offd_j, A_offd_data,
+                                         f_data, cf_marker, relax_points, non_scale, relax_weight, omega,
+                                         one_minus_omega, prod, l1_norms, u_data, Vtemp_data, v_ext_data,
+                                         num_vectors, res_data + 3 * j * num_vectors,
+                                         ns, ne, ibegin, iend, iorder, Skip_diag);
+      }
+   }
+
+   hypre_TFree(res_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_ext_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMultiVec
+ *
+ * Relaxation of a multivector f, u with num_vectors right-hand sides. For
+ * row-wise storage (multivec_storage_method = 1) with HYPRE_Complex matrix
+ * values on the host, Jacobi (0, 7, 18) and hybrid Gauss-Seidel (3, 4, 6, 8,
+ * 13, 14) read A once per sweep for all vectors. Otherwise the vectors are
+ * relaxed one at a time through copies.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMultiVec( hypre_ParCSRMatrix *A,
+                              hypre_ParVector    *f,
+                              HYPRE_Int          *cf_marker,
+                              HYPRE_Int           relax_type,
+                              HYPRE_Int           relax_points,
+                              HYPRE_Real          relax_weight,
+                              HYPRE_Real          omega,
+                              HYPRE_Real         *l1_norms,
+                              hypre_ParVector    *u,
+                              hypre_ParVector    *Vtemp,
+                              hypre_ParVector    *Ztemp )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   hypre_Vector    *f_local     = hypre_ParVectorLocalVector(f);
+   hypre_Vector    *u_local     = hypre_ParVectorLocalVector(u);
+   HYPRE_Int        num_vectors = hypre_VectorNumVectors(f_local);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        row_wise;
+   HYPRE_Int        relax_error = 0;
+
+   row_wise = hypre_VectorIndexStride(f_local) == num_vectors &&
+              hypre_VectorIndexStride(u_local) == num_vectors &&
+              Vtemp && hypre_ParVectorNumVectors(Vtemp) == num_vectors &&
+              hypre_VectorIndexStride(hypre_ParVectorLocalVector(Vtemp)) == num_vectors &&
+              !hypre_CSRMatrixFloatData(A_diag) && !hypre_CSRMatrixFloatData(A_offd) &&
+              hypre_GetExecPolicy1(hypre_VectorMemoryLocation(u_local)) == HYPRE_EXEC_HOST;
+
+   if (row_wise)
+   {
+      const HYPRE_Int skip_diag = relax_weight == 1.0 && omega == 1.0 ? 0 : 1;
+
+      switch (relax_type)
+      {
+         case 0: /* Weighted Jacobi */
+            return hypre_BoomerAMGRelaxMultiVecJacobi(A, f, cf_marker, relax_points, relax_weight,
+                                                      NULL, u, Vtemp, 1);
+
+         case 7: /* Jacobi */
+         case 18: /* weighted L1 Jacobi */
+            return hypre_BoomerAMGRelaxMultiVecJacobi(A, f, cf_marker, relax_points, relax_weight,
+                                                      l1_norms, u, Vtemp, 0);
+
+         case 3: /* forward hybrid G-S */
+            return hypre_BoomerAMGRelaxMultiVecHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight,
+                                                                 omega, NULL, u, Vtemp, 1, 0, 1);
+
+         case 4: /* backward hybrid G-S */
+            return hypre_BoomerAMGRelaxMultiVecHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight,
+                                                                 omega, NULL, u, Vtemp, -1, 0, 1);
+
+         case 6: /* symmetric hybrid G-S */
+            return hypre_BoomerAMGRelaxMultiVecHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight,
+                                                                 omega, NULL, u, Vtemp, 1, 1, 1);
+
+         case 8: /* symmetric l1 hybrid G-S */
+            return hypre_BoomerAMGRelaxMultiVecHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight,
+                                                                 omega, l1_norms, u, Vtemp, 1, 1, skip_diag);
+
+         case 13: /* hybrid L1 Gauss-Seidel forward solve */
+            return hypre_BoomerAMGRelaxMultiVecHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight,
+                                                                 omega, l1_norms, u, Vtemp, 1, 0, skip_diag);
+
+         case 14: /* hybrid L1 Gauss-Seidel backward solve */
+            return hypre_BoomerAMGRelaxMultiVecHybridGaussSeidel(A, f, cf_marker, relax_points, relax_weight,
+                                                                 omega, l1_norms, u, Vtemp, -1, 0, skip_diag);
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * One vector at a time
+    *-----------------------------------------------------------------*/
+   {
+      MPI_Comm         comm         = hypre_ParCSRMatrixComm(A);
+      HYPRE_BigInt     global_size  = hypre_ParVectorGlobalSize(f);
+      HYPRE_BigInt    *partitioning = hypre_ParVectorPartitioning(f);
+      HYPRE_Complex   *f_data       = hypre_VectorData(f_local);
+      HYPRE_Complex   *u_data       = hypre_VectorData(u_local);
+      HYPRE_Int        f_vecstride  = hypre_VectorVectorStride(f_local);
+      HYPRE_Int        f_idxstride  = hypre_VectorIndexStride(f_local);
+      HYPRE_Int        u_vecstride  = hypre_VectorVectorStride(u_local);
+      HYPRE_Int        u_idxstride  = hypre_VectorIndexStride(u_local);
+      hypre_ParVector *f_j, *u_j, *V_j, *Z_j = NULL;
+      HYPRE_Complex   *f_j_data, *u_j_data;
+      HYPRE_Int        i, j;
+
+      f_j = hypre_ParVectorCreate(comm, global_size, partitioning);
+      u_j = hypre_ParVectorCreate(comm, global_size, partitioning);
+      V_j = hypre_ParVectorCreate(comm, global_size, partitioning);
+      hypre_ParVectorInitialize_v2(f_j, HYPRE_MEMORY_HOST);
+      hypre_ParVectorInitialize_v2(u_j, HYPRE_MEMORY_HOST);
+      hypre_ParVectorInitialize_v2(V_j, HYPRE_MEMORY_HOST);
+      hypre_ParVectorSetPartitioningOwner(f_j, 0);
+      hypre_ParVectorSetPartitioningOwner(u_j, 0);
+      hypre_ParVectorSetPartitioningOwner(V_j, 0);
+      if (Ztemp)
+      {
+         Z_j = hypre_ParVectorCreate(comm, global_size, partitioning);
+         hypre_ParVectorInitialize_v2(Z_j, HYPRE_MEMORY_HOST);
+         hypre_ParVectorSetPartitioningOwner(Z_j, 0);
+      }
+      f_j_data = hypre_VectorData(hypre_ParVectorLocalVector(f_j));
+      u_j_data = hypre_VectorData(hypre_ParVectorLocalVector(u_j));
+
+      for (j = 0; j < num_vectors; j++)
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            f_j_data[i] = f_data[j * f_vecstride + i * f_idxstride];
+            u_j_data[i] = u_data[j * u_vecstride + i * u_idxstride];
+         }
+
+         relax_error = hypre_BoomerAMGRelax(A, f_j, cf_marker, relax_type, relax_points, relax_weight,
+                                            omega, l1_norms, u_j, V_j, Z_j);
+
+         for (i = 0; i < num_rows; i++)
+         {
+            u_data[j * u_vecstride + i * u_idxstride] = u_j_data[i];
+         }
+      }
+
+      hypre_ParVectorDestroy(f_j);
+      hypre_ParVectorDestroy(u_j);
+      hypre_ParVectorDestroy(V_j);
+      hypre_ParVectorDestroy(Z_j);
+   }
+
+   return relax_error;
+}
@@ -448,6 +448,349 @@ hypre_HybridGaussSeidelThreads( HYPRE_Int     *A_diag_i,
 }
 
 
+/* Permuted Non-Scale version: relaxes rows perm[ibegin], ..., perm[iend - iorder] */
+static inline void
+hypre_HybridGaussSeidelPermNS( HYPRE_Int     *A_diag_i,
+                               HYPRE_Int     *A_diag_j,
+                               HYPRE_Complex *A_diag_data,
+                               HYPRE_Int     *A_offd_i,
+                               HYPRE_Int     *A_offd_j,
+                               HYPRE_Complex *A_offd_data,
+                               HYPRE_Complex *f_data,
+                               HYPRE_Int     *cf_marker,
+                               HYPRE_Int      relax_points,
+                               HYPRE_Complex *l1_norms,
+                               HYPRE_Complex *u_data,
+                               HYPRE_Complex *v_ext_data,
+                               HYPRE_Int      ibegin,
+                               HYPRE_Int      iend,
+                               HYPRE_Int      iorder,
+                               HYPRE_Int     *perm,
+                               HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int k;
+   const HYPRE_Complex zero = 0.0;
+
+   for (k = ibegin; k != iend; k += iorder)
+   {
+      const HYPRE_Int     i    = perm[k];
+      const HYPRE_Complex diag = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && diag != zero )
+      {
+         HYPRE_Int jj;
+         HYPRE_Complex res = f_data[i];
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+         {
+            const HYPRE_Int ii = A_diag_j[jj];
+            res -= A_diag_data[jj] * u_data[ii];
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            const HYPRE_Int ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * v_ext_data[ii];
+         }
+
+         if (Skip_diag)
+         {
+            u_data[i] = res / diag;
+         }
+         else
+         {
+            u_data[i] += res / diag;
+         }
+      }
+   } /* for ( k = ...) */
+}
+
+/* Permuted Scaled version: relaxes rows perm[ibegin], ..., perm[iend - iorder] */
+static inline void
+hypre_HybridGaussSeidelPerm( HYPRE_Int     *A_diag_i,
+                             HYPRE_Int     *A_diag_j,
+                             HYPRE_Complex *A_diag_data,
+                             HYPRE_Int     *A_offd_i,
+                             HYPRE_Int     *A_offd_j,
+                             HYPRE_Complex *A_offd_data,
+                             HYPRE_Complex *f_data,
+                             HYPRE_Int     *cf_marker,
+                             HYPRE_Int      relax_points,
+                             HYPRE_Real     relax_weight,
+                             HYPRE_Real     omega,
+                             HYPRE_Real     one_minus_omega,
+                             HYPRE_Real     prod,
+                             HYPRE_Complex *l1_norms,
+                             HYPRE_Complex *u_data,
+                             HYPRE_Complex *v_tmp_data,
+                             HYPRE_Complex *v_ext_data,
+                             HYPRE_Int      ibegin,
+                             HYPRE_Int      iend,
+                             HYPRE_Int      iorder,
+                             HYPRE_Int     *perm,
+                             HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int k;
+   const HYPRE_Complex zero = 0.0;
+
+   for (k = ibegin; k != iend; k += iorder)
+   {
+      const HYPRE_Int     i    = perm[k];
+      const HYPRE_Complex diag = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && diag != zero )
+      {
+         HYPRE_Int jj;
+         HYPRE_Complex res = f_data[i];
+         HYPRE_Complex res0 = 0.0;
+         HYPRE_Complex res2 = 0.0;
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+         {
+            const HYPRE_Int ii = A_diag_j[jj];
+            res0 -= A_diag_data[jj] * u_data[ii];
+            res2 += A_diag_data[jj] * v_tmp_data[ii];
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            const HYPRE_Int ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * v_ext_data[ii];
+         }
+
+         if (Skip_diag)
+         {
+            u_data[i] *= prod;
+         }
+         u_data[i] += relax_weight * (omega * res + res0 + one_minus_omega * res2) / diag;
+      }
+   } /* for ( k = ...) */
+}
+
+
+/* Single precision storage version (see hypre_CSRMatrixConvertToFloat), scaled
+ * if !non_scale: relaxes rows perm[ibegin], ..., perm[iend - iorder], or
+ * ibegin, ..., iend - iorder if perm is NULL. Only the rows in [ns, ne) are
+ * updated in place (threaded version), the others are read from v_tmp_data.
+ * Products are accumulated in HYPRE_Complex. */
+static inline void
+hypre_HybridGaussSeidelFloat( HYPRE_Int     *A_diag_i,
+                              HYPRE_Int     *A_diag_j,
+                              float         *A_diag_data,
+                              HYPRE_Int     *A_offd_i,
+                              HYPRE_Int     *A_offd_j,
+                              float         *A_offd_data,
+                              HYPRE_Complex *f_data,
+                              HYPRE_Int     *cf_marker,
+                              HYPRE_Int      relax_points,
+                              HYPRE_Int      non_scale,
+                              HYPRE_Real     relax_weight,
+                              HYPRE_Real     omega,
+                              HYPRE_Real     one_minus_omega,
+                              HYPRE_Real     prod,
+                              HYPRE_Complex *l1_norms,
+                              HYPRE_Complex *u_data,
+                              HYPRE_Complex *v_tmp_data,
+                              HYPRE_Complex *v_ext_data,
+                              HYPRE_Int      ns,
+                              HYPRE_Int      ne,
+                              HYPRE_Int      ibegin,
+                              HYPRE_Int      iend,
+                              HYPRE_Int      iorder,
+                              HYPRE_Int     *perm,
+                              HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int k;
+   const HYPRE_Complex zero = 0.0;
+
+   for (k = ibegin; k != iend; k += iorder)
+   {
+      const HYPRE_Int     i    = perm ? perm[k] : k;
+      const HYPRE_Complex diag = l1_norms ? l1_norms[i] : (HYPRE_Complex) A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && diag != zero )
+      {
+         HYPRE_Int jj;
+         HYPRE_Complex res = f_data[i];
+         HYPRE_Complex res0 = 0.0;
+         HYPRE_Complex res2 = 0.0;
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+         {
+            const HYPRE_Int     ii  = A_diag_j[jj];
+            const HYPRE_Complex aij = (HYPRE_Complex) A_diag_data[jj];
+
+            if (ii >= ns && ii < ne)
+            {
+               res0 -= aij * u_data[ii];
+               if (!non_scale)
+               {
+                  res2 += aij * v_tmp_data[ii];
+               }
+            }
+            else
+            {
+               res -= aij * v_tmp_data[ii];
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            const HYPRE_Int ii = A_offd_j[jj];
+            res -= (HYPRE_Complex) A_offd_data[jj] * v_ext_data[ii];
+         }
+
+         if (non_scale)
+         {
+            if (Skip_diag)
+            {
+               u_data[i] = (res + res0) / diag;
+            }
+            else
+            {
+               u_data[i] += (res + res0) / diag;
+            }
+         }
+         else
+         {
+            if (Skip_diag)
+            {
+               u_data[i] *= prod;
+            }
+            u_data[i] += relax_weight * (omega * res + res0 + one_minus_omega * res2) / diag;
+         }
+      }
+   } /* for ( k = ...) */
+}
+
+/* Multivector version, scaled if !non_scale: num_vectors right-hand sides
+ * stored row-wise, i.e., entry i of vector v is data[i*num_vectors + v]. Each
+ * row of A is read once for all vectors. Only the rows in [ns, ne) are updated
+ * in place (threaded version), the others are read from v_tmp_data. res is a
+ * workspace of 3*num_vectors values. */
+static inline void
+hypre_HybridGaussSeidelMultiVec( HYPRE_Int     *A_diag_i,
+                                 HYPRE_Int     *A_diag_j,
+                                 HYPRE_Complex *A_diag_data,
+                                 HYPRE_Int     *A_offd_i,
+                                 HYPRE_Int     *A_offd_j,
+                                 HYPRE_Complex *A_offd_data,
+                                 HYPRE_Complex *f_data,
+                                 HYPRE_Int     *cf_marker,
+                                 HYPRE_Int      relax_points,
+                                 HYPRE_Int      non_scale,
+                                 HYPRE_Real     relax_weight,
+                                 HYPRE_Real     omega,
+                                 HYPRE_Real     one_minus_omega,
+                                 HYPRE_Real     prod,
+                                 HYPRE_Complex *l1_norms,
+                                 HYPRE_Complex *u_data,
+                                 HYPRE_Complex *v_tmp_data,
+                                 HYPRE_Complex *v_ext_data,
+                                 HYPRE_Int      num_vectors,
+                                 HYPRE_Complex *res,
+                                 HYPRE_Int      ns,
+                                 HYPRE_Int      ne,
+                                 HYPRE_Int      ibegin,
+                                 HYPRE_Int      iend,
+                                 HYPRE_Int      iorder,
+                                 HYPRE_Int      Skip_diag )
+{
+   HYPRE_Int i, v;
+   const HYPRE_Complex zero = 0.0;
+   HYPRE_Complex *res0 = res + num_vectors;
+   HYPRE_Complex *res2 = res + 2 * num_vectors;
+
+   for (i = ibegin; i != iend; i += iorder)
+   {
+      const HYPRE_Complex diag = l1_norms ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+
+      if ( (relax_points == 0 || cf_marker[i] == relax_points) && diag != zero )
+      {
+         HYPRE_Int jj;
+         HYPRE_Complex *u_i = u_data + i * num_vectors;
+         HYPRE_Complex *f_i = f_data + i * num_vectors;
+
+         for (v = 0; v < num_vectors; v++)
+         {
+            res[v]  = f_i[v];
+            res0[v] = 0.0;
+            res2[v] = 0.0;
+         }
+
+         for (jj = A_diag_i[i] + Skip_diag; jj < A_diag_i[i+1]; jj++)
+         {
+            const HYPRE_Int      ii   = A_diag_j[jj];
+            const HYPRE_Complex  aij  = A_diag_data[jj];
+            const HYPRE_Complex *u_ii = u_data + ii * num_vectors;
+            const HYPRE_Complex *t_ii = v_tmp_data ? v_tmp_data + ii * num_vectors : NULL;
+
+            if (ii >= ns && ii < ne)
+            {
+               for (v = 0; v < num_vectors; v++)
+               {
+                  res0[v] -= aij * u_ii[v];
+               }
+               if (!non_scale)
+               {
+                  for (v = 0; v < num_vectors; v++)
+                  {
+                     res2[v] += aij * t_ii[v];
+                  }
+               }
+            }
+            else
+            {
+               for (v = 0; v < num_vectors; v++)
+               {
+                  res[v] -= aij * t_ii[v];
+               }
+            }
+         }
+
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            const HYPRE_Complex  aij  = A_offd_data[jj];
+            const HYPRE_Complex *e_ii = v_ext_data + A_offd_j[jj] * num_vectors;
+
+            for (v = 0; v < num_vectors; v++)
+            {
+               res[v] -= aij * e_ii[v];
+            }
+         }
+
+         if (non_scale)
+         {
+            if (Skip_diag)
+            {
+               for (v = 0; v < num_vectors; v++)
+               {
+                  u_i[v] = (res[v] + res0[v]) / diag;
+               }
+            }
+            else
+            {
+               for (v = 0; v < num_vectors; v++)
+               {
+                  u_i[v] += (res[v] + res0[v]) / diag;
+               }
+            }
+         }
+         else
+         {
+            for (v = 0; v < num_vectors; v++)
+            {
+               if (Skip_diag)
+               {
+                  u_i[v] *= prod;
+               }
+               u_i[v] += relax_weight * (omega * res[v] + res0[v] + one_minus_omega * res2[v]) / diag;
+            }
+         }
+      }
+   } /* for ( i = ...) */
+}
+
 /* Ordered Version */
 static inline void
 hypre_HybridGaussSeidelOrderedNS( HYPRE_Int     *A_diag_i,
@@ -59,6 +59,7 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+   HYPRE_Int             num_vectors;     /* persistent handles: vectors packed per message */
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
@@ -83,6 +84,9 @@ typedef struct _hypre_ParCSRCommPkg
 
 #ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
+   /* handles for multivectors, one per job type and number of vectors */
+   HYPRE_Int                          num_persistent_mv_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
+   hypre_ParCSRPersistentCommHandle **persistent_mv_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
 
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
@@ -155,6 +159,7 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandleNumVectors(comm_handle)             (comm_handle -> num_vectors)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 /******************************************************************************
@@ -358,6 +363,12 @@ typedef struct hypre_ParCSRMatrix_struct
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
 
+   /* Local rows without (interior) and with (boundary) offd coupling, the
+      interior rows first. Built on demand, used to work on interior rows
+      while the halo exchange is in flight. */
+   HYPRE_Int             num_interior_rows;
+   HYPRE_Int            *halo_row_order;
+
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
    HYPRE_Complex        *bdiaginv;
@@ -404,6 +415,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixNumInteriorRows(matrix)        ((matrix) -> num_interior_rows)
+#define hypre_ParCSRMatrixHaloRowOrder(matrix)           ((matrix) -> halo_row_order)
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -426,6 +439,14 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic structure of a product C = A*B, reused by numeric-only products
+ * (see par_csr_matmul_plan.c)
+ *--------------------------------------------------------------------------*/
+
+struct hypre_ParMatmulPlan_struct;
+typedef struct hypre_ParMatmulPlan_struct hypre_ParMatmulPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -787,6 +808,7 @@ HYPRE_Int hypre_BooleanGenerateDiagAndOffd ( hypre_CSRBooleanMatrix *A , hypre_P
 /* par_csr_communication.c */
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , void *send_data , void *recv_data );
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_MemoryLocation send_memory_location, void *send_data_in, HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreateMultiVec ( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_vectors, HYPRE_Complex *send_data, HYPRE_Complex *recv_data );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
 void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm , HYPRE_BigInt *col_map_offd , HYPRE_BigInt first_col_diag , HYPRE_BigInt *col_starts , HYPRE_Int num_cols_diag , HYPRE_Int num_cols_offd , HYPRE_Int *p_num_recvs , HYPRE_Int **p_recv_procs , HYPRE_Int **p_recv_vec_starts , HYPRE_Int *p_num_sends , HYPRE_Int **p_send_procs , HYPRE_Int **p_send_map_starts , HYPRE_Int **p_send_map_elmts );
 HYPRE_Int
@@ -830,6 +852,8 @@ HYPRE_Int hypre_ParCSRMatrixDropSmallEntriesDevice( hypre_ParCSRMatrix *A, HYPRE
 #ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentMultiVecCommHandleCreate(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_vectors);
+hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentMultiVecCommHandle(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int num_vectors);
 void hypre_ParCSRPersistentCommHandleDestroy(hypre_ParCSRPersistentCommHandle *comm_handle);
 void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *comm_handle, HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle, HYPRE_MemoryLocation recv_memory_location, void *recv_data);
@@ -850,6 +874,11 @@ HYPRE_Int hypre_ParCSRMatrixAdd( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, HYP
 HYPRE_Int hypre_ParCSRMatrixAddHost( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, HYPRE_Complex beta, hypre_ParCSRMatrix *B, hypre_ParCSRMatrix **Cout);
 HYPRE_Int hypre_ParCSRMatrixAddDevice( HYPRE_Complex alpha, hypre_ParCSRMatrix *A, HYPRE_Complex beta, hypre_ParCSRMatrix *B, hypre_ParCSRMatrix **Cout);
 
+/* par_csr_matmul_plan.c */
+HYPRE_Int hypre_ParMatmulSymbolic ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParMatmulPlan **plan_ptr , hypre_ParCSRMatrix **C_ptr );
+HYPRE_Int hypre_ParMatmulNumeric ( hypre_ParMatmulPlan *plan , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParMatmulPlanDestroy ( hypre_ParMatmulPlan *plan );
+
 /* par_csr_matop_marked.c */
 void hypre_ParMatmul_RowSizes_Marked ( HYPRE_Int **C_diag_i , HYPRE_Int **C_offd_i , HYPRE_Int **B_marker , HYPRE_Int *A_diag_i , HYPRE_Int *A_diag_j , HYPRE_Int *A_offd_i , HYPRE_Int *A_offd_j , HYPRE_Int *B_diag_i , HYPRE_Int *B_diag_j , HYPRE_Int *B_offd_i , HYPRE_Int *B_offd_j , HYPRE_Int *B_ext_diag_i , HYPRE_Int *B_ext_diag_j , HYPRE_Int *B_ext_offd_i , HYPRE_Int *B_ext_offd_j , HYPRE_Int *map_B_to_C , HYPRE_Int *C_diag_size , HYPRE_Int *C_offd_size , HYPRE_Int num_rows_diag_A , HYPRE_Int num_cols_offd_A , HYPRE_Int allsquare , HYPRE_Int num_cols_diag_B , HYPRE_Int num_cols_offd_B , HYPRE_Int num_cols_offd_C , HYPRE_Int *CF_marker , HYPRE_Int *dof_func , HYPRE_Int *dof_func_offd );
 hypre_ParCSRMatrix *hypre_ParMatmul_FC ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , HYPRE_Int *CF_marker , HYPRE_Int *dof_func , HYPRE_Int *dof_func_offd );
@@ -867,6 +896,9 @@ HYPRE_Int hypre_ParCSRMatrixInitialize ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumRownnz ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixSetHaloRowOrder ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixPatternChecksum ( hypre_ParCSRMatrix *matrix , hypre_ulonglongint *checksum_ptr );
+HYPRE_Int hypre_ParCSRMatrixConvertToFloat ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetRowStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_row_starts );
 HYPRE_Int hypre_ParCSRMatrixSetColStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_col_starts );
@@ -894,11 +926,13 @@ HYPRE_Int hypre_ParCSRMatrixSetConstantValues( hypre_ParCSRMatrix *A, HYPRE_Comp
 void hypre_ParCSRMatrixCopyColMapOffdToDevice(hypre_ParCSRMatrix *A);
 
 /* par_csr_matvec.c */
+HYPRE_Int hypre_ParCSRMatrixMatvecBoundaryRowsHost ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , HYPRE_Complex *x_offd_data , HYPRE_Complex *y_data );
 // y = alpha*A*x + beta*b
 HYPRE_Int hypre_ParCSRMatrixMatvecOutOfPlace ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *b, hypre_ParVector *y );
 // y = alpha*A*x + beta*y
 HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y );
+HYPRE_Int hypre_ParCSRMatrixResidualRestrict ( hypre_ParCSRMatrix *A , hypre_ParVector *u , hypre_ParVector *f , hypre_ParCSRMatrix *R , HYPRE_Int transpose_R , hypre_ParVector *r , hypre_ParVector *fc , HYPRE_Complex **work_ptr , HYPRE_Int *work_size_ptr );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y , HYPRE_Int *CF_marker , HYPRE_Int fpt );
 
 /* par_csr_triplemat.c */
@@ -940,7 +974,11 @@ HYPRE_Int hypre_ParVectorScale ( HYPRE_Complex alpha , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha , hypre_ParVector *x , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y, HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Real hypre_ParVectorAxpyInnerProd ( HYPRE_Complex alpha , hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Real hypre_ParVectorAxpy2InnerProd ( HYPRE_Complex alpha , hypre_ParVector *x , hypre_ParVector *y , HYPRE_Complex beta , hypre_ParVector *z , hypre_ParVector *w );
+HYPRE_Int hypre_ParVectorXpay ( HYPRE_Complex beta , hypre_ParVector *x , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x , hypre_ParVector **y , HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod );
+HYPRE_Int hypre_ParVectorMassInnerProdMult ( hypre_ParVector **x , HYPRE_Int nx , hypre_ParVector **y , HYPRE_Int k , HYPRE_Int unroll , HYPRE_Real *result );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector **z, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x , HYPRE_Real *prod_y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm , hypre_Vector *v , HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
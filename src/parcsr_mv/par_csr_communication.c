@@ -213,6 +213,104 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
    hypre_ParCSRCommHandleSendDataBuffer(comm_handle) = send_buff;
    hypre_ParCSRCommHandleNumSendBytes(comm_handle)   = num_bytes_send;
    hypre_ParCSRCommHandleNumRecvBytes(comm_handle)   = num_bytes_recv;
+   hypre_ParCSRCommHandleNumVectors(comm_handle)     = 1;
+
+   return ( comm_handle );
+}
+
+/**
+ * Persistent handle for multivectors (job = 1 or 2) with 'column' storage.
+ * The buffers hold num_vectors consecutive blocks, one per vector, and each
+ * neighbor gets a single message with the entries of all vectors (described
+ * by a strided MPI datatype), instead of one message per vector.
+ */
+hypre_ParCSRPersistentCommHandle*
+hypre_ParCSRPersistentMultiVecCommHandleCreate( HYPRE_Int            job,
+                                                hypre_ParCSRCommPkg *comm_pkg,
+                                                HYPRE_Int            num_vectors )
+{
+   HYPRE_Int i;
+
+   hypre_ParCSRPersistentCommHandle *comm_handle;
+
+   CommPkgJobType job_type = getJobTypeOf(job);
+
+   HYPRE_Int num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   MPI_Comm  comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Int recv_size = hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
+
+   HYPRE_Int num_requests = num_sends + num_recvs;
+   hypre_MPI_Request *requests;
+   hypre_MPI_Datatype mv_type;
+
+   /* sizes and starts seen from this process: (out_*) are sent, (in_*) received */
+   HYPRE_Int  num_out, num_in, out_size, in_size;
+   HYPRE_Int *out_procs, *in_procs, *out_starts, *in_starts;
+   HYPRE_Complex *send_buff, *recv_buff;
+
+   if (num_vectors == 1)
+   {
+      return hypre_ParCSRPersistentCommHandleCreate(job, comm_pkg);
+   }
+
+   if (job_type == HYPRE_COMM_PKG_JOB_COMPLEX)
+   {
+      num_out = num_sends;  out_procs = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      out_size = send_size; out_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+      num_in  = num_recvs;  in_procs  = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      in_size  = recv_size; in_starts  = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   }
+   else if (job_type == HYPRE_COMM_PKG_JOB_COMPLEX_TRANSPOSE)
+   {
+      num_out = num_recvs;  out_procs = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      out_size = recv_size; out_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+      num_in  = num_sends;  in_procs  = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      in_size  = send_size; in_starts  = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   }
+   else
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Multivector persistent communication only supports job 1 and 2\n");
+      return NULL;
+   }
+
+   comm_handle = hypre_CTAlloc(hypre_ParCSRPersistentCommHandle, 1, HYPRE_MEMORY_HOST);
+   requests    = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+   send_buff   = hypre_TAlloc(HYPRE_Complex, out_size * num_vectors, HYPRE_MEMORY_HOST);
+   recv_buff   = hypre_TAlloc(HYPRE_Complex, in_size * num_vectors, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_in; ++i)
+   {
+      HYPRE_Int vec_start = in_starts[i];
+      HYPRE_Int vec_len   = in_starts[i + 1] - vec_start;
+
+      hypre_MPI_Type_vector(num_vectors, vec_len, in_size, HYPRE_MPI_COMPLEX, &mv_type);
+      hypre_MPI_Type_commit(&mv_type);
+      hypre_MPI_Recv_init( recv_buff + vec_start, 1, mv_type,
+                           in_procs[i], 0, comm, requests + i );
+      hypre_MPI_Type_free(&mv_type);
+   }
+   for (i = 0; i < num_out; ++i)
+   {
+      HYPRE_Int vec_start = out_starts[i];
+      HYPRE_Int vec_len   = out_starts[i + 1] - vec_start;
+
+      hypre_MPI_Type_vector(num_vectors, vec_len, out_size, HYPRE_MPI_COMPLEX, &mv_type);
+      hypre_MPI_Type_commit(&mv_type);
+      hypre_MPI_Send_init( send_buff + vec_start, 1, mv_type,
+                           out_procs[i], 0, comm, requests + num_in + i );
+      hypre_MPI_Type_free(&mv_type);
+   }
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)        = comm_pkg;
+   hypre_ParCSRCommHandleNumRequests(comm_handle)    = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)       = requests;
+   hypre_ParCSRCommHandleRecvDataBuffer(comm_handle) = recv_buff;
+   hypre_ParCSRCommHandleSendDataBuffer(comm_handle) = send_buff;
+   hypre_ParCSRCommHandleNumSendBytes(comm_handle)   = sizeof(HYPRE_Complex) * out_size * num_vectors;
+   hypre_ParCSRCommHandleNumRecvBytes(comm_handle)   = sizeof(HYPRE_Complex) * in_size * num_vectors;
+   hypre_ParCSRCommHandleNumVectors(comm_handle)     = num_vectors;
 
    return ( comm_handle );
 }
@@ -231,9 +329,51 @@ hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *
    return comm_pkg->persistent_comm_handles[type];
 }
 
+/**
+ * Returns the handle of comm_pkg for (job, num_vectors), creating it on first use
+ */
+hypre_ParCSRPersistentCommHandle*
+hypre_ParCSRCommPkgGetPersistentMultiVecCommHandle( HYPRE_Int            job,
+                                                    hypre_ParCSRCommPkg *comm_pkg,
+                                                    HYPRE_Int            num_vectors )
+{
+   CommPkgJobType type = getJobTypeOf(job);
+   HYPRE_Int      num_handles = comm_pkg->num_persistent_mv_comm_handles[type];
+   HYPRE_Int      i;
+
+   hypre_ParCSRPersistentCommHandle **handles = comm_pkg->persistent_mv_comm_handles[type];
+
+   if (num_vectors == 1)
+   {
+      return hypre_ParCSRCommPkgGetPersistentCommHandle(job, comm_pkg);
+   }
+
+   for (i = 0; i < num_handles; i++)
+   {
+      if (hypre_ParCSRCommHandleNumVectors(handles[i]) == num_vectors)
+      {
+         return handles[i];
+      }
+   }
+
+   handles = hypre_TReAlloc(handles, hypre_ParCSRPersistentCommHandle *, num_handles + 1, HYPRE_MEMORY_HOST);
+   handles[num_handles] = hypre_ParCSRPersistentMultiVecCommHandleCreate(job, comm_pkg, num_vectors);
+
+   comm_pkg->persistent_mv_comm_handles[type]     = handles;
+   comm_pkg->num_persistent_mv_comm_handles[type] = num_handles + 1;
+
+   return handles[num_handles];
+}
+
 void
 hypre_ParCSRPersistentCommHandleDestroy( hypre_ParCSRPersistentCommHandle *comm_handle )
 {
+   HYPRE_Int i;
+
+   for (i = 0; i < hypre_ParCSRCommHandleNumRequests(comm_handle); i++)
+   {
+      hypre_MPI_Request_free(&hypre_ParCSRCommHandleRequest(comm_handle, i));
+   }
    hypre_TFree(hypre_ParCSRCommHandleSendDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParCSRCommHandleRecvDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(comm_handle->requests, HYPRE_MEMORY_HOST);
@@ -249,12 +389,16 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
-                     send_data,
-                     char,
-                     hypre_ParCSRCommHandleNumSendBytes(comm_handle),
-                     HYPRE_MEMORY_HOST,
-                     send_memory_location );
+      /* no copy when the data has been packed in place */
+      if (send_data != hypre_ParCSRCommHandleSendDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                        send_data,
+                        char,
+                        hypre_ParCSRCommHandleNumSendBytes(comm_handle),
+                        HYPRE_MEMORY_HOST,
+                        send_memory_location );
+      }
 
       HYPRE_Int ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                                          hypre_ParCSRCommHandleRequests(comm_handle));
@@ -284,12 +428,15 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
 
-      hypre_TMemcpy(recv_data,
-                    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
-                    char,
-                    hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
-                    recv_memory_location,
-                    HYPRE_MEMORY_HOST);
+      if (recv_data != hypre_ParCSRCommHandleRecvDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy(recv_data,
+                       hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                       char,
+                       hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
+                       recv_memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
    }
 }
 #endif // HYPRE_USING_PERSISTENT_COMM
@@ -580,6 +727,96 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    return ( comm_handle );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleCreateMultiVec
+ *
+ * Same as job 1 and 2 of hypre_ParCSRCommHandleCreate for num_vectors
+ * vectors stored row-wise (multivec_storage_method = 1), i.e., entry e of
+ * vector j is data[e*num_vectors + j]. The send and recv buffers are laid out
+ * like the ones of a single vector with every entry widened to num_vectors
+ * values, so all vectors travel in one message per neighbor. Host memory only.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle*
+hypre_ParCSRCommHandleCreateMultiVec( HYPRE_Int            job,
+                                      hypre_ParCSRCommPkg *comm_pkg,
+                                      HYPRE_Int            num_vectors,
+                                      HYPRE_Complex       *send_data,
+                                      HYPRE_Complex       *recv_data )
+{
+   HYPRE_Int                  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   MPI_Comm                   comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   hypre_ParCSRCommHandle    *comm_handle;
+   HYPRE_Int                  num_requests;
+   hypre_MPI_Request         *requests;
+   HYPRE_Int                  i, j;
+   HYPRE_Int                  ip, vec_start, vec_len;
+
+   /* sizes and starts seen from this process: (out_*) are sent, (in_*) received */
+   HYPRE_Int                  num_out, num_in;
+   HYPRE_Int                 *out_procs, *in_procs, *out_starts, *in_starts;
+
+   if (job == 1)
+   {
+      num_out = num_sends;  out_procs = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      out_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+      num_in  = num_recvs;  in_procs  = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      in_starts  = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   }
+   else if (job == 2)
+   {
+      num_out = num_recvs;  out_procs = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      out_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+      num_in  = num_sends;  in_procs  = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      in_starts  = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   }
+   else
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Multivector communication only supports job 1 and 2\n");
+      return NULL;
+   }
+
+   num_requests = num_sends + num_recvs;
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (i = 0; i < num_in; i++)
+   {
+      ip = in_procs[i];
+      vec_start = in_starts[i] * num_vectors;
+      vec_len = (in_starts[i + 1] - in_starts[i]) * num_vectors;
+      hypre_MPI_Irecv(&recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_out; i++)
+   {
+      ip = out_procs[i];
+      vec_start = out_starts[i] * num_vectors;
+      vec_len = (out_starts[i + 1] - out_starts[i]) * num_vectors;
+      hypre_MPI_Isend(&send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+
+   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+   hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleNumSendBytes(comm_handle)       = out_starts[num_out] * num_vectors *
+                                                           sizeof(HYPRE_Complex);
+   hypre_ParCSRCommHandleNumRecvBytes(comm_handle)       = in_starts[num_in] * num_vectors *
+                                                           sizeof(HYPRE_Complex);
+   hypre_ParCSRCommHandleSendData(comm_handle)           = send_data;
+   hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data;
+   hypre_ParCSRCommHandleSendDataBuffer(comm_handle)     = send_data;
+   hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
+   hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
+
+   return ( comm_handle );
+}
+
 HYPRE_Int
 hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
 {
@@ -927,6 +1164,10 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
     *----------------------------------------------------------*/
    hypre_ParCSRCommPkg *comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
    hypre_ParCSRMatrixCommPkg(A) = comm_pkg;
+
+   /* offd may have changed: the interior/boundary row split is rebuilt on demand */
+   hypre_TFree(hypre_ParCSRMatrixHaloRowOrder(A), HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixNumInteriorRows(A) = 0;
    hypre_ParCSRCommPkgCreateApart ( comm, col_map_offd, first_col_diag,
                                     num_cols_offd, global_num_cols,
                                     apart,
@@ -943,10 +1184,17 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
    HYPRE_Int i;
    for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
    {
+      HYPRE_Int j;
+
       if (comm_pkg->persistent_comm_handles[i])
       {
          hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
       }
+      for (j = 0; j < comm_pkg->num_persistent_mv_comm_handles[i]; j++)
+      {
+         hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_mv_comm_handles[i][j]);
+      }
+      hypre_TFree(comm_pkg->persistent_mv_comm_handles[i], HYPRE_MEMORY_HOST);
    }
 #endif
 
@@ -44,6 +44,7 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+   HYPRE_Int             num_vectors;     /* persistent handles: vectors packed per message */
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
@@ -68,6 +69,9 @@ typedef struct _hypre_ParCSRCommPkg
 
 #ifdef HYPRE_USING_PERSISTENT_COMM
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
+   /* handles for multivectors, one per job type and number of vectors */
+   HYPRE_Int                          num_persistent_mv_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
+   hypre_ParCSRPersistentCommHandle **persistent_mv_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
 
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
@@ -140,5 +144,6 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandleNumVectors(comm_handle)             (comm_handle -> num_vectors)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
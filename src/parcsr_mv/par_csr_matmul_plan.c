@@ -0,0 +1,825 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Symbolic/numeric split of the host product C = A*B (hypre_ParMatmul).
+ *
+ * hypre_ParMatmulSymbolic does the work of hypre_ParMatmul that only depends
+ * on the sparsity patterns of A and B: the exchange of the column indices of
+ * the external rows of B, their split into diag and offd parts, the merge of
+ * col_map_offd_C and the row pointers and column indices of C. The result is
+ * kept in a hypre_ParMatmulPlan. hypre_ParMatmulNumeric then recomputes the
+ * values of C in place for any A and B with the same patterns; it only
+ * exchanges the values of the external rows of B, and overlaps this exchange
+ * with the product of the local part.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+struct hypre_ParMatmulPlan_struct
+{
+   /* sizes of A, B and C the plan was built for */
+   HYPRE_Int             num_rows_A;
+   HYPRE_Int             num_cols_offd_A;
+   HYPRE_Int             nnz_diag_A;
+   HYPRE_Int             nnz_offd_A;
+   HYPRE_Int             num_cols_diag_B;
+   HYPRE_Int             num_cols_offd_B;
+   HYPRE_Int             nnz_diag_B;
+   HYPRE_Int             nnz_offd_B;
+   HYPRE_Int             num_cols_offd_C;
+   HYPRE_Int             nnz_diag_C;
+   HYPRE_Int             nnz_offd_C;
+#ifdef HYPRE_DEBUG
+   /* checksums of the sparsity patterns of A and B, see
+      hypre_ParCSRMatrixPatternChecksum */
+   hypre_ulonglongint    checksum_A;
+   hypre_ulonglongint    checksum_B;
+#endif
+
+   /* exchange of the values of the external rows of B: row send_rows[i] of
+      B is packed (diag part, then offd part) at send_offsets[i] */
+   hypre_ParCSRCommPkg  *comm_pkg;
+   HYPRE_Int             num_rows_send;
+   HYPRE_Int            *send_rows;
+   HYPRE_Int            *send_offsets;
+
+   /* external rows of B, with columns local to C. The k-th received value
+      goes to B_ext_diag (ext_map[k] >= 0) or to B_ext_offd at -ext_map[k]-1 */
+   HYPRE_Int            *B_ext_diag_i;
+   HYPRE_Int            *B_ext_diag_j;
+   HYPRE_Int            *B_ext_offd_i;
+   HYPRE_Int            *B_ext_offd_j;
+   HYPRE_Int            *ext_map;
+   HYPRE_Int            *map_B_to_C;
+};
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulSymbolic
+ *
+ * Builds the plan of C = A*B and C, with the sparsity pattern (diagonal
+ * entry first when C is square) and zero values. As in hypre_ParMatmul,
+ * C does not own its partitionings and has no communication package.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMatmulSymbolic( hypre_ParCSRMatrix   *A,
+                         hypre_ParCSRMatrix   *B,
+                         hypre_ParMatmulPlan **plan_ptr,
+                         hypre_ParCSRMatrix  **C_ptr )
+{
+   MPI_Comm             comm             = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt         nrows_A          = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_BigInt         ncols_A          = hypre_ParCSRMatrixGlobalNumCols(A);
+   HYPRE_BigInt        *col_map_offd_A   = hypre_ParCSRMatrixColMapOffd(A);
+   hypre_CSRMatrix     *A_diag           = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int           *A_diag_i         = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j         = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int            num_rows_diag_A  = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int            num_cols_diag_A  = hypre_CSRMatrixNumCols(A_diag);
+   hypre_CSRMatrix     *A_offd           = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_offd_i         = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int           *A_offd_j         = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int            num_cols_offd_A  = hypre_CSRMatrixNumCols(A_offd);
+
+   HYPRE_BigInt         nrows_B          = hypre_ParCSRMatrixGlobalNumRows(B);
+   HYPRE_BigInt         ncols_B          = hypre_ParCSRMatrixGlobalNumCols(B);
+   HYPRE_BigInt         first_col_diag_B = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_BigInt        *col_map_offd_B   = hypre_ParCSRMatrixColMapOffd(B);
+   hypre_CSRMatrix     *B_diag           = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int           *B_diag_i         = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int           *B_diag_j         = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Int            num_rows_diag_B  = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int            num_cols_diag_B  = hypre_CSRMatrixNumCols(B_diag);
+   hypre_CSRMatrix     *B_offd           = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int           *B_offd_i         = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int           *B_offd_j         = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Int            num_cols_offd_B  = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt         last_col_diag_B  = first_col_diag_B + (HYPRE_BigInt) num_cols_diag_B - 1;
+
+   hypre_ParMatmulPlan *plan;
+   hypre_ParCSRMatrix  *C;
+   hypre_CSRMatrix     *C_diag, *C_offd;
+   HYPRE_Int           *C_diag_i, *C_diag_j, *C_offd_i, *C_offd_j = NULL;
+   HYPRE_Int            C_diag_size, C_offd_size;
+   HYPRE_BigInt        *col_map_offd_C = NULL;
+   HYPRE_Int            num_cols_offd_C = 0;
+
+   hypre_CSRMatrix     *Bs_ext = NULL;
+   HYPRE_Int           *Bs_ext_i = NULL;
+   HYPRE_BigInt        *Bs_ext_j = NULL;
+   HYPRE_Int           *B_ext_diag_i, *B_ext_diag_j = NULL;
+   HYPRE_Int           *B_ext_offd_i, *B_ext_offd_j = NULL;
+   HYPRE_Int           *ext_map = NULL, *map_B_to_C = NULL;
+   HYPRE_BigInt        *temp = NULL;
+   HYPRE_Int            B_ext_diag_size, B_ext_offd_size, num_nnz_recv;
+   HYPRE_Int            allsquare = 0;
+   HYPRE_Int            num_procs, i, j, cnt;
+
+   *plan_ptr = NULL;
+   *C_ptr    = NULL;
+
+   if (ncols_A != nrows_B || num_cols_diag_A != num_rows_diag_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC," Error! Incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   if ( hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST ||
+        hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(B)) != hypre_MEMORY_HOST )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "hypre_ParMatmulSymbolic is only available on the host\n");
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_MATMUL] -= hypre_MPI_Wtime();
+#endif
+
+   if ( num_rows_diag_A == num_cols_diag_B && nrows_A == ncols_B )
+   {
+      allsquare = 1;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   plan = hypre_CTAlloc(hypre_ParMatmulPlan, 1, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Column indices of the external rows of B, and the communication
+    * package for their values
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      hypre_ParCSRCommPkg *comm_pkg_A, *comm_pkg;
+      HYPRE_Int            num_sends, num_recvs, num_rows_send;
+      HYPRE_Int           *send_rows, *send_offsets, *send_jstarts, *recv_jstarts;
+      void                *request;
+
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      comm_pkg_A = hypre_ParCSRMatrixCommPkg(A);
+
+      hypre_ParcsrGetExternalRowsInit(B, num_cols_offd_A, col_map_offd_A, comm_pkg_A, 0, &request);
+      Bs_ext   = hypre_ParcsrGetExternalRowsWait(request);
+      Bs_ext_i = hypre_CSRMatrixI(Bs_ext);
+      Bs_ext_j = hypre_CSRMatrixBigJ(Bs_ext);
+
+      num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+      num_recvs     = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+      num_rows_send = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends);
+
+      /* rows of B to send, in the order of hypre_ParcsrGetExternalRowsInit */
+      send_rows    = hypre_TAlloc(HYPRE_Int, num_rows_send, HYPRE_MEMORY_HOST);
+      send_offsets = hypre_TAlloc(HYPRE_Int, num_rows_send + 1, HYPRE_MEMORY_HOST);
+      send_offsets[0] = 0;
+      for (i = 0; i < num_rows_send; i++)
+      {
+         j = hypre_ParCSRCommPkgSendMapElmt(comm_pkg_A, i);
+         send_rows[i] = j;
+         send_offsets[i+1] = send_offsets[i] + B_diag_i[j+1] - B_diag_i[j] +
+                             B_offd_i[j+1] - B_offd_i[j];
+      }
+
+      send_jstarts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i <= num_sends; i++)
+      {
+         send_jstarts[i] = send_offsets[hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, i)];
+      }
+      recv_jstarts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i <= num_recvs; i++)
+      {
+         recv_jstarts[i] = Bs_ext_i[hypre_ParCSRCommPkgRecvVecStart(comm_pkg_A, i)];
+      }
+
+      /* the plan may outlive the communication package of A */
+      comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgComm         (comm_pkg) = comm;
+      hypre_ParCSRCommPkgNumSends     (comm_pkg) = num_sends;
+      hypre_ParCSRCommPkgSendProcs    (comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_jstarts;
+      hypre_ParCSRCommPkgNumRecvs     (comm_pkg) = num_recvs;
+      hypre_ParCSRCommPkgRecvProcs    (comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = recv_jstarts;
+      hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(comm_pkg), hypre_ParCSRCommPkgSendProcs(comm_pkg_A),
+                    HYPRE_Int, num_sends, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(comm_pkg), hypre_ParCSRCommPkgRecvProcs(comm_pkg_A),
+                    HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+      plan->comm_pkg      = comm_pkg;
+      plan->num_rows_send = num_rows_send;
+      plan->send_rows     = send_rows;
+      plan->send_offsets  = send_offsets;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Split the external rows of B into diag and offd parts, and merge
+    * col_map_offd_C
+    *-----------------------------------------------------------------------*/
+
+   num_nnz_recv = Bs_ext ? Bs_ext_i[num_cols_offd_A] : 0;
+
+   B_ext_diag_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
+   B_ext_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_cols_offd_A; i++)
+   {
+      B_ext_diag_i[i+1] = B_ext_diag_i[i];
+      B_ext_offd_i[i+1] = B_ext_offd_i[i];
+      for (j = Bs_ext_i[i]; j < Bs_ext_i[i+1]; j++)
+      {
+         if (Bs_ext_j[j] < first_col_diag_B || Bs_ext_j[j] > last_col_diag_B)
+         {
+            B_ext_offd_i[i+1]++;
+         }
+         else
+         {
+            B_ext_diag_i[i+1]++;
+         }
+      }
+   }
+   B_ext_diag_size = B_ext_diag_i[num_cols_offd_A];
+   B_ext_offd_size = B_ext_offd_i[num_cols_offd_A];
+
+   if (num_nnz_recv)
+   {
+      ext_map = hypre_TAlloc(HYPRE_Int, num_nnz_recv, HYPRE_MEMORY_HOST);
+   }
+   B_ext_diag_j = hypre_TAlloc(HYPRE_Int, B_ext_diag_size, HYPRE_MEMORY_HOST);
+   B_ext_offd_j = hypre_TAlloc(HYPRE_Int, B_ext_offd_size, HYPRE_MEMORY_HOST);
+   if (B_ext_offd_size || num_cols_offd_B)
+   {
+      temp = hypre_TAlloc(HYPRE_BigInt, B_ext_offd_size + num_cols_offd_B, HYPRE_MEMORY_HOST);
+   }
+
+   B_ext_diag_size = 0;
+   B_ext_offd_size = 0;
+   for (j = 0; j < num_nnz_recv; j++)
+   {
+      if (Bs_ext_j[j] < first_col_diag_B || Bs_ext_j[j] > last_col_diag_B)
+      {
+         temp[B_ext_offd_size] = Bs_ext_j[j];
+         ext_map[j] = -B_ext_offd_size - 1;
+         B_ext_offd_size++;
+      }
+      else
+      {
+         B_ext_diag_j[B_ext_diag_size] = (HYPRE_Int)(Bs_ext_j[j] - first_col_diag_B);
+         ext_map[j] = B_ext_diag_size;
+         B_ext_diag_size++;
+      }
+   }
+
+   cnt = B_ext_offd_size;
+   for (i = 0; i < num_cols_offd_B; i++)
+   {
+      temp[cnt++] = col_map_offd_B[i];
+   }
+   if (cnt)
+   {
+      HYPRE_BigInt value;
+
+      hypre_BigQsort0(temp, 0, cnt-1);
+      num_cols_offd_C = 1;
+      value = temp[0];
+      for (i = 1; i < cnt; i++)
+      {
+         if (temp[i] > value)
+         {
+            value = temp[i];
+            temp[num_cols_offd_C++] = value;
+         }
+      }
+      col_map_offd_C = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_C, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(col_map_offd_C, temp, HYPRE_BigInt, num_cols_offd_C,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   /* offd columns of B_ext, now local to C (temp is sorted; use Bs_ext_j) */
+   for (j = 0; j < num_nnz_recv; j++)
+   {
+      if (ext_map[j] < 0)
+      {
+         B_ext_offd_j[-ext_map[j]-1] = hypre_BigBinarySearch(col_map_offd_C, Bs_ext_j[j],
+                                                             num_cols_offd_C);
+      }
+   }
+   hypre_TFree(temp, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(Bs_ext);
+
+   if (num_cols_offd_B)
+   {
+      map_B_to_C = hypre_CTAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+      cnt = 0;
+      for (i = 0; i < num_cols_offd_C; i++)
+      {
+         if (col_map_offd_C[i] == col_map_offd_B[cnt])
+         {
+            map_B_to_C[cnt++] = i;
+            if (cnt == num_cols_offd_B) break;
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Sparsity pattern of C, in the order of hypre_ParMatmul
+    *-----------------------------------------------------------------------*/
+
+   hypre_ParMatmul_RowSizes(HYPRE_MEMORY_HOST, &C_diag_i, &C_offd_i,
+                            NULL, A_diag_i, A_diag_j,
+                            A_offd_i, A_offd_j,
+                            B_diag_i, B_diag_j,
+                            B_offd_i, B_offd_j,
+                            B_ext_diag_i, B_ext_diag_j,
+                            B_ext_offd_i, B_ext_offd_j, map_B_to_C,
+                            &C_diag_size, &C_offd_size,
+                            num_rows_diag_A, num_rows_diag_A, num_cols_offd_A,
+                            allsquare, num_cols_diag_B, num_cols_offd_B,
+                            num_cols_offd_C);
+
+   C_diag_j = hypre_TAlloc(HYPRE_Int, C_diag_size, HYPRE_MEMORY_HOST);
+   if (C_offd_size)
+   {
+      C_offd_j = hypre_TAlloc(HYPRE_Int, C_offd_size, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int *B_marker = NULL;
+      HYPRE_Int  i2, i3, jj2, jj3, ns, ne;
+      HYPRE_Int  jj_row_begin_diag, jj_count_diag;
+      HYPRE_Int  jj_row_begin_offd, jj_count_offd;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows_diag_A);
+
+      if (num_cols_diag_B || num_cols_offd_C)
+      {
+         B_marker = hypre_TAlloc(HYPRE_Int, num_cols_diag_B + num_cols_offd_C, HYPRE_MEMORY_HOST);
+         for (i = 0; i < num_cols_diag_B + num_cols_offd_C; i++)
+         {
+            B_marker[i] = -1;
+         }
+      }
+
+      for (i = ns; i < ne; i++)
+      {
+         jj_row_begin_diag = jj_count_diag = C_diag_i[i];
+         jj_row_begin_offd = jj_count_offd = C_offd_i[i];
+
+         if (allsquare)
+         {
+            B_marker[i] = jj_count_diag;
+            C_diag_j[jj_count_diag++] = i;
+         }
+
+         if (num_cols_offd_A)
+         {
+            for (jj2 = A_offd_i[i]; jj2 < A_offd_i[i+1]; jj2++)
+            {
+               i2 = A_offd_j[jj2];
+               for (jj3 = B_ext_offd_i[i2]; jj3 < B_ext_offd_i[i2+1]; jj3++)
+               {
+                  i3 = num_cols_diag_B + B_ext_offd_j[jj3];
+                  if (B_marker[i3] < jj_row_begin_offd)
+                  {
+                     B_marker[i3] = jj_count_offd;
+                     C_offd_j[jj_count_offd++] = i3 - num_cols_diag_B;
+                  }
+               }
+               for (jj3 = B_ext_diag_i[i2]; jj3 < B_ext_diag_i[i2+1]; jj3++)
+               {
+                  i3 = B_ext_diag_j[jj3];
+                  if (B_marker[i3] < jj_row_begin_diag)
+                  {
+                     B_marker[i3] = jj_count_diag;
+                     C_diag_j[jj_count_diag++] = i3;
+                  }
+               }
+            }
+         }
+
+         for (jj2 = A_diag_i[i]; jj2 < A_diag_i[i+1]; jj2++)
+         {
+            i2 = A_diag_j[jj2];
+            for (jj3 = B_diag_i[i2]; jj3 < B_diag_i[i2+1]; jj3++)
+            {
+               i3 = B_diag_j[jj3];
+               if (B_marker[i3] < jj_row_begin_diag)
+               {
+                  B_marker[i3] = jj_count_diag;
+                  C_diag_j[jj_count_diag++] = i3;
+               }
+            }
+            if (num_cols_offd_B)
+            {
+               for (jj3 = B_offd_i[i2]; jj3 < B_offd_i[i2+1]; jj3++)
+               {
+                  i3 = num_cols_diag_B + map_B_to_C[B_offd_j[jj3]];
+                  if (B_marker[i3] < jj_row_begin_offd)
+                  {
+                     B_marker[i3] = jj_count_offd;
+                     C_offd_j[jj_count_offd++] = i3 - num_cols_diag_B;
+                  }
+               }
+            }
+         }
+      }
+
+      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   C = hypre_ParCSRMatrixCreate(comm, nrows_A, ncols_B,
+                                hypre_ParCSRMatrixRowStarts(A),
+                                hypre_ParCSRMatrixColStarts(B),
+                                num_cols_offd_C, C_diag_size, C_offd_size);
+   hypre_ParCSRMatrixSetRowStartsOwner(C, 0);
+   hypre_ParCSRMatrixSetColStartsOwner(C, 0);
+
+   C_diag = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrixI(C_diag)    = C_diag_i;
+   hypre_CSRMatrixJ(C_diag)    = C_diag_j;
+   hypre_CSRMatrixData(C_diag) = hypre_CTAlloc(HYPRE_Complex, C_diag_size, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixMemoryLocation(C_diag) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixSetRownnz(C_diag);
+
+   C_offd = hypre_ParCSRMatrixOffd(C);
+   hypre_CSRMatrixI(C_offd) = C_offd_i;
+   if (num_cols_offd_C)
+   {
+      hypre_CSRMatrixJ(C_offd)        = C_offd_j;
+      hypre_CSRMatrixData(C_offd)     = hypre_CTAlloc(HYPRE_Complex, C_offd_size, HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixColMapOffd(C) = col_map_offd_C;
+   }
+   hypre_CSRMatrixMemoryLocation(C_offd) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixSetRownnz(C_offd);
+
+   plan->num_rows_A      = num_rows_diag_A;
+   plan->num_cols_offd_A = num_cols_offd_A;
+   plan->nnz_diag_A      = A_diag_i[num_rows_diag_A];
+   plan->nnz_offd_A      = A_offd_i[num_rows_diag_A];
+   plan->num_cols_diag_B = num_cols_diag_B;
+   plan->num_cols_offd_B = num_cols_offd_B;
+   plan->nnz_diag_B      = B_diag_i[num_rows_diag_B];
+   plan->nnz_offd_B      = B_offd_i[num_rows_diag_B];
+   plan->num_cols_offd_C = num_cols_offd_C;
+   plan->nnz_diag_C      = C_diag_size;
+   plan->nnz_offd_C      = C_offd_size;
+#ifdef HYPRE_DEBUG
+   hypre_ParCSRMatrixPatternChecksum(A, &plan->checksum_A);
+   hypre_ParCSRMatrixPatternChecksum(B, &plan->checksum_B);
+#endif
+   plan->B_ext_diag_i    = B_ext_diag_i;
+   plan->B_ext_diag_j    = B_ext_diag_j;
+   plan->B_ext_offd_i    = B_ext_offd_i;
+   plan->B_ext_offd_j    = B_ext_offd_j;
+   plan->ext_map         = ext_map;
+   plan->map_B_to_C      = map_B_to_C;
+
+   *plan_ptr = plan;
+   *C_ptr    = C;
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_MATMUL] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulNumeric
+ *
+ * Computes the values of C = A*B in place, where C was returned by
+ * hypre_ParMatmulSymbolic with this plan and A, B have the sparsity
+ * patterns the plan was built for. Only the sizes are checked here; the
+ * patterns themselves are compared in debug builds only, since hashing them
+ * costs a pass over A and B. Callers that may get new patterns must check
+ * them once beforehand (see hypre_BoomerAMGReuseHierarchyCheck).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMatmulNumeric( hypre_ParMatmulPlan *plan,
+                        hypre_ParCSRMatrix  *A,
+                        hypre_ParCSRMatrix  *B,
+                        hypre_ParCSRMatrix  *C )
+{
+   hypre_CSRMatrix        *A_diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Complex          *A_diag_data     = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int              *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix        *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Complex          *A_offd_data     = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int              *A_offd_i        = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j        = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int               num_rows        = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix        *B_diag          = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Complex          *B_diag_data     = hypre_CSRMatrixData(B_diag);
+   HYPRE_Int              *B_diag_i        = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int              *B_diag_j        = hypre_CSRMatrixJ(B_diag);
+   hypre_CSRMatrix        *B_offd          = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Complex          *B_offd_data     = hypre_CSRMatrixData(B_offd);
+   HYPRE_Int              *B_offd_i        = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int              *B_offd_j        = hypre_CSRMatrixJ(B_offd);
+
+   hypre_CSRMatrix        *C_diag          = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Complex          *C_diag_data     = hypre_CSRMatrixData(C_diag);
+   HYPRE_Int              *C_diag_i        = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int              *C_diag_j        = hypre_CSRMatrixJ(C_diag);
+   hypre_CSRMatrix        *C_offd          = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Complex          *C_offd_data     = hypre_CSRMatrixData(C_offd);
+   HYPRE_Int              *C_offd_i        = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int              *C_offd_j        = hypre_CSRMatrixJ(C_offd);
+
+   HYPRE_Int               num_cols_diag_B, num_cols_offd_B, num_cols_offd_A, num_cols_offd_C;
+   HYPRE_Int              *B_ext_diag_i, *B_ext_diag_j, *B_ext_offd_i, *B_ext_offd_j;
+   HYPRE_Int              *map_B_to_C;
+   HYPRE_Complex          *B_ext_diag_data = NULL, *B_ext_offd_data = NULL;
+   HYPRE_Complex          *send_a = NULL, *recv_a = NULL;
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int               num_nnz_recv = 0;
+#ifdef HYPRE_DEBUG
+   hypre_ulonglongint      checksum_A = 0, checksum_B = 0;
+#endif
+   HYPRE_Int               i, k;
+
+   if ( !plan ||
+        num_rows != plan->num_rows_A ||
+        hypre_CSRMatrixNumCols(A_offd) != plan->num_cols_offd_A ||
+        A_diag_i[num_rows] != plan->nnz_diag_A ||
+        A_offd_i[num_rows] != plan->nnz_offd_A ||
+        hypre_CSRMatrixNumCols(B_diag) != plan->num_cols_diag_B ||
+        hypre_CSRMatrixNumCols(B_offd) != plan->num_cols_offd_B ||
+        B_diag_i[hypre_CSRMatrixNumRows(B_diag)] != plan->nnz_diag_B ||
+        B_offd_i[hypre_CSRMatrixNumRows(B_diag)] != plan->nnz_offd_B ||
+        hypre_CSRMatrixNumRows(C_diag) != num_rows ||
+        C_diag_i[num_rows] != plan->nnz_diag_C ||
+        C_offd_i[num_rows] != plan->nnz_offd_C )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "The matrices do not match the hypre_ParMatmulPlan\n");
+      return hypre_error_flag;
+   }
+
+#ifdef HYPRE_DEBUG
+   /* same sizes, but the patterns may still differ */
+   hypre_ParCSRMatrixPatternChecksum(A, &checksum_A);
+   hypre_ParCSRMatrixPatternChecksum(B, &checksum_B);
+   if (checksum_A != plan->checksum_A || checksum_B != plan->checksum_B)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "The sparsity patterns do not match the hypre_ParMatmulPlan\n");
+      return hypre_error_flag;
+   }
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_MATMUL] -= hypre_MPI_Wtime();
+#endif
+
+   num_cols_offd_A = plan->num_cols_offd_A;
+   num_cols_diag_B = plan->num_cols_diag_B;
+   num_cols_offd_B = plan->num_cols_offd_B;
+   num_cols_offd_C = plan->num_cols_offd_C;
+   B_ext_diag_i    = plan->B_ext_diag_i;
+   B_ext_diag_j    = plan->B_ext_diag_j;
+   B_ext_offd_i    = plan->B_ext_offd_i;
+   B_ext_offd_j    = plan->B_ext_offd_j;
+   map_B_to_C      = plan->map_B_to_C;
+
+   /*-----------------------------------------------------------------------
+    * Start the exchange of the values of the external rows of B
+    *-----------------------------------------------------------------------*/
+
+   if (plan->comm_pkg)
+   {
+      HYPRE_Int  num_rows_send = plan->num_rows_send;
+      HYPRE_Int *send_rows     = plan->send_rows;
+      HYPRE_Int *send_offsets  = plan->send_offsets;
+
+      num_nnz_recv = B_ext_diag_i[num_cols_offd_A] + B_ext_offd_i[num_cols_offd_A];
+      send_a = hypre_TAlloc(HYPRE_Complex, send_offsets[num_rows_send], HYPRE_MEMORY_HOST);
+      recv_a = hypre_TAlloc(HYPRE_Complex, num_nnz_recv, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,k) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows_send; i++)
+      {
+         HYPRE_Int i1 = send_offsets[i];
+         HYPRE_Int j  = send_rows[i];
+
+         for (k = B_diag_i[j]; k < B_diag_i[j+1]; k++)
+         {
+            send_a[i1++] = B_diag_data[k];
+         }
+         for (k = B_offd_i[j]; k < B_offd_i[j+1]; k++)
+         {
+            send_a[i1++] = B_offd_data[k];
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, plan->comm_pkg, send_a, recv_a);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Local part: C = A_diag*[B_diag B_offd]. The pattern of each row of C
+    * contains all the columns it receives, so B_marker needs no reset
+    * between rows.
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,k)
+#endif
+   {
+      HYPRE_Int     *B_marker = NULL;
+      HYPRE_Int      i2, jj2, jj3, ns, ne;
+      HYPRE_Complex  a_entry;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+
+      if (num_cols_diag_B || num_cols_offd_C)
+      {
+         B_marker = hypre_TAlloc(HYPRE_Int, num_cols_diag_B + num_cols_offd_C, HYPRE_MEMORY_HOST);
+         for (k = 0; k < num_cols_diag_B + num_cols_offd_C; k++)
+         {
+            B_marker[k] = -1;
+         }
+      }
+
+      for (i = ns; i < ne; i++)
+      {
+         for (k = C_diag_i[i]; k < C_diag_i[i+1]; k++)
+         {
+            B_marker[C_diag_j[k]] = k;
+            C_diag_data[k] = 0.0;
+         }
+         for (k = C_offd_i[i]; k < C_offd_i[i+1]; k++)
+         {
+            B_marker[num_cols_diag_B + C_offd_j[k]] = k;
+            C_offd_data[k] = 0.0;
+         }
+
+         for (jj2 = A_diag_i[i]; jj2 < A_diag_i[i+1]; jj2++)
+         {
+            i2 = A_diag_j[jj2];
+            a_entry = A_diag_data[jj2];
+            for (jj3 = B_diag_i[i2]; jj3 < B_diag_i[i2+1]; jj3++)
+            {
+               C_diag_data[B_marker[B_diag_j[jj3]]] += a_entry*B_diag_data[jj3];
+            }
+            if (num_cols_offd_B)
+            {
+               for (jj3 = B_offd_i[i2]; jj3 < B_offd_i[i2+1]; jj3++)
+               {
+                  C_offd_data[B_marker[num_cols_diag_B + map_B_to_C[B_offd_j[jj3]]]] +=
+                     a_entry*B_offd_data[jj3];
+               }
+            }
+         }
+      }
+
+      hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+   } /* end parallel region */
+
+   /*-----------------------------------------------------------------------
+    * External part: C += A_offd*B_ext
+    *-----------------------------------------------------------------------*/
+
+   if (comm_handle)
+   {
+      HYPRE_Int *ext_map = plan->ext_map;
+
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+      hypre_TFree(send_a, HYPRE_MEMORY_HOST);
+
+      B_ext_diag_data = hypre_TAlloc(HYPRE_Complex, B_ext_diag_i[num_cols_offd_A], HYPRE_MEMORY_HOST);
+      B_ext_offd_data = hypre_TAlloc(HYPRE_Complex, B_ext_offd_i[num_cols_offd_A], HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k) HYPRE_SMP_SCHEDULE
+#endif
+      for (k = 0; k < num_nnz_recv; k++)
+      {
+         if (ext_map[k] >= 0)
+         {
+            B_ext_diag_data[ext_map[k]] = recv_a[k];
+         }
+         else
+         {
+            B_ext_offd_data[-ext_map[k]-1] = recv_a[k];
+         }
+      }
+      hypre_TFree(recv_a, HYPRE_MEMORY_HOST);
+   }
+
+   if (num_cols_offd_A)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,k)
+#endif
+      {
+         HYPRE_Int     *B_marker = NULL;
+         HYPRE_Int      i2, jj2, jj3, ns, ne;
+         HYPRE_Complex  a_entry;
+
+         hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+
+         if (num_cols_diag_B || num_cols_offd_C)
+         {
+            B_marker = hypre_TAlloc(HYPRE_Int, num_cols_diag_B + num_cols_offd_C, HYPRE_MEMORY_HOST);
+            for (k = 0; k < num_cols_diag_B + num_cols_offd_C; k++)
+            {
+               B_marker[k] = -1;
+            }
+         }
+
+         for (i = ns; i < ne; i++)
+         {
+            if (A_offd_i[i] == A_offd_i[i+1])
+            {
+               continue;
+            }
+
+            for (k = C_diag_i[i]; k < C_diag_i[i+1]; k++)
+            {
+               B_marker[C_diag_j[k]] = k;
+            }
+            for (k = C_offd_i[i]; k < C_offd_i[i+1]; k++)
+            {
+               B_marker[num_cols_diag_B + C_offd_j[k]] = k;
+            }
+
+            for (jj2 = A_offd_i[i]; jj2 < A_offd_i[i+1]; jj2++)
+            {
+               i2 = A_offd_j[jj2];
+               a_entry = A_offd_data[jj2];
+               for (jj3 = B_ext_offd_i[i2]; jj3 < B_ext_offd_i[i2+1]; jj3++)
+               {
+                  C_offd_data[B_marker[num_cols_diag_B + B_ext_offd_j[jj3]]] +=
+                     a_entry*B_ext_offd_data[jj3];
+               }
+               for (jj3 = B_ext_diag_i[i2]; jj3 < B_ext_diag_i[i2+1]; jj3++)
+               {
+                  C_diag_data[B_marker[B_ext_diag_j[jj3]]] += a_entry*B_ext_diag_data[jj3];
+               }
+            }
+         }
+
+         hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+      } /* end parallel region */
+   }
+
+   hypre_TFree(B_ext_diag_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(B_ext_offd_data, HYPRE_MEMORY_HOST);
+
+   /* the values of C have changed */
+   hypre_CSRMatrixSellDestroy(C_diag);
+   hypre_CSRMatrixSellDestroy(C_offd);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_MATMUL] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParMatmulPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParMatmulPlanDestroy( hypre_ParMatmulPlan *plan )
+{
+   if (plan)
+   {
+      hypre_ParCSRCommPkg *comm_pkg = plan->comm_pkg;
+
+      if (comm_pkg)
+      {
+         hypre_TFree(hypre_ParCSRCommPkgSendProcs(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParCSRCommPkgSendMapStarts(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParCSRCommPkgRecvProcs(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParCSRCommPkgRecvVecStarts(comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(plan->send_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->send_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->B_ext_diag_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->B_ext_diag_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->B_ext_offd_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->B_ext_offd_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->ext_map, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->map_B_to_C, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
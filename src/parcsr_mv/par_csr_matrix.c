@@ -97,6 +97,8 @@ hypre_ParCSRMatrixCreate( MPI_Comm comm,
    hypre_ParCSRMatrixColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixDeviceColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixProcOrdering(matrix) = NULL;
+   hypre_ParCSRMatrixNumInteriorRows(matrix) = 0;
+   hypre_ParCSRMatrixHaloRowOrder(matrix) = NULL;
 
    hypre_ParCSRMatrixAssumedPartition(matrix) = NULL;
    hypre_ParCSRMatrixOwnsAssumedPartition(matrix) = 1;
@@ -207,6 +209,8 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
          hypre_TFree(hypre_ParCSRMatrixProcOrdering(matrix), HYPRE_MEMORY_HOST);
       }
 
+      hypre_TFree(hypre_ParCSRMatrixHaloRowOrder(matrix), HYPRE_MEMORY_HOST);
+
       hypre_TFree(matrix->bdiaginv, HYPRE_MEMORY_HOST);
       if (matrix->bdiaginv_comm_pkg)
       {
@@ -448,6 +452,168 @@ hypre_ParCSRMatrixSetNumRownnz( hypre_ParCSRMatrix *matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetHaloRowOrder
+ *
+ * Splits the local rows into interior rows (no entries in offd), which only
+ * need local data, and boundary rows, which need the halo. The order keeps
+ * the interior rows first, each group in increasing row order. Nothing is
+ * done if the order has already been set.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetHaloRowOrder( hypre_ParCSRMatrix *matrix )
+{
+   hypre_CSRMatrix  *offd;
+   HYPRE_Int        *offd_i;
+   HYPRE_Int        *halo_row_order;
+   HYPRE_Int         num_rows, num_interior, num_boundary, i;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParCSRMatrixHaloRowOrder(matrix))
+   {
+      return hypre_error_flag;
+   }
+
+   offd     = hypre_ParCSRMatrixOffd(matrix);
+   offd_i   = hypre_CSRMatrixI(offd);
+   num_rows = hypre_CSRMatrixNumRows(offd);
+
+   halo_row_order = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+   num_interior = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      num_interior += offd_i[i + 1] == offd_i[i];
+   }
+
+   num_boundary = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (offd_i[i + 1] == offd_i[i])
+      {
+         halo_row_order[i - num_boundary] = i;
+      }
+      else
+      {
+         halo_row_order[num_interior + num_boundary] = i;
+         num_boundary++;
+      }
+   }
+
+   hypre_ParCSRMatrixNumInteriorRows(matrix) = num_interior;
+   hypre_ParCSRMatrixHaloRowOrder(matrix)    = halo_row_order;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPatternChecksum
+ *
+ * Returns a checksum (FNV-1a) of the local sparsity pattern of the matrix:
+ * the row pointers and column indices of diag and offd and the global
+ * columns of offd. A pattern-only host copy is made for device matrices.
+ * No communication is done.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPatternChecksum( hypre_ParCSRMatrix *matrix,
+                                   hypre_ulonglongint *checksum_ptr )
+{
+   const hypre_ulonglongint  prime = 1099511628211ULL;
+   hypre_ulonglongint        h = 14695981039346656037ULL;
+   hypre_ParCSRMatrix       *matrix_host = NULL;
+   hypre_CSRMatrix          *diag, *offd;
+   HYPRE_BigInt             *col_map_offd;
+   HYPRE_Int                 num_rows, num_cols_offd, i;
+
+   if (!matrix || !checksum_ptr)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(matrix)) !=
+        hypre_MEMORY_HOST )
+   {
+      matrix_host = hypre_ParCSRMatrixClone_v2(matrix, 0, HYPRE_MEMORY_HOST);
+      matrix = matrix_host;
+   }
+
+   diag          = hypre_ParCSRMatrixDiag(matrix);
+   offd          = hypre_ParCSRMatrixOffd(matrix);
+   col_map_offd  = hypre_ParCSRMatrixColMapOffd(matrix);
+   num_rows      = hypre_CSRMatrixNumRows(diag);
+   num_cols_offd = hypre_CSRMatrixNumCols(offd);
+
+#define HYPRE_PATTERN_HASH(v) { h ^= (hypre_ulonglongint) (v); h *= prime; }
+   HYPRE_PATTERN_HASH(num_rows);
+   HYPRE_PATTERN_HASH(hypre_CSRMatrixNumCols(diag));
+   HYPRE_PATTERN_HASH(num_cols_offd);
+   for (i = 0; i <= num_rows; i++)
+   {
+      HYPRE_PATTERN_HASH(hypre_CSRMatrixI(diag)[i]);
+      HYPRE_PATTERN_HASH(hypre_CSRMatrixI(offd)[i]);
+   }
+   for (i = 0; i < hypre_CSRMatrixI(diag)[num_rows]; i++)
+   {
+      HYPRE_PATTERN_HASH(hypre_CSRMatrixJ(diag)[i]);
+   }
+   for (i = 0; i < hypre_CSRMatrixI(offd)[num_rows]; i++)
+   {
+      HYPRE_PATTERN_HASH(hypre_CSRMatrixJ(offd)[i]);
+   }
+   for (i = 0; col_map_offd && i < num_cols_offd; i++)
+   {
+      HYPRE_PATTERN_HASH(col_map_offd[i]);
+   }
+#undef HYPRE_PATTERN_HASH
+
+   hypre_ParCSRMatrixDestroy(matrix_host);
+
+   *checksum_ptr = h;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToFloat
+ *
+ * Keeps single precision copies of the values of diag and offd (and of their
+ * stored transposes) and frees the HYPRE_Complex ones, see
+ * hypre_CSRMatrixConvertToFloat. The matrix can then only be used by the
+ * host matvecs and the relaxations that support it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToFloat( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffd(matrix));
+
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiagT(matrix));
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixSetDataOwner
  *--------------------------------------------------------------------------*/
@@ -81,6 +81,12 @@ typedef struct hypre_ParCSRMatrix_struct
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
 
+   /* Local rows without (interior) and with (boundary) offd coupling, the
+      interior rows first. Built on demand, used to work on interior rows
+      while the halo exchange is in flight. */
+   HYPRE_Int             num_interior_rows;
+   HYPRE_Int            *halo_row_order;
+
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
    HYPRE_Complex        *bdiaginv;
@@ -127,6 +133,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixNumInteriorRows(matrix)        ((matrix) -> num_interior_rows)
+#define hypre_ParCSRMatrixHaloRowOrder(matrix)           ((matrix) -> halo_row_order)
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -149,6 +157,14 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic structure of a product C = A*B, reused by numeric-only products
+ * (see par_csr_matmul_plan.c)
+ *--------------------------------------------------------------------------*/
+
+struct hypre_ParMatmulPlan_struct;
+typedef struct hypre_ParMatmulPlan_struct hypre_ParMatmulPlan;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -14,6 +14,372 @@
 #include "_hypre_parcsr_mv.h"
 #include "_hypre_utilities.hpp" //RL: TODO par_csr_matvec_device.c, include cuda there
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecBoundaryRowsHost
+ *
+ * y += alpha*A_offd*x_offd over the boundary rows of A only, i.e., the rows
+ * with offd entries (see hypre_ParCSRMatrixSetHaloRowOrder). This finishes
+ * the matvec once the halo has arrived; the interior rows are complete after
+ * the diag product that overlaps the exchange.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixMatvecBoundaryRowsHost( HYPRE_Complex       alpha,
+                                          hypre_ParCSRMatrix *A,
+                                          HYPRE_Complex      *x_offd_data,
+                                          HYPRE_Complex      *y_data )
+{
+   hypre_CSRMatrix *offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *offd_i      = hypre_CSRMatrixI(offd);
+   HYPRE_Int       *offd_j      = hypre_CSRMatrixJ(offd);
+   HYPRE_Complex   *offd_data   = hypre_CSRMatrixData(offd);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(offd);
+   HYPRE_Int       *halo_rows;
+   HYPRE_Int        num_interior, i, j, m;
+   HYPRE_Complex    tempx;
+
+   if (alpha == 0.0)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixSetHaloRowOrder(A);
+   halo_rows    = hypre_ParCSRMatrixHaloRowOrder(A);
+   num_interior = hypre_ParCSRMatrixNumInteriorRows(A);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,m,tempx) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = num_interior; i < num_rows; i++)
+   {
+      m = halo_rows[i];
+      tempx = 0.0;
+      for (j = offd_i[m]; j < offd_i[m + 1]; j++)
+      {
+         tempx += offd_data[j] * x_offd_data[offd_j[j]];
+      }
+      y_data[m] += alpha * tempx;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecMultiVecHost
+ *
+ * y = alpha*A*x + beta*b for multivectors stored row-wise
+ * (multivec_storage_method = 1). The halo of all vectors is exchanged in one
+ * message per neighbor and each row of A is read once for all vectors. With
+ * persistent communication, the handle for num_vectors is shared with the
+ * column-wise multivectors, so its buffers hold one vector after the other;
+ * the packing writes them in that order and the halo is transposed back into
+ * the row-wise x_tmp after the wait.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecMultiVecHost( HYPRE_Complex       alpha,
+                                      hypre_ParCSRMatrix *A,
+                                      hypre_ParVector    *x,
+                                      HYPRE_Complex       beta,
+                                      hypre_ParVector    *b,
+                                      hypre_ParVector    *y )
+{
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandle *comm_handle;
+   HYPRE_Complex   *x_recv_data;
+#else
+   hypre_ParCSRCommHandle *comm_handle;
+#endif
+   hypre_ParCSRCommPkg    *comm_pkg;
+
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+
+   hypre_Vector    *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector    *b_local = hypre_ParVectorLocalVector(b);
+   hypre_Vector    *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector    *x_tmp;
+
+   HYPRE_Int        num_vectors   = hypre_VectorNumVectors(x_local);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Complex   *x_local_data  = hypre_VectorData(x_local);
+   HYPRE_Complex   *x_tmp_data;
+   HYPRE_Complex   *x_buf_data;
+   HYPRE_Int        num_sends, send_size, i, jv;
+
+   hypre_assert( hypre_VectorIndexStride(b_local) == num_vectors );
+   hypre_assert( hypre_VectorIndexStride(y_local) == num_vectors );
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   x_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+   hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_HOST);
+   x_tmp_data = hypre_VectorData(x_tmp);
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   comm_handle = hypre_ParCSRCommPkgGetPersistentMultiVecCommHandle(1, comm_pkg, num_vectors);
+   x_buf_data  = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(comm_handle);
+   x_recv_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < send_size; i++)
+   {
+      const HYPRE_Complex *locl = x_local_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * num_vectors;
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         x_buf_data[jv * send_size + i] = locl[jv];
+      }
+   }
+#else
+   x_buf_data = hypre_TAlloc(HYPRE_Complex, send_size * num_vectors, HYPRE_MEMORY_HOST);
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < send_size; i++)
+   {
+      const HYPRE_Complex *locl = x_local_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * num_vectors;
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         x_buf_data[i * num_vectors + jv] = locl[jv];
+      }
+   }
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK]   += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandleStart(comm_handle, HYPRE_MEMORY_HOST, x_buf_data);
+#else
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVec(1, comm_pkg, num_vectors, x_buf_data,
+                                                      x_tmp_data);
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* overlapped local computation */
+   hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, x_local, beta, b_local, y_local, 0);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandleWait(comm_handle, HYPRE_MEMORY_HOST, x_recv_data);
+#else
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         x_tmp_data[i * num_vectors + jv] = x_recv_data[jv * num_cols_offd + i];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+#endif
+
+   if (num_cols_offd)
+   {
+      hypre_CSRMatrixMatvec(alpha, offd, x_tmp, 1.0, y_local);
+   }
+
+   hypre_SeqVectorDestroy(x_tmp);
+#ifndef HYPRE_USING_PERSISTENT_COMM
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecTMultiVecHost
+ *
+ * y = alpha*A^T*x + beta*y for multivectors stored row-wise, see
+ * hypre_ParCSRMatrixMatvecMultiVecHost for the buffer layout of the
+ * persistent handles.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecTMultiVecHost( HYPRE_Complex       alpha,
+                                       hypre_ParCSRMatrix *A,
+                                       hypre_ParVector    *x,
+                                       HYPRE_Complex       beta,
+                                       hypre_ParVector    *y )
+{
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandle *comm_handle;
+   HYPRE_Complex   *y_send_data, *y_tmp_data;
+#else
+   hypre_ParCSRCommHandle *comm_handle;
+#endif
+   hypre_ParCSRCommPkg    *comm_pkg;
+
+   hypre_CSRMatrix *diag  = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *offd  = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *diagT = hypre_ParCSRMatrixDiagT(A);
+   hypre_CSRMatrix *offdT = hypre_ParCSRMatrixOffdT(A);
+
+   hypre_Vector    *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector    *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector    *y_tmp;
+
+   HYPRE_Int        num_vectors   = hypre_VectorNumVectors(y_local);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Complex   *y_local_data  = hypre_VectorData(y_local);
+   HYPRE_Complex   *y_buf_data;
+   HYPRE_Int        num_sends, send_size, i, jv;
+
+   hypre_assert( hypre_VectorIndexStride(x_local) == num_vectors );
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   send_size = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   y_tmp = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(y_tmp) = 1;
+   hypre_SeqVectorInitialize_v2(y_tmp, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   comm_handle = hypre_ParCSRCommPkgGetPersistentMultiVecCommHandle(2, comm_pkg, num_vectors);
+   y_send_data = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(comm_handle);
+   y_buf_data  = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(comm_handle);
+   y_tmp_data  = hypre_VectorData(y_tmp);
+#else
+   y_buf_data = hypre_TAlloc(HYPRE_Complex, send_size * num_vectors, HYPRE_MEMORY_HOST);
+#endif
+
+   if (num_cols_offd)
+   {
+      if (offdT)
+      {
+         hypre_CSRMatrixMatvec(alpha, offdT, x_local, 0.0, y_tmp);
+      }
+      else
+      {
+         hypre_CSRMatrixMatvecT(alpha, offd, x_local, 0.0, y_tmp);
+      }
+   }
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         y_send_data[jv * num_cols_offd + i] = y_tmp_data[i * num_vectors + jv];
+      }
+   }
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandleStart(comm_handle, HYPRE_MEMORY_HOST, y_send_data);
+#else
+   comm_handle = hypre_ParCSRCommHandleCreateMultiVec(2, comm_pkg, num_vectors,
+                                                      hypre_VectorData(y_tmp), y_buf_data);
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* overlapped local computation */
+   if (diagT)
+   {
+      hypre_CSRMatrixMatvec(alpha, diagT, x_local, beta, y_local);
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecT(alpha, diag, x_local, beta, y_local);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandleWait(comm_handle, HYPRE_MEMORY_HOST, y_buf_data);
+#else
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   /* send_map_elmts may repeat, so the unpacking is not threaded */
+   for (i = 0; i < send_size; i++)
+   {
+      HYPRE_Complex *locl = y_local_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * num_vectors;
+
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+#ifdef HYPRE_USING_PERSISTENT_COMM
+         locl[jv] += y_buf_data[jv * send_size + i];
+#else
+         locl[jv] += y_buf_data[i * num_vectors + jv];
+#endif
+      }
+   }
+
+   hypre_SeqVectorDestroy(y_tmp);
+#ifndef HYPRE_USING_PERSISTENT_COMM
+   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
+#endif
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -54,6 +420,13 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    HYPRE_Complex *x_tmp_data, **x_buf_data;
    HYPRE_Complex *x_local_data = hypre_VectorData(x_local);
 
+   if ( num_vectors > 1 && idxstride == num_vectors &&
+        hypre_GetExecPolicy1(hypre_VectorMemoryLocation(x_local)) == HYPRE_EXEC_HOST )
+   {
+      /* row-wise multivector storage */
+      return hypre_ParCSRMatrixMatvecMultiVecHost(alpha, A, x, beta, b, y);
+   }
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_Int sync_stream;
    hypre_GetSyncCudaCompute(&sync_stream);
@@ -121,17 +494,19 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    HYPRE_Int use_persistent_comm = 0;
 
 #ifdef HYPRE_USING_PERSISTENT_COMM
+#if defined(HYPRE_USING_GPU)
    use_persistent_comm = num_vectors == 1;
-   // JSP TODO: we can use persistent communication for multi-vectors,
-   // but then we need different communication handles for different
-   // num_vectors.
+#else
+   /* multivectors: one handle per num_vectors, all vectors in one message */
+   use_persistent_comm = 1;
+#endif
    hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
 #endif
 
    if (use_persistent_comm)
    {
 #ifdef HYPRE_USING_PERSISTENT_COMM
-      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentMultiVecCommHandle(1, comm_pkg, num_vectors);
 #endif
    }
    else
@@ -195,7 +570,8 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
       if (use_persistent_comm)
       {
 #ifdef HYPRE_USING_PERSISTENT_COMM
-         x_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+         x_buf_data[jv] = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle) +
+                          jv * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
          continue;
 #endif
       }
@@ -317,7 +693,19 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    /* computation offd part */
    if (num_cols_offd)
    {
-      hypre_CSRMatrixMatvec( alpha, offd, x_tmp, 1.0, y_local );
+      /* with SELL enabled, go through hypre_CSRMatrixMatvec so that offd uses
+       * its SELL copy; the empty (interior) rows sort into zero-width chunks */
+      if ( num_vectors == 1 && !hypre_CSRMatrixRownnz(offd) && !hypre_CSRMatrixFloatData(offd) &&
+           !hypre_HandleSpMVUseSELL(hypre_handle()) &&
+           hypre_GetExecPolicy1(hypre_CSRMatrixMemoryLocation(offd)) == HYPRE_EXEC_HOST )
+      {
+         /* only the boundary rows are left to finish */
+         hypre_ParCSRMatrixMatvecBoundaryRowsHost(alpha, A, x_tmp_data, hypre_VectorData(y_local));
+      }
+      else
+      {
+         hypre_CSRMatrixMatvec( alpha, offd, x_tmp, 1.0, y_local );
+      }
    }
 
 #ifdef HYPRE_PROFILE
@@ -338,8 +726,8 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
          hypre_TFree(x_buf_data[jv], HYPRE_MEMORY_DEVICE);
       }
-      hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
    }
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
 
 #if defined(HYPRE_USING_GPU)
    hypre_SetSyncCudaCompute(sync_stream);
@@ -405,6 +793,13 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    HYPRE_Complex *y_tmp_data, **y_buf_data;
    HYPRE_Complex *y_local_data = hypre_VectorData(y_local);
 
+   if ( num_vectors > 1 && idxstride == num_vectors &&
+        hypre_GetExecPolicy1(hypre_VectorMemoryLocation(y_local)) == HYPRE_EXEC_HOST )
+   {
+      /* row-wise multivector storage */
+      return hypre_ParCSRMatrixMatvecTMultiVecHost(alpha, A, x, beta, y);
+   }
+
 #if defined(HYPRE_USING_GPU)
    HYPRE_Int sync_stream;
    hypre_GetSyncCudaCompute(&sync_stream);
@@ -470,17 +865,18 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    HYPRE_Int use_persistent_comm = 0;
 
 #ifdef HYPRE_USING_PERSISTENT_COMM
+#if defined(HYPRE_USING_GPU)
    use_persistent_comm = num_vectors == 1;
-   // JSP TODO: we can use persistent communication for multi-vectors,
-   // but then we need different communication handles for different
-   // num_vectors.
+#else
+   use_persistent_comm = 1;
+#endif
    hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
 #endif
 
    if (use_persistent_comm)
    {
 #ifdef HYPRE_USING_PERSISTENT_COMM
-      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentMultiVecCommHandle(2, comm_pkg, num_vectors);
 #endif
    }
    else
@@ -544,7 +940,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
       if (use_persistent_comm)
       {
 #ifdef HYPRE_USING_PERSISTENT_COMM
-         y_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+         y_buf_data[jv] = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle) +
+                          jv * hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
          continue;
 #endif
       }
@@ -705,8 +1102,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #endif
          hypre_TFree(y_buf_data[jv], HYPRE_MEMORY_DEVICE);
       }
-      hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
    }
+   hypre_TFree(y_buf_data, HYPRE_MEMORY_HOST);
 
 #if defined(HYPRE_USING_GPU)
    hypre_SetSyncCudaCompute(sync_stream);
@@ -720,6 +1117,391 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixResidualRestrict
+ *
+ *   Performs fc <- R^T * (f - A * u)   (transpose_R != 0, R = P)
+ *         or fc <- R   * (f - A * u)   (transpose_R == 0)
+ *
+ * With R^T, the residual and the restriction are computed in one pass over
+ * the local rows: row i of the residual is scattered into fc with row i of
+ * R as soon as it is computed. As in hypre_ParCSRMatrixMatvecOutOfPlace, the
+ * local work overlaps the halo exchange of u: the residual of the interior
+ * rows of A (see hypre_ParCSRMatrixSetHaloRowOrder) is stored in r while
+ * the halo is in flight, and the boundary rows are computed in the scatter
+ * pass. The scatter runs in row order, so without threads the results are
+ * bitwise identical to the unfused MatvecOutOfPlace followed by MatvecT.
+ * Both exchanges use the persistent handles of the comm packages when
+ * available. With threads, each thread scatters into its own copy of fc;
+ * these copies live in *work_ptr (of *work_size_ptr entries), which is
+ * grown when needed and kept by the caller across calls. With
+ * work_ptr = NULL they are allocated and freed here.
+ *
+ * With R, and when the matvecs use SELL storage, the fusion would bypass
+ * the matvec kernels, so r is formed with hypre_ParCSRMatrixMatvecOutOfPlace
+ * and restricted with hypre_ParCSRMatrixMatvec. Device data, multivectors
+ * and single precision matrices take the same unfused path (row-wise
+ * multivectors still read A and R once for all vectors there).
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Complex
+hypre_ParCSRMatrixResidualRow( HYPRE_Int      i,
+                               HYPRE_Int     *diag_i,
+                               HYPRE_Int     *diag_j,
+                               HYPRE_Complex *diag_data,
+                               HYPRE_Int     *offd_i,
+                               HYPRE_Int     *offd_j,
+                               HYPRE_Complex *offd_data,
+                               HYPRE_Complex *u_data,
+                               HYPRE_Complex *u_offd_data,
+                               HYPRE_Complex *f_data )
+{
+   HYPRE_Complex res, tempx;
+   HYPRE_Int     jj;
+
+   tempx = 0.0;
+   for (jj = diag_i[i]; jj < diag_i[i + 1]; jj++)
+   {
+      tempx -= diag_data[jj] * u_data[diag_j[jj]];
+   }
+   res = f_data[i] + tempx;
+
+   if (offd_i[i + 1] > offd_i[i])
+   {
+      tempx = 0.0;
+      for (jj = offd_i[i]; jj < offd_i[i + 1]; jj++)
+      {
+         tempx += offd_data[jj] * u_offd_data[offd_j[jj]];
+      }
+      res -= tempx;
+   }
+
+   return res;
+}
+
+HYPRE_Int
+hypre_ParCSRMatrixResidualRestrict( hypre_ParCSRMatrix *A,
+                                    hypre_ParVector    *u,
+                                    hypre_ParVector    *f,
+                                    hypre_ParCSRMatrix *R,
+                                    HYPRE_Int           transpose_R,
+                                    hypre_ParVector    *r,
+                                    hypre_ParVector    *fc,
+                                    HYPRE_Complex     **work_ptr,
+                                    HYPRE_Int          *work_size_ptr )
+{
+   hypre_ParCSRCommPkg    *comm_pkg_A, *comm_pkg_R;
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
+#else
+   hypre_ParCSRCommHandle *comm_handle;
+#endif
+
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *R_diag = hypre_ParCSRMatrixDiag(R);
+   hypre_CSRMatrix *R_offd = hypre_ParCSRMatrixOffd(R);
+
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex   *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex   *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *R_diag_i    = hypre_CSRMatrixI(R_diag);
+   HYPRE_Int       *R_diag_j    = hypre_CSRMatrixJ(R_diag);
+   HYPRE_Complex   *R_diag_data = hypre_CSRMatrixData(R_diag);
+   HYPRE_Int       *R_offd_i    = hypre_CSRMatrixI(R_offd);
+   HYPRE_Int       *R_offd_j    = hypre_CSRMatrixJ(R_offd);
+   HYPRE_Complex   *R_offd_data = hypre_CSRMatrixData(R_offd);
+
+   HYPRE_Int        num_rows        = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int        num_cols_offd_R = hypre_CSRMatrixNumCols(R_offd);
+   HYPRE_Int        num_coarse      = hypre_CSRMatrixNumCols(R_diag);
+
+   HYPRE_Complex   *u_data  = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex   *f_data  = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex   *r_data  = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   HYPRE_Complex   *fc_data = hypre_VectorData(hypre_ParVectorLocalVector(fc));
+   HYPRE_Complex   *u_buf_data, *u_offd_data, *fc_buf_data, *fc_offd_data;
+   HYPRE_Complex   *fc_expand = NULL;
+   HYPRE_Complex    res;
+
+   HYPRE_Int       *halo_rows;
+   HYPRE_Int        num_interior;
+   HYPRE_Int        use_fused = transpose_R;
+   HYPRE_Int        num_threads, my_thread_num, offset, expand_size;
+   HYPRE_Int        num_sends, i, ii, jj, k;
+
+#if defined(HYPRE_USING_GPU)
+   use_fused = 0;
+#endif
+
+   if (hypre_VectorNumVectors(hypre_ParVectorLocalVector(u)) != 1 ||
+       hypre_HandleSpMVUseSELL(hypre_handle()) ||
+       hypre_CSRMatrixFloatData(A_diag) || hypre_CSRMatrixFloatData(A_offd) ||
+       hypre_CSRMatrixFloatData(R_diag) || hypre_CSRMatrixFloatData(R_offd))
+   {
+      use_fused = 0;
+   }
+
+   if (!use_fused)
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, r);
+      if (transpose_R)
+      {
+         hypre_ParCSRMatrixMatvecT(1.0, R, r, 0.0, fc);
+      }
+      else
+      {
+         hypre_ParCSRMatrixMatvec(1.0, R, r, 0.0, fc);
+      }
+
+      return hypre_error_flag;
+   }
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   if (!hypre_ParCSRMatrixCommPkg(R))
+   {
+      hypre_MatvecCommPkgCreate(R);
+   }
+   comm_pkg_A = hypre_ParCSRMatrixCommPkg(A);
+   comm_pkg_R = hypre_ParCSRMatrixCommPkg(R);
+
+   /*-----------------------------------------------------------------
+    * Start the halo exchange of u
+    *-----------------------------------------------------------------*/
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg_A);
+   u_buf_data  = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+   u_offd_data = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+#else
+   u_buf_data  = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends),
+                              HYPRE_MEMORY_HOST);
+   u_offd_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd_A, HYPRE_MEMORY_HOST);
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends); i++)
+   {
+      u_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg_A, i)];
+   }
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, u_buf_data);
+#else
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg_A, u_buf_data, u_offd_data);
+#endif
+
+   /*-----------------------------------------------------------------
+    * fc = R^T r, scattering each r_i as soon as it is computed. The
+    * off-processor part of fc is accumulated in the send buffer of the
+    * job 2 exchange of R.
+    *-----------------------------------------------------------------*/
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg_R);
+
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   fc_offd_data = (HYPRE_Complex *)
+                  hypre_ParCSRCommHandleSendDataBuffer(hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg_R));
+   fc_buf_data  = (HYPRE_Complex *)
+                  hypre_ParCSRCommHandleRecvDataBuffer(hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg_R));
+#else
+   fc_offd_data = hypre_TAlloc(HYPRE_Complex, num_cols_offd_R, HYPRE_MEMORY_HOST);
+   fc_buf_data  = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg_R, num_sends),
+                               HYPRE_MEMORY_HOST);
+#endif
+
+   hypre_ParCSRMatrixSetHaloRowOrder(A);
+   halo_rows    = hypre_ParCSRMatrixHaloRowOrder(A);
+   num_interior = hypre_ParCSRMatrixNumInteriorRows(A);
+
+   num_threads = hypre_NumThreads();
+   expand_size = num_coarse + num_cols_offd_R;
+
+   if (num_threads > 1)
+   {
+      if (!work_ptr)
+      {
+         fc_expand = hypre_TAlloc(HYPRE_Complex, num_threads * expand_size, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         if (*work_size_ptr < num_threads * expand_size)
+         {
+            hypre_TFree(*work_ptr, HYPRE_MEMORY_HOST);
+            *work_size_ptr = num_threads * expand_size;
+            *work_ptr      = hypre_TAlloc(HYPRE_Complex, *work_size_ptr, HYPRE_MEMORY_HOST);
+         }
+         fc_expand = *work_ptr;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_threads * expand_size; i++)
+      {
+         fc_expand[i] = 0.0;
+      }
+   }
+   else
+   {
+      for (i = 0; i < num_coarse; i++)
+      {
+         fc_data[i] = 0.0;
+      }
+      for (i = 0; i < num_cols_offd_R; i++)
+      {
+         fc_offd_data[i] = 0.0;
+      }
+   }
+
+   /* residual of the interior rows while the halo of u is in flight */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,ii) HYPRE_SMP_SCHEDULE
+#endif
+   for (ii = 0; ii < num_interior; ii++)
+   {
+      i = halo_rows[ii];
+      r_data[i] = hypre_ParCSRMatrixResidualRow(i, A_diag_i, A_diag_j, A_diag_data,
+                                                A_offd_i, A_offd_j, A_offd_data,
+                                                u_data, u_offd_data, f_data);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, u_offd_data);
+#else
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   /* scatter in row order, computing the residual of the boundary rows */
+   if (num_threads > 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,jj,res,my_thread_num,offset)
+#endif
+      {
+         my_thread_num = hypre_GetThreadNum();
+         offset = expand_size * my_thread_num;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            res = A_offd_i[i + 1] > A_offd_i[i] ?
+                  hypre_ParCSRMatrixResidualRow(i, A_diag_i, A_diag_j, A_diag_data,
+                                                A_offd_i, A_offd_j, A_offd_data,
+                                                u_data, u_offd_data, f_data) : r_data[i];
+            for (jj = R_diag_i[i]; jj < R_diag_i[i + 1]; jj++)
+            {
+               fc_expand[offset + R_diag_j[jj]] += R_diag_data[jj] * res;
+            }
+            for (jj = R_offd_i[i]; jj < R_offd_i[i + 1]; jj++)
+            {
+               fc_expand[offset + num_coarse + R_offd_j[jj]] += R_offd_data[jj] * res;
+            }
+         }
+      } /* end parallel threaded region */
+   }
+   else
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         res = A_offd_i[i + 1] > A_offd_i[i] ?
+               hypre_ParCSRMatrixResidualRow(i, A_diag_i, A_diag_j, A_diag_data,
+                                             A_offd_i, A_offd_j, A_offd_data,
+                                             u_data, u_offd_data, f_data) : r_data[i];
+         for (jj = R_diag_i[i]; jj < R_diag_i[i + 1]; jj++)
+         {
+            fc_data[R_diag_j[jj]] += R_diag_data[jj] * res;
+         }
+         for (jj = R_offd_i[i]; jj < R_offd_i[i + 1]; jj++)
+         {
+            fc_offd_data[R_offd_j[jj]] += R_offd_data[jj] * res;
+         }
+      }
+   }
+
+   if (num_threads > 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,k,res) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < expand_size; i++)
+      {
+         res = 0.0;
+         for (k = 0; k < num_threads; k++)
+         {
+            res += fc_expand[k * expand_size + i];
+         }
+         if (i < num_coarse)
+         {
+            fc_data[i] = res;
+         }
+         else
+         {
+            fc_offd_data[i - num_coarse] = res;
+         }
+      }
+
+      if (!work_ptr)
+      {
+         hypre_TFree(fc_expand, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Send the off-processor contributions to their owners
+    *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg_R);
+   hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, fc_offd_data);
+   hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, fc_buf_data);
+#else
+   comm_handle = hypre_ParCSRCommHandleCreate(2, comm_pkg_R, fc_offd_data, fc_buf_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg_R, 0);
+        i < hypre_ParCSRCommPkgSendMapStart(comm_pkg_R, num_sends); i++)
+   {
+      fc_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg_R, i)] += fc_buf_data[i];
+   }
+
+#ifndef HYPRE_USING_PERSISTENT_COMM
+   hypre_TFree(u_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(u_offd_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(fc_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(fc_offd_data, HYPRE_MEMORY_HOST);
+#endif
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec_FF
  *--------------------------------------------------------------------------*/
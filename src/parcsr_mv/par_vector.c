@@ -441,6 +441,86 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorAxpyInnerProd
+ * y = y + alpha*x, returns <y,y>
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParVectorAxpyInnerProd( HYPRE_Complex    alpha,
+                              hypre_ParVector *x,
+                              hypre_ParVector *y )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(x);
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+
+   HYPRE_Real result = 0.0;
+   HYPRE_Real local_result = hypre_SeqVectorAxpyInnerProd(alpha, x_local, y_local);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(&local_result, &result, 1, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorAxpy2InnerProd
+ * y = y + alpha*x, w = w + beta*z, returns <w,w>
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParVectorAxpy2InnerProd( HYPRE_Complex    alpha,
+                               hypre_ParVector *x,
+                               hypre_ParVector *y,
+                               HYPRE_Complex    beta,
+                               hypre_ParVector *z,
+                               hypre_ParVector *w )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(x);
+
+   HYPRE_Real result = 0.0;
+   HYPRE_Real local_result = hypre_SeqVectorAxpy2InnerProd(alpha,
+                                                           hypre_ParVectorLocalVector(x),
+                                                           hypre_ParVectorLocalVector(y),
+                                                           beta,
+                                                           hypre_ParVectorLocalVector(z),
+                                                           hypre_ParVectorLocalVector(w));
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(&local_result, &result, 1, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorXpay
+ * y = x + beta*y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorXpay( HYPRE_Complex    beta,
+                     hypre_ParVector *x,
+                     hypre_ParVector *y )
+{
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+
+   return hypre_SeqVectorXpay( beta, x_local, y_local);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorElmdivpy
  * y = y + x ./ b [MATLAB Notation]
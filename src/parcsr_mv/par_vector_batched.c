@@ -83,6 +83,54 @@ hypre_ParVectorMassInnerProd( hypre_ParVector  *x,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorMassInnerProdMult
+ *
+ * result[i*k+j] = <x[i],y[j]> for i < nx, j < k, with a single reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorMassInnerProdMult( hypre_ParVector **x,
+                                  HYPRE_Int         nx,
+                                  hypre_ParVector **y,
+                                  HYPRE_Int         k,
+                                  HYPRE_Int         unroll,
+                                  HYPRE_Real       *result )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(x[0]);
+   HYPRE_Real *local_result;
+   HYPRE_Int i;
+   hypre_Vector **y_local;
+   y_local = hypre_TAlloc(hypre_Vector *, k, HYPRE_MEMORY_HOST);
+
+   for (i=0; i < k; i++)
+   {
+      y_local[i] = (hypre_Vector *) hypre_ParVectorLocalVector(y[i]);
+   }
+
+   local_result = hypre_CTAlloc(HYPRE_Real, nx*k, HYPRE_MEMORY_HOST);
+
+   for (i=0; i < nx; i++)
+   {
+      hypre_SeqVectorMassInnerProd(hypre_ParVectorLocalVector(x[i]), y_local, k, unroll,
+                                   &local_result[i*k]);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, nx*k, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(y_local, HYPRE_MEMORY_HOST);
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorMassDotpTwo
  *--------------------------------------------------------------------------*/
@@ -641,6 +641,106 @@ hypre_CSRMatrixBigAdd( hypre_CSRMatrix *A,
 
 #endif
 
+/*--------------------------------------------------------------------------
+ * Row accumulators of hypre_CSRMatrixMultiplyHost
+ *
+ * A row of C is accumulated either in a dense marker of length ncols_B or,
+ * when the bound on its number of nonzeros (the number of products) is a
+ * small fraction of ncols_B, in a linear-probing hash table of at least
+ * twice that bound, which stays in cache. Both give the entries of a row
+ * in the same order. See HYPRE_SetSpGemmHostAccumulator.
+ *--------------------------------------------------------------------------*/
+
+/* B with fewer columns (a marker of a few MB or less, which stays in the
+   outer caches) always uses the dense marker */
+#define HYPRE_SPGEMM_HOST_HASH_MIN_COLS (1 << 20)
+/* hash table if HYPRE_SPGEMM_HOST_HASH_RATIO * bound <= ncols_B */
+#define HYPRE_SPGEMM_HOST_HASH_RATIO    16
+
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyRowBound( HYPRE_Int  row,
+                                 HYPRE_Int  diag,
+                                 HYPRE_Int *A_i,
+                                 HYPRE_Int *A_j,
+                                 HYPRE_Int *B_i,
+                                 HYPRE_Int  ncols_B )
+{
+   HYPRE_Int ia, bound = diag;
+
+   for (ia = A_i[row]; ia < A_i[row+1]; ia++)
+   {
+      bound += B_i[A_j[ia]+1] - B_i[A_j[ia]];
+   }
+
+   return hypre_min(bound, ncols_B);
+}
+
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyUseHash( HYPRE_Int accumulator,
+                                HYPRE_Int bound,
+                                HYPRE_Int ncols_B )
+{
+   if (accumulator == 0)
+   {
+      return (HYPRE_SPGEMM_HOST_HASH_RATIO * bound <= ncols_B);
+   }
+
+   return (accumulator == 2);
+}
+
+/* returns the hash table size (2^(32-shift)) for a row, enlarging the
+   thread's table if needed; empty slots have key -1 */
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyHashSize( HYPRE_Int   bound,
+                                 HYPRE_Int  *shift_ptr,
+                                 HYPRE_Int **hash_keys_ptr,
+                                 HYPRE_Int **hash_vals_ptr,
+                                 HYPRE_Int  *hash_capacity_ptr )
+{
+   HYPRE_Int size = 16, shift = 28, i;
+
+   while (size < 2*bound)
+   {
+      size <<= 1;
+      shift--;
+   }
+   *shift_ptr = shift;
+
+   if (size > *hash_capacity_ptr)
+   {
+      hypre_TFree(*hash_keys_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(*hash_vals_ptr, HYPRE_MEMORY_HOST);
+      *hash_keys_ptr = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      *hash_vals_ptr = hypre_TAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      for (i = 0; i < size; i++)
+      {
+         (*hash_keys_ptr)[i] = -1;
+      }
+      *hash_capacity_ptr = size;
+   }
+
+   return size;
+}
+
+/* slot of key in the table: either the slot holding it or an empty one */
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyHashSlot( HYPRE_Int *hash_keys,
+                                 HYPRE_Int  mask,
+                                 HYPRE_Int  shift,
+                                 HYPRE_Int  key )
+{
+   /* Fibonacci hashing: the high bits of the product depend on all the
+      bits of the column, also for columns at a fixed stride */
+   HYPRE_Int slot = (HYPRE_Int) (((hypre_uint) key * HYPRE_XXH_PRIME32_1) >> shift);
+
+   while (hash_keys[slot] != -1 && hash_keys[slot] != key)
+   {
+      slot = (slot + 1) & mask;
+   }
+
+   return slot;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMultiplyHost
  *
@@ -683,6 +783,7 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
    HYPRE_Int             counter;
    HYPRE_Complex         a_entry, b_entry;
    HYPRE_Int             allsquare = 0;
+   HYPRE_Int             accumulator = hypre_HandleSpgemmHostAccumulator(hypre_handle());
    HYPRE_Int            *twspace;
 
    /* RL: TODO cannot guarantee, maybe should never assert
@@ -706,6 +807,12 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
       allsquare = 1;
    }
 
+   /* the adaptive choice only considers the hash table for a wide B */
+   if (accumulator == 0 && ncols_B < HYPRE_SPGEMM_HOST_HASH_MIN_COLS)
+   {
+      accumulator = 1;
+   }
+
    if ((num_nnz_A == 0) || (num_nnz_B == 0))
    {
       C = hypre_CSRMatrixCreate(nrows_A, ncols_B, 0);
@@ -724,7 +831,9 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
 #endif
    {
       HYPRE_Int  *B_marker = NULL;
-      HYPRE_Int   ns, ne, ii, jj;
+      HYPRE_Int  *hash_keys = NULL, *hash_vals = NULL;
+      HYPRE_Int   hash_capacity = 0, size, shift, slot;
+      HYPRE_Int   ns, ne, ii, jj, diag, bound, use_hash;
       HYPRE_Int   num_threads;
       HYPRE_Int   i1, iic;
 
@@ -732,32 +841,73 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
       num_threads = hypre_NumActiveThreads();
       hypre_partition1D(nnzrows_A, num_threads, ii, &ns, &ne);
 
-      B_marker = hypre_CTAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
-      for (ib = 0; ib < ncols_B; ib++)
-      {
-         B_marker[ib] = -1;
-      }
-
       /* First pass: compute sizes of C rows. */
       num_nonzeros = 0;
       for (ic = ns; ic < ne; ic++)
       {
-         if (rownnz_A)
+         iic  = rownnz_A ? rownnz_A[ic] : ic;
+         diag = (allsquare && !rownnz_A);
+         C_i[iic] = num_nonzeros;
+
+         use_hash = 0;
+         if (accumulator != 1)
          {
-            iic = rownnz_A[ic];
-            C_i[iic] = num_nonzeros;
+            bound    = hypre_CSRMatrixMultiplyRowBound(iic, diag, A_i, A_j, B_i, ncols_B);
+            use_hash = hypre_CSRMatrixMultiplyUseHash(accumulator, bound, ncols_B);
          }
-         else
+
+         if (use_hash)
          {
-            iic = ic;
-            C_i[iic] = num_nonzeros;
-            if (allsquare)
+            size = hypre_CSRMatrixMultiplyHashSize(bound, &shift, &hash_keys, &hash_vals, &hash_capacity);
+
+            /* hash_vals lists the occupied slots in this pass */
+            jj = 0;
+            if (diag)
             {
-               B_marker[iic] = iic;
-               num_nonzeros++;
+               slot = hypre_CSRMatrixMultiplyHashSlot(hash_keys, size-1, shift, iic);
+               hash_keys[slot]  = iic;
+               hash_vals[jj++] = slot;
+            }
+
+            for (ia = A_i[iic]; ia < A_i[iic+1]; ia++)
+            {
+               ja = A_j[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  slot = hypre_CSRMatrixMultiplyHashSlot(hash_keys, size-1, shift, jb);
+                  if (hash_keys[slot] == -1)
+                  {
+                     hash_keys[slot]  = jb;
+                     hash_vals[jj++] = slot;
+                  }
+               }
+            }
+            num_nonzeros += jj;
+
+            for (i1 = 0; i1 < jj; i1++)
+            {
+               hash_keys[hash_vals[i1]] = -1;
+            }
+
+            continue;
+         }
+
+         if (!B_marker)
+         {
+            B_marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+            for (ib = 0; ib < ncols_B; ib++)
+            {
+               B_marker[ib] = -1;
             }
          }
 
+         if (diag)
+         {
+            B_marker[iic] = iic;
+            num_nonzeros++;
+         }
+
          for (ia = A_i[iic]; ia < A_i[iic+1]; ia++)
          {
             ja = A_j[ia];
@@ -844,28 +994,90 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
 #endif
 
       /* Second pass: Fill in C_data and C_j. */
-      for (ib = 0; ib < ncols_B; ib++)
+      if (B_marker)
       {
-         B_marker[ib] = -1;
+         for (ib = 0; ib < ncols_B; ib++)
+         {
+            B_marker[ib] = -1;
+         }
       }
 
       counter = rownnz_A ? C_i[rownnz_A[ns]] : C_i[ns];
       for (ic = ns; ic < ne; ic++)
       {
-         if (rownnz_A)
+         iic  = rownnz_A ? rownnz_A[ic] : ic;
+         diag = (allsquare && !rownnz_A);
+
+         use_hash = 0;
+         if (accumulator != 1)
          {
-            iic = rownnz_A[ic];
+            bound    = hypre_CSRMatrixMultiplyRowBound(iic, diag, A_i, A_j, B_i, ncols_B);
+            use_hash = hypre_CSRMatrixMultiplyUseHash(accumulator, bound, ncols_B);
          }
-         else
+
+         if (use_hash)
          {
-            iic = ic;
-            if (allsquare)
+            size = hypre_CSRMatrixMultiplyHashSize(bound, &shift, &hash_keys, &hash_vals, &hash_capacity);
+
+            if (diag)
             {
-               B_marker[ic] = counter;
+               slot = hypre_CSRMatrixMultiplyHashSlot(hash_keys, size-1, shift, iic);
+               hash_keys[slot] = iic;
+               hash_vals[slot] = counter;
                C_data[counter] = 0;
-               C_j[counter] = ic;
+               C_j[counter] = iic;
                counter++;
             }
+
+            for (ia = A_i[iic]; ia < A_i[iic+1]; ia++)
+            {
+               ja = A_j[ia];
+               a_entry = A_data[ia];
+               for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+               {
+                  jb = B_j[ib];
+                  b_entry = B_data[ib];
+                  slot = hypre_CSRMatrixMultiplyHashSlot(hash_keys, size-1, shift, jb);
+                  if (hash_keys[slot] == -1)
+                  {
+                     hash_keys[slot] = jb;
+                     hash_vals[slot] = counter;
+                     C_j[counter] = jb;
+                     C_data[counter] = a_entry*b_entry;
+                     counter++;
+                  }
+                  else
+                  {
+                     C_data[hash_vals[slot]] += a_entry*b_entry;
+                  }
+               }
+            }
+
+            /* empty the table in reverse order of insertion, so that the
+               probe sequence of each key is intact when it is removed */
+            for (i1 = counter - 1; i1 >= C_i[iic]; i1--)
+            {
+               hash_keys[hypre_CSRMatrixMultiplyHashSlot(hash_keys, size-1, shift, C_j[i1])] = -1;
+            }
+
+            continue;
+         }
+
+         if (!B_marker)
+         {
+            B_marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+            for (ib = 0; ib < ncols_B; ib++)
+            {
+               B_marker[ib] = -1;
+            }
+         }
+
+         if (diag)
+         {
+            B_marker[ic] = counter;
+            C_data[counter] = 0;
+            C_j[counter] = ic;
+            counter++;
          }
 
          for (ia = A_i[iic]; ia < A_i[iic+1]; ia++)
@@ -893,6 +1105,8 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
 
       /* End of Second Pass */
       hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_keys, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_vals, HYPRE_MEMORY_HOST);
    } /*end parallel region */
 
 #ifdef HYPRE_DEBUG
@@ -1561,6 +1775,9 @@ hypre_CSRMatrixReorder(hypre_CSRMatrix *A)
 {
    HYPRE_Int ierr = 0;
 
+   /* the SELL copy no longer matches j and data */
+   hypre_CSRMatrixSellDestroy(A);
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
    HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy1( hypre_CSRMatrixMemoryLocation(A) );
 
@@ -1951,6 +2168,9 @@ hypre_CSRMatrixSetConstantValues( hypre_CSRMatrix *A,
    HYPRE_Int i;
    HYPRE_Int nnz = hypre_CSRMatrixNumNonzeros(A);
 
+   /* the SELL copy no longer matches the values */
+   hypre_CSRMatrixSellDestroy(A);
+
    if (!hypre_CSRMatrixData(A))
    {
       hypre_CSRMatrixData(A) = hypre_TAlloc(HYPRE_Complex, nnz, hypre_CSRMatrixMemoryLocation(A));
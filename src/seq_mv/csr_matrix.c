@@ -40,6 +40,8 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
    hypre_CSRMatrixMemoryLocation(matrix) = hypre_HandleMemoryLocation(hypre_handle());
+   hypre_CSRMatrixSell(matrix)           = NULL;
+   hypre_CSRMatrixFloatData(matrix)      = NULL;
 
    /* set defaults */
    hypre_CSRMatrixOwnsData(matrix)       = 1;
@@ -68,6 +70,8 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixSellDestroy(matrix);
+      hypre_TFree(hypre_CSRMatrixFloatData(matrix), HYPRE_MEMORY_HOST);
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
@@ -180,6 +184,8 @@ hypre_CSRMatrixResize( hypre_CSRMatrix *matrix, HYPRE_Int new_num_rows, HYPRE_In
       return 1;
    }
 
+   hypre_CSRMatrixSellDestroy(matrix);
+
    hypre_CSRMatrixNumCols(matrix) = new_num_cols;
 
    if (new_num_nonzeros != hypre_CSRMatrixNumNonzeros(matrix))
@@ -736,6 +742,9 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
+   /* the SELL copy of B no longer matches its CSR arrays */
+   hypre_CSRMatrixSellDestroy(B);
+
    hypre_TMemcpy(B_i, A_i, HYPRE_Int, num_rows + 1, memory_location_B, memory_location_A);
 
    if (A_j && B_j)
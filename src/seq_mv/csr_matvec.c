@@ -164,7 +164,30 @@ hypre_CSRMatrixMatvecOutOfPlaceHost( HYPRE_Complex    alpha,
        * y += A*x
        *-----------------------------------------------------------------*/
 
-      if (num_rownnz < xpar*num_rows)
+      if (idxstride_x == num_vectors && idxstride_y == num_vectors)
+      {
+         /* row-wise storage: the num_vectors values of an entry of x and y
+            are contiguous, so each row of A is read once for all vectors */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,jj) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            HYPRE_Complex *y_row = y_data + i*num_vectors;
+
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               const HYPRE_Complex  a_ij  = A_data[jj];
+               const HYPRE_Complex *x_row = x_data + A_j[jj]*num_vectors;
+
+               for (j = 0; j < num_vectors; j++)
+               {
+                  y_row[j] += a_ij * x_row[j];
+               }
+            }
+         }
+      }
+      else if (num_rownnz < xpar*num_rows)
       {
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i,j,jj,m,tempx) HYPRE_SMP_SCHEDULE
@@ -720,6 +743,18 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if ( hypre_CSRMatrixFloatData(A) )
+   {
+      /* single precision values, see hypre_CSRMatrixConvertToFloat */
+      ierr = hypre_CSRMatrixMatvecFloatHost(alpha, A, x, beta, b, y, offset);
+   }
+   else if ( hypre_HandleSpMVUseSELL(hypre_handle()) && offset == 0 &&
+        hypre_VectorNumVectors(x) == 1 && hypre_CSRMatrixNumCols(A) > 0 )
+   {
+      /* SELL-C-sigma copy of A, built on the first call */
+      ierr = hypre_CSRMatrixMatvecSellHost(alpha, A, x, beta, b, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecOutOfPlaceHost(alpha, A, x, beta, b, y, offset);
    }
@@ -858,7 +893,71 @@ hypre_CSRMatrixMatvecTHost( HYPRE_Complex    alpha,
     * y += A^T*x
     *-----------------------------------------------------------------*/
    num_threads = hypre_NumThreads();
-   if (num_threads > 1)
+   if (num_vectors > 1 && idxstride_x == num_vectors && idxstride_y == num_vectors)
+   {
+      /* row-wise storage: each row of A is read once for all vectors */
+      if (num_threads > 1)
+      {
+         y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*y_size*num_vectors, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,jj,j,jv,my_thread_num,offset)
+#endif
+         {
+            my_thread_num = hypre_GetThreadNum();
+            offset = y_size*num_vectors*my_thread_num;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < num_rows; i++)
+            {
+               const HYPRE_Complex *x_row = x_data + i*num_vectors;
+
+               for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+               {
+                  HYPRE_Complex *y_row = y_data_expand + offset + A_j[jj]*num_vectors;
+
+                  for (jv = 0; jv < num_vectors; jv++)
+                  {
+                     y_row[jv] += A_data[jj] * x_row[jv];
+                  }
+               }
+            }
+
+            /* implied barrier (for threads)*/
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+            for (i = 0; i < y_size*num_vectors; i++)
+            {
+               for (j = 0; j < num_threads; j++)
+               {
+                  y_data[i] += y_data_expand[j*y_size*num_vectors + i];
+               }
+            }
+         } /* end parallel threaded region */
+
+         hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+      }
+      else
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            const HYPRE_Complex *x_row = x_data + i*num_vectors;
+
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               HYPRE_Complex *y_row = y_data + A_j[jj]*num_vectors;
+
+               for (jv = 0; jv < num_vectors; jv++)
+               {
+                  y_row[jv] += A_data[jj] * x_row[jv];
+               }
+            }
+         }
+      }
+   }
+   else if (num_threads > 1)
    {
       y_data_expand = hypre_CTAlloc(HYPRE_Complex,  num_threads*y_size, HYPRE_MEMORY_HOST);
 
@@ -990,6 +1089,11 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
    }
    else
 #endif
+   if ( hypre_CSRMatrixFloatData(A) )
+   {
+      ierr = hypre_CSRMatrixMatvecTFloatHost(alpha, A, x, beta, y);
+   }
+   else
    {
       ierr = hypre_CSRMatrixMatvecTHost(alpha, A, x, beta, y);
    }
@@ -0,0 +1,303 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single precision storage for hypre_CSRMatrix class.
+ *
+ * hypre_CSRMatrixConvertToFloat replaces the values of a host matrix by a
+ * float copy (hypre_CSRMatrixFloatData) and frees the HYPRE_Complex array.
+ * Such a matrix can only be used by the kernels below (called from the host
+ * matvecs) and by the hybrid G-S and Jacobi relaxations; products are
+ * accumulated in HYPRE_Complex.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToFloat
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToFloat( hypre_CSRMatrix *A )
+{
+#if defined(HYPRE_COMPLEX)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision storage is not available for complex matrices\n");
+#else
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int       *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Complex   *A_data   = hypre_CSRMatrixData(A);
+   float           *A_fdata;
+   HYPRE_Int        nnz, i;
+
+   if (hypre_CSRMatrixFloatData(A))
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Single precision storage is only available on the host\n");
+      return hypre_error_flag;
+   }
+
+   /* the values of A must be ours to free */
+   if (!hypre_CSRMatrixOwnsData(A) || (!A_data && num_rows > 0 && A_i[num_rows] > 0))
+   {
+      return hypre_error_flag;
+   }
+
+   nnz = A_i ? A_i[num_rows] : 0;
+   A_fdata = hypre_TAlloc(float, nnz, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < nnz; i++)
+   {
+      A_fdata[i] = (float) A_data[i];
+   }
+
+   hypre_CSRMatrixSellDestroy(A);
+   hypre_TFree(A_data, hypre_CSRMatrixMemoryLocation(A));
+   hypre_CSRMatrixData(A)      = NULL;
+   hypre_CSRMatrixFloatData(A) = A_fdata;
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecFloatHost
+ *
+ * y = alpha*A*x + beta*b, A with single precision storage, as in
+ * hypre_CSRMatrixMatvecOutOfPlaceHost (including offset).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecFloatHost( HYPRE_Complex    alpha,
+                                hypre_CSRMatrix *A,
+                                hypre_Vector    *x,
+                                HYPRE_Complex    beta,
+                                hypre_Vector    *b,
+                                hypre_Vector    *y,
+                                HYPRE_Int        offset )
+{
+   float            *A_data   = hypre_CSRMatrixFloatData(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Int         num_cols = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *b_data = hypre_VectorData(b) + offset;
+   HYPRE_Complex    *y_data = hypre_VectorData(y) + offset;
+   HYPRE_Int         x_size = hypre_VectorSize(x);
+   HYPRE_Int         y_size = hypre_VectorSize(y) - offset;
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         idxstride_b = hypre_VectorIndexStride(b);
+   HYPRE_Int         vecstride_b = hypre_VectorVectorStride(b);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Complex     tempx;
+   HYPRE_Int         i, jj, jv, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert(num_vectors == hypre_VectorNumVectors(y));
+   hypre_assert(num_vectors == hypre_VectorNumVectors(b));
+
+   if (num_cols != x_size)
+   {
+      ierr = 1;
+   }
+   if (num_rows != y_size)
+   {
+      ierr = 2;
+   }
+   if (num_cols != x_size && num_rows != y_size)
+   {
+      ierr = 3;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      HYPRE_Complex *xv = x_data + jv * vecstride_x;
+      HYPRE_Complex *bv = b_data + jv * vecstride_b;
+      HYPRE_Complex *yv = y_data + jv * vecstride_y;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         tempx = 0.0;
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            tempx += (HYPRE_Complex) A_data[jj] * xv[A_j[jj]*idxstride_x];
+         }
+
+         if (beta == 0.0)
+         {
+            yv[i*idxstride_y] = alpha*tempx;
+         }
+         else
+         {
+            yv[i*idxstride_y] = alpha*tempx + beta*bv[i*idxstride_b];
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTFloatHost
+ *
+ * y = alpha*A^T*x + beta*y, A with single precision storage.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTFloatHost( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 hypre_Vector    *x,
+                                 HYPRE_Complex    beta,
+                                 hypre_Vector    *y )
+{
+   float            *A_data    = hypre_CSRMatrixFloatData(A);
+   HYPRE_Int        *A_i       = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j       = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows  = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols  = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *y_data = hypre_VectorData(y);
+   HYPRE_Int         x_size = hypre_VectorSize(x);
+   HYPRE_Int         y_size = hypre_VectorSize(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+
+   HYPRE_Complex    *y_data_expand;
+   HYPRE_Complex     tempx;
+   HYPRE_Int         num_threads = hypre_NumThreads();
+   HYPRE_Int         i, j, jj, jv, ierr = 0;
+   hypre_Vector     *x_tmp = NULL;
+
+   hypre_assert(num_vectors == hypre_VectorNumVectors(y));
+
+   if (num_rows != x_size)
+   {
+      ierr = 1;
+   }
+   if (num_cols != y_size)
+   {
+      ierr = 2;
+   }
+   if (num_rows != x_size && num_cols != y_size)
+   {
+      ierr = 3;
+   }
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /* y = beta*y */
+   if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols*num_vectors; i++)
+      {
+         y_data[i] = beta == 0.0 ? 0.0 : beta*y_data[i];
+      }
+   }
+
+   if (alpha != 0.0)
+   {
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         HYPRE_Complex *xv = x_data + jv * vecstride_x;
+         HYPRE_Complex *yv = y_data + jv * vecstride_y;
+
+         if (num_threads > 1)
+         {
+            y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*num_cols, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j,jj,tempx)
+#endif
+            {
+               HYPRE_Complex *y_thread = y_data_expand + hypre_GetThreadNum()*num_cols;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+               for (i = 0; i < num_rows; i++)
+               {
+                  tempx = alpha * xv[i*idxstride_x];
+                  for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+                  {
+                     y_thread[A_j[jj]] += (HYPRE_Complex) A_data[jj] * tempx;
+                  }
+               }
+
+               /* implied barrier */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+               for (i = 0; i < num_cols; i++)
+               {
+                  for (j = 0; j < num_threads; j++)
+                  {
+                     yv[i*idxstride_y] += y_data_expand[j*num_cols + i];
+                  }
+               }
+            }
+
+            hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+         }
+         else
+         {
+            for (i = 0; i < num_rows; i++)
+            {
+               tempx = alpha * xv[i*idxstride_x];
+               for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+               {
+                  yv[A_j[jj]*idxstride_y] += (HYPRE_Complex) A_data[jj] * tempx;
+               }
+            }
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
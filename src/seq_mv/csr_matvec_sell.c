@@ -0,0 +1,376 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma matvec functions for hypre_CSRMatrix class.
+ *
+ * The SELL copy is built from the CSR arrays on the first call to
+ * hypre_CSRMatrixMatvecSellHost and kept in hypre_CSRMatrixSell(A) until the
+ * matrix is destroyed, resized or copied into, or its values or pattern are
+ * changed by a library routine (e.g. hypre_CSRMatrixSetConstantValues,
+ * hypre_CSRMatrixReorder, hypre_CSRMatrixScale).  Code that writes the CSR
+ * arrays of A directly must call hypre_CSRMatrixSellDestroy itself.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+#if !defined(HYPRE_COMPLEX) && !defined(HYPRE_SINGLE) && !defined(HYPRE_LONG_DOUBLE)
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+#define HYPRE_SELL_USING_SIMD
+#endif
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellCreate
+ *
+ * Builds the SELL-C-sigma copy of the (host) matrix A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellCreate( hypre_CSRMatrix *A,
+                           HYPRE_Int        chunk_size,
+                           HYPRE_Int        sigma )
+{
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+
+   hypre_SellMatrix *sell;
+   HYPRE_Int         num_chunks, num_slots;
+   HYPRE_Int        *chunk_ptr, *chunk_len, *perm, *neg_len;
+   HYPRE_Int        *S_j;
+   HYPRE_Complex    *S_data;
+   HYPRE_Int         i, k, r, jj, row, len, start, end;
+
+   hypre_CSRMatrixSellDestroy(A);
+
+   if (chunk_size < 1 || chunk_size > HYPRE_SELL_MAX_CHUNK_SIZE)
+   {
+      chunk_size = HYPRE_SELL_CHUNK_SIZE;
+   }
+   if (sigma < chunk_size)
+   {
+      sigma = chunk_size;
+   }
+   /* whole chunks per sorting window */
+   sigma = (sigma / chunk_size) * chunk_size;
+
+   num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+   num_slots  = num_chunks * chunk_size;
+
+   chunk_ptr  = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len  = hypre_TAlloc(HYPRE_Int, num_chunks,     HYPRE_MEMORY_HOST);
+   perm       = hypre_TAlloc(HYPRE_Int, num_slots,      HYPRE_MEMORY_HOST);
+   neg_len    = hypre_TAlloc(HYPRE_Int, num_slots,      HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Sort rows by decreasing length within each window of sigma rows.
+    * The padding slots of the last chunk get perm = -1 and length 0.
+    *-----------------------------------------------------------------------*/
+
+   for (i = 0; i < num_rows; i++)
+   {
+      perm[i]    = i;
+      neg_len[i] = A_i[i] - A_i[i+1];
+   }
+   for (i = num_rows; i < num_slots; i++)
+   {
+      perm[i]    = -1;
+      neg_len[i] = 0;
+   }
+
+   for (start = 0; start < num_rows; start += sigma)
+   {
+      end = hypre_min(start + sigma, num_rows);
+
+      /* keep the natural order of windows that are already sorted (e.g. stencils) */
+      for (i = start + 1; i < end; i++)
+      {
+         if (neg_len[i] < neg_len[i-1])
+         {
+            break;
+         }
+      }
+      if (i < end)
+      {
+         hypre_qsort2i(neg_len, perm, start, end - 1);
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Chunk widths and offsets
+    *-----------------------------------------------------------------------*/
+
+   chunk_ptr[0] = 0;
+   for (k = 0; k < num_chunks; k++)
+   {
+      len = 0;
+      for (r = 0; r < chunk_size; r++)
+      {
+         len = hypre_max(len, -neg_len[k*chunk_size + r]);
+      }
+      chunk_len[k]   = len;
+      chunk_ptr[k+1] = chunk_ptr[k] + len * chunk_size;
+   }
+
+   S_j    = hypre_TAlloc(HYPRE_Int,     chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+   S_data = hypre_TAlloc(HYPRE_Complex, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Fill chunks column-major; padding entries point to column 0 with a
+    * zero coefficient so that the kernels never need a mask.
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k,r,jj,row,len) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_chunks; k++)
+   {
+      HYPRE_Int      *chunk_j    = S_j    + chunk_ptr[k];
+      HYPRE_Complex  *chunk_data = S_data + chunk_ptr[k];
+
+      for (r = 0; r < chunk_size; r++)
+      {
+         row = perm[k*chunk_size + r];
+         len = 0;
+         if (row > -1)
+         {
+            for (jj = A_i[row]; jj < A_i[row+1]; jj++, len++)
+            {
+               chunk_j[len*chunk_size + r]    = A_j[jj];
+               chunk_data[len*chunk_size + r] = A_data[jj];
+            }
+         }
+         for ( ; len < chunk_len[k]; len++)
+         {
+            chunk_j[len*chunk_size + r]    = 0;
+            chunk_data[len*chunk_size + r] = 0.0;
+         }
+      }
+   }
+
+   hypre_TFree(neg_len, HYPRE_MEMORY_HOST);
+
+   sell = hypre_CTAlloc(hypre_SellMatrix, 1, HYPRE_MEMORY_HOST);
+
+   hypre_SellMatrixChunkSize(sell)   = chunk_size;
+   hypre_SellMatrixSigma(sell)       = sigma;
+   hypre_SellMatrixNumRows(sell)     = num_rows;
+   hypre_SellMatrixNumChunks(sell)   = num_chunks;
+   hypre_SellMatrixNumNonzeros(sell) = hypre_CSRMatrixNumNonzeros(A);
+   hypre_SellMatrixChunkPtr(sell)    = chunk_ptr;
+   hypre_SellMatrixChunkLen(sell)    = chunk_len;
+   hypre_SellMatrixPerm(sell)        = perm;
+   hypre_SellMatrixJ(sell)           = S_j;
+   hypre_SellMatrixData(sell)        = S_data;
+   hypre_SellMatrixCSRData(sell)     = A_data;
+
+   hypre_CSRMatrixSell(A) = sell;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDestroy( hypre_CSRMatrix *A )
+{
+   hypre_SellMatrix *sell = hypre_CSRMatrixSell(A);
+
+   if (sell)
+   {
+      hypre_TFree(hypre_SellMatrixChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellMatrixChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellMatrixPerm(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellMatrixJ(sell),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellMatrixData(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixSell(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SellMatrixChunkProduct
+ *
+ * tmp[0:C] = A[chunk k, :] * x, with the rows of the chunk in SIMD lanes.
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_SellMatrixChunkProduct( HYPRE_Int       chunk_size,
+                              HYPRE_Int       len,
+                              HYPRE_Int      *chunk_j,
+                              HYPRE_Complex  *chunk_data,
+                              HYPRE_Complex  *x_data,
+                              HYPRE_Complex  *tmp )
+{
+   HYPRE_Int jj, r;
+
+#if defined(HYPRE_SELL_USING_SIMD) && defined(__AVX512F__)
+   if (chunk_size == 8)
+   {
+      __m512d acc = _mm512_setzero_pd();
+      for (jj = 0; jj < len; jj++)
+      {
+#if defined(HYPRE_BIGINT)
+         __m512i idx = _mm512_loadu_si512((const void *) (chunk_j + jj*8));
+         __m512d xv  = _mm512_i64gather_pd(idx, x_data, 8);
+#else
+         __m256i idx = _mm256_loadu_si256((const __m256i *) (chunk_j + jj*8));
+         __m512d xv  = _mm512_i32gather_pd(idx, x_data, 8);
+#endif
+         acc = _mm512_fmadd_pd(_mm512_loadu_pd(chunk_data + jj*8), xv, acc);
+      }
+      _mm512_storeu_pd(tmp, acc);
+      return;
+   }
+#endif
+
+#if defined(HYPRE_SELL_USING_SIMD) && defined(__AVX2__) && defined(__FMA__)
+   if (chunk_size == 4)
+   {
+      __m256d acc = _mm256_setzero_pd();
+      for (jj = 0; jj < len; jj++)
+      {
+#if defined(HYPRE_BIGINT)
+         __m256i idx = _mm256_loadu_si256((const __m256i *) (chunk_j + jj*4));
+         __m256d xv  = _mm256_i64gather_pd(x_data, idx, 8);
+#else
+         __m128i idx = _mm_loadu_si128((const __m128i *) (chunk_j + jj*4));
+         __m256d xv  = _mm256_i32gather_pd(x_data, idx, 8);
+#endif
+         acc = _mm256_fmadd_pd(_mm256_loadu_pd(chunk_data + jj*4), xv, acc);
+      }
+      _mm256_storeu_pd(tmp, acc);
+      return;
+   }
+#endif
+
+   for (r = 0; r < chunk_size; r++)
+   {
+      tmp[r] = 0.0;
+   }
+   for (jj = 0; jj < len; jj++)
+   {
+      for (r = 0; r < chunk_size; r++)
+      {
+         tmp[r] += chunk_data[jj*chunk_size + r] * x_data[chunk_j[jj*chunk_size + r]];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSellHost
+ *
+ * y = alpha*A*x + beta*b for a single vector, using the SELL-C-sigma copy
+ * of A (which is (re)built here when missing or out of date).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSellHost( HYPRE_Complex    alpha,
+                               hypre_CSRMatrix *A,
+                               hypre_Vector    *x,
+                               HYPRE_Complex    beta,
+                               hypre_Vector    *b,
+                               hypre_Vector    *y )
+{
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols = hypre_CSRMatrixNumCols(A);
+   HYPRE_Complex    *x_data   = hypre_VectorData(x);
+   HYPRE_Complex    *b_data   = hypre_VectorData(b);
+   HYPRE_Complex    *y_data   = hypre_VectorData(y);
+   hypre_Vector     *x_tmp    = NULL;
+   hypre_SellMatrix *sell     = hypre_CSRMatrixSell(A);
+
+   HYPRE_Int         chunk_size, num_chunks;
+   HYPRE_Int        *chunk_ptr, *chunk_len, *perm, *S_j;
+   HYPRE_Complex    *S_data;
+   HYPRE_Int         k, r, nr, row, ierr = 0;
+
+   hypre_assert(hypre_VectorNumVectors(x) == 1);
+
+   if (num_cols != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+
+   if (num_rows != hypre_VectorSize(y) || num_rows != hypre_VectorSize(b))
+   {
+      ierr = 2;
+   }
+
+   if (num_cols != hypre_VectorSize(x) && (num_rows != hypre_VectorSize(y) || num_rows != hypre_VectorSize(b)))
+   {
+      ierr = 3;
+   }
+
+   if ( !sell ||
+        hypre_SellMatrixNumRows(sell)     != num_rows ||
+        hypre_SellMatrixNumNonzeros(sell) != hypre_CSRMatrixNumNonzeros(A) ||
+        hypre_SellMatrixCSRData(sell)     != hypre_CSRMatrixData(A) )
+   {
+      hypre_CSRMatrixSellCreate(A, HYPRE_SELL_CHUNK_SIZE, HYPRE_SELL_SIGMA);
+      sell = hypre_CSRMatrixSell(A);
+   }
+
+   chunk_size = hypre_SellMatrixChunkSize(sell);
+   num_chunks = hypre_SellMatrixNumChunks(sell);
+   chunk_ptr  = hypre_SellMatrixChunkPtr(sell);
+   chunk_len  = hypre_SellMatrixChunkLen(sell);
+   perm       = hypre_SellMatrixPerm(sell);
+   S_j        = hypre_SellMatrixJ(sell);
+   S_data     = hypre_SellMatrixData(sell);
+
+   if (x == y)
+   {
+      x_tmp = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k,r,nr,row) HYPRE_SMP_SCHEDULE
+#endif
+   for (k = 0; k < num_chunks; k++)
+   {
+      HYPRE_Complex tmp[HYPRE_SELL_MAX_CHUNK_SIZE];
+
+      hypre_SellMatrixChunkProduct(chunk_size, chunk_len[k], S_j + chunk_ptr[k],
+                                   S_data + chunk_ptr[k], x_data, tmp);
+
+      nr = hypre_min(chunk_size, num_rows - k*chunk_size);
+      if (beta == 0.0)
+      {
+         for (r = 0; r < nr; r++)
+         {
+            row = perm[k*chunk_size + r];
+            y_data[row] = alpha*tmp[r];
+         }
+      }
+      else
+      {
+         for (r = 0; r < nr; r++)
+         {
+            row = perm[k*chunk_size + r];
+            y_data[row] = alpha*tmp[r] + beta*b_data[row];
+         }
+      }
+   }
+
+   if (x == y)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
@@ -46,6 +46,51 @@ struct hypre_GpuMatData;
 typedef struct hypre_GpuMatData hypre_GpuMatData;
 #endif
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) storage
+ *
+ * Companion layout of a hypre_CSRMatrix used by the host matvec. Rows are
+ * sorted by decreasing length within windows of sigma rows, and grouped in
+ * chunks of C rows. Each chunk is padded to its longest row and stored
+ * column-major, so that the C rows of a chunk map onto SIMD lanes.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             chunk_size;      /* C */
+   HYPRE_Int             sigma;           /* sorting window */
+   HYPRE_Int             num_rows;
+   HYPRE_Int             num_chunks;
+   HYPRE_Int             num_nonzeros;    /* nnz of the CSR matrix it was built from */
+   HYPRE_Int            *chunk_ptr;       /* chunk k starts at j[chunk_ptr[k]] */
+   HYPRE_Int            *chunk_len;       /* padded row length of chunk k */
+   HYPRE_Int            *perm;            /* row stored in slot i */
+   HYPRE_Int            *j;
+   HYPRE_Complex        *data;
+   HYPRE_Complex        *csr_data;        /* CSR data array the chunks were built from */
+} hypre_SellMatrix;
+
+#define hypre_SellMatrixChunkSize(matrix)           ((matrix) -> chunk_size)
+#define hypre_SellMatrixSigma(matrix)               ((matrix) -> sigma)
+#define hypre_SellMatrixNumRows(matrix)             ((matrix) -> num_rows)
+#define hypre_SellMatrixNumChunks(matrix)           ((matrix) -> num_chunks)
+#define hypre_SellMatrixNumNonzeros(matrix)         ((matrix) -> num_nonzeros)
+#define hypre_SellMatrixChunkPtr(matrix)            ((matrix) -> chunk_ptr)
+#define hypre_SellMatrixChunkLen(matrix)            ((matrix) -> chunk_len)
+#define hypre_SellMatrixPerm(matrix)                ((matrix) -> perm)
+#define hypre_SellMatrixJ(matrix)                   ((matrix) -> j)
+#define hypre_SellMatrixData(matrix)                ((matrix) -> data)
+#define hypre_SellMatrixCSRData(matrix)             ((matrix) -> csr_data)
+
+/* chunk height matching the SIMD width for HYPRE_Complex */
+#if defined(__AVX512F__)
+#define HYPRE_SELL_CHUNK_SIZE 8
+#else
+#define HYPRE_SELL_CHUNK_SIZE 4
+#endif
+#define HYPRE_SELL_MAX_CHUNK_SIZE 16
+#define HYPRE_SELL_SIGMA (32*HYPRE_SELL_CHUNK_SIZE)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -65,6 +110,8 @@ typedef struct
    HYPRE_Int            *rownnz;          /* for compressing rows in matrix multiplication  */
    HYPRE_Int             num_rownnz;
    HYPRE_MemoryLocation  memory_location; /* memory location of arrays i, j, data */
+   hypre_SellMatrix     *sell;            /* SELL-C-sigma copy for host matvec, built on demand */
+   float                *float_data;      /* single precision values, replace `data' when set (host) */
 #if defined(HYPRE_USING_CUSPARSE)
    HYPRE_Int            *sorted_j;        /* some cusparse routines require sorted CSR */
    HYPRE_Complex        *sorted_data;
@@ -91,6 +138,8 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)            ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)             ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix)       ((matrix) -> memory_location)
+#define hypre_CSRMatrixSell(matrix)                 ((matrix) -> sell)
+#define hypre_CSRMatrixFloatData(matrix)            ((matrix) -> float_data)
 
 #if defined(HYPRE_USING_CUSPARSE)
 #define hypre_CSRMatrixSortedJ(matrix)              ((matrix) -> sorted_j)
@@ -358,6 +407,16 @@ HYPRE_Int hypre_CSRMatrixMatvec ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hyp
 HYPRE_Int hypre_CSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y , HYPRE_Int *CF_marker_x , HYPRE_Int *CF_marker_y , HYPRE_Int fpt );
 
+/* csr_matvec_sell.c */
+HYPRE_Int hypre_CSRMatrixSellCreate ( hypre_CSRMatrix *A , HYPRE_Int chunk_size , HYPRE_Int sigma );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSellHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y );
+
+/* csr_matvec_float.c */
+HYPRE_Int hypre_CSRMatrixConvertToFloat ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecFloatHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTFloatHost ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
+
 /* csr_matvec_device.c */
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
 HYPRE_Int hypre_CSRMatrixMatvecCusparseNewAPI( HYPRE_Int trans, HYPRE_Complex alpha, hypre_CSRMatrix *A, hypre_Vector *x, HYPRE_Complex beta, hypre_Vector *y, HYPRE_Int offset );
@@ -449,6 +508,9 @@ hypre_Vector *hypre_SeqVectorCloneShallow ( hypre_Vector *x );
 HYPRE_Int hypre_SeqVectorScale( HYPRE_Complex alpha, hypre_Vector *y );
 
 HYPRE_Int hypre_SeqVectorAxpy ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y );
+HYPRE_Real hypre_SeqVectorAxpyInnerProd ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y );
+HYPRE_Real hypre_SeqVectorAxpy2InnerProd ( HYPRE_Complex alpha , hypre_Vector *x , hypre_Vector *y , HYPRE_Complex beta , hypre_Vector *z , hypre_Vector *w );
+HYPRE_Int hypre_SeqVectorXpay ( HYPRE_Complex beta , hypre_Vector *x , hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x , hypre_Vector *y );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,  HYPRE_Real *result);
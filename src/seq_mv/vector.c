@@ -550,6 +550,145 @@ hypre_SeqVectorAxpy( HYPRE_Complex alpha,
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorAxpyInnerProd
+ *
+ * y = y + alpha*x, returns <y,y> of the updated y (local part) in the same
+ * pass over the data.
+ *--------------------------------------------------------------------------*/
+HYPRE_Real
+hypre_SeqVectorAxpyInnerProd( HYPRE_Complex alpha,
+                              hypre_Vector *x,
+                              hypre_Vector *y )
+{
+#if defined(HYPRE_USING_GPU)
+   hypre_SeqVectorAxpy(alpha, x, y);
+
+   return hypre_SeqVectorInnerProd(y, y);
+#else
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   HYPRE_Complex *x_data = hypre_VectorData(x);
+   HYPRE_Complex *y_data = hypre_VectorData(y);
+   HYPRE_Int      size   = hypre_VectorSize(x);
+   HYPRE_Real     result = 0.0;
+   HYPRE_Int      i;
+
+   size *= hypre_VectorNumVectors(x);
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) reduction(+:result) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      y_data[i] += alpha * x_data[i];
+      result += hypre_conj(y_data[i]) * y_data[i];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+#endif /* defined(HYPRE_USING_GPU) */
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorAxpy2InnerProd
+ *
+ * y = y + alpha*x and w = w + beta*z, returns <w,w> of the updated w (local
+ * part). This is the solution/residual update of CG-type methods.
+ *--------------------------------------------------------------------------*/
+HYPRE_Real
+hypre_SeqVectorAxpy2InnerProd( HYPRE_Complex alpha,
+                               hypre_Vector *x,
+                               hypre_Vector *y,
+                               HYPRE_Complex beta,
+                               hypre_Vector *z,
+                               hypre_Vector *w )
+{
+#if defined(HYPRE_USING_GPU)
+   hypre_SeqVectorAxpy(alpha, x, y);
+   hypre_SeqVectorAxpy(beta, z, w);
+
+   return hypre_SeqVectorInnerProd(w, w);
+#else
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   HYPRE_Complex *x_data = hypre_VectorData(x);
+   HYPRE_Complex *y_data = hypre_VectorData(y);
+   HYPRE_Complex *z_data = hypre_VectorData(z);
+   HYPRE_Complex *w_data = hypre_VectorData(w);
+   HYPRE_Int      size   = hypre_VectorSize(x);
+   HYPRE_Real     result = 0.0;
+   HYPRE_Int      i;
+
+   size *= hypre_VectorNumVectors(x);
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) reduction(+:result) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      y_data[i] += alpha * x_data[i];
+      w_data[i] += beta * z_data[i];
+      result += hypre_conj(w_data[i]) * w_data[i];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+#endif /* defined(HYPRE_USING_GPU) */
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorXpay
+ *
+ * y = x + beta*y, replacing a Scale followed by an Axpy.
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_SeqVectorXpay( HYPRE_Complex beta,
+                     hypre_Vector *x,
+                     hypre_Vector *y )
+{
+#if defined(HYPRE_USING_GPU)
+   hypre_SeqVectorScale(beta, y);
+
+   return hypre_SeqVectorAxpy(1.0, x, y);
+#else
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   HYPRE_Complex *x_data = hypre_VectorData(x);
+   HYPRE_Complex *y_data = hypre_VectorData(y);
+   HYPRE_Int      size   = hypre_VectorSize(x);
+   HYPRE_Int      i;
+
+   size *= hypre_VectorNumVectors(x);
+
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < size; i++)
+   {
+      y_data[i] = x_data[i] + beta * y_data[i];
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+#endif /* defined(HYPRE_USING_GPU) */
+}
+
 /* y = y + x ./ b */
 HYPRE_Int
 hypre_SeqVectorElmdivpy( hypre_Vector *x,
@@ -22,6 +22,7 @@ HYPRE_SStructBiCGSTABCreate( MPI_Comm             comm,
          hypre_SStructKrylovInnerProd, hypre_SStructKrylovCopyVector,
 	 hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
+         NULL, NULL,
 	 hypre_SStructKrylovCommInfo,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
 
@@ -20,9 +20,12 @@ HYPRE_SStructPCGCreate( MPI_Comm             comm,
          hypre_SStructKrylovCreateVector,
          hypre_SStructKrylovDestroyVector, hypre_SStructKrylovMatvecCreate,
          hypre_SStructKrylovMatvec, hypre_SStructKrylovMatvecDestroy,
-         hypre_SStructKrylovInnerProd, hypre_SStructKrylovCopyVector,
+         hypre_SStructKrylovInnerProd,
+         hypre_SStructKrylovInnerProdStart, hypre_SStructKrylovInnerProdWait,
+         hypre_SStructKrylovCopyVector,
          hypre_SStructKrylovClearVector,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
+         NULL, NULL,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
 
    *solver = ( (HYPRE_SStructSolver) hypre_PCGCreate( pcg_functions ) );
@@ -501,6 +501,8 @@ void *hypre_SStructKrylovMatvecCreate ( void *A , void *x );
 HYPRE_Int hypre_SStructKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_SStructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_SStructKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_SStructKrylovInnerProdStart ( HYPRE_Int n , void **x , void **y , HYPRE_Real *local , HYPRE_Real *result , hypre_MPI_Request *request );
+HYPRE_Int hypre_SStructKrylovInnerProdWait ( hypre_MPI_Request *request );
 HYPRE_Int hypre_SStructKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_SStructKrylovClearVector ( void *x );
 HYPRE_Int hypre_SStructKrylovScaleVector ( HYPRE_Complex alpha , void *x );
@@ -215,6 +215,44 @@ hypre_SStructKrylovInnerProd( void *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovInnerProdStart( HYPRE_Int           n,
+                                   void              **x,
+                                   void              **y,
+                                   HYPRE_Real         *local,
+                                   HYPRE_Real         *result,
+                                   hypre_MPI_Request  *request )
+{
+   HYPRE_Int k;
+
+   for (k = 0; k < n; k++)
+   {
+      hypre_SStructInnerProdLocal( (hypre_SStructVector *) x[k],
+                                   (hypre_SStructVector *) y[k], &local[k] );
+   }
+
+   hypre_MPI_Iallreduce(local, result, n, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                        hypre_SStructVectorComm((hypre_SStructVector *) x[0]), request);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovInnerProdWait( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+   hypre_MPI_Wait(request, &status);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
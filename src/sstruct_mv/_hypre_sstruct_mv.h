@@ -69,7 +69,7 @@ typedef struct
    HYPRE_SStructVariable  *vartypes;         /* types of variables */
    hypre_StructGrid       *sgrids[8];        /* struct grids for each vartype */
    hypre_BoxArray         *iboxarrays[8];    /* interface boxes */
-
+                                       
    hypre_BoxArray         *pneighbors;
    hypre_Index            *pnbor_offsets;
 
@@ -81,7 +81,7 @@ typedef struct
   /* GEC0902 additions for ghost expansion of boxes */
 
    HYPRE_Int               ghlocal_size;     /* Number of vars including ghosts */
-
+                           
    HYPRE_Int               cell_sgrid_done;  /* =1 implies cell grid already assembled */
 } hypre_SStructPGrid;
 
@@ -105,7 +105,7 @@ typedef struct
 {
    HYPRE_Int  type;
    HYPRE_BigInt offset;
-   HYPRE_BigInt ghoffset;
+   HYPRE_BigInt ghoffset; 
 
 } hypre_SStructBoxManInfo;
 
@@ -116,13 +116,13 @@ typedef struct
    HYPRE_BigInt ghoffset; /* minimum offset ghost for this box */
    HYPRE_Int    proc;     /* redundant with the proc in the entry, but
                              makes some coding easier */
-   HYPRE_Int    boxnum;   /* this is different from the entry id */
+   HYPRE_Int    boxnum;   /* this is different from the entry id */ 
    HYPRE_Int    part;     /* part the box lives on */
    hypre_Index  ilower;   /* box ilower, but on the neighbor index-space */
    hypre_Index  coord;    /* lives on local index-space */
    hypre_Index  dir;      /* lives on local index-space */
    hypre_Index  stride;   /* lives on local index-space */
-   hypre_Index  ghstride; /* the ghost equivalent of strides */
+   hypre_Index  ghstride; /* the ghost equivalent of strides */ 
 
 } hypre_SStructBoxManNborInfo;
 
@@ -133,7 +133,7 @@ typedef struct
    HYPRE_Int        recv_part;
    HYPRE_Int        send_var;
    HYPRE_Int        recv_var;
-
+   
 } hypre_SStructCommInfo;
 
 typedef struct hypre_SStructGrid_struct
@@ -141,11 +141,11 @@ typedef struct hypre_SStructGrid_struct
    MPI_Comm                   comm;
    HYPRE_Int                  ndim;
    HYPRE_Int                  nparts;
-
-   /* s-variable info */
+                          
+   /* s-variable info */  
    hypre_SStructPGrid       **pgrids;
-
-   /* neighbor info */
+                          
+   /* neighbor info */    
    HYPRE_Int                 *nneighbors;
    hypre_SStructNeighbor    **neighbors;
    hypre_Index              **nbor_offsets;
@@ -172,14 +172,14 @@ typedef struct hypre_SStructGrid_struct
 
    HYPRE_Int                  local_size;  /* Number of variables locally */
    HYPRE_BigInt               global_size; /* Total number of variables */
-
+                              
    HYPRE_Int                  ref_count;
 
  /* GEC0902 additions for ghost expansion of boxes */
 
    HYPRE_Int               ghlocal_size;  /* GEC0902 Number of vars including ghosts */
    HYPRE_BigInt            ghstart_rank;  /* GEC0902 start rank including ghosts  */
-   HYPRE_Int               num_ghost[2*HYPRE_MAXDIM]; /* ghost layer size */
+   HYPRE_Int               num_ghost[2*HYPRE_MAXDIM]; /* ghost layer size */  
 
 } hypre_SStructGrid;
 
@@ -386,7 +386,7 @@ typedef struct
    HYPRE_Int     part;
    hypre_Index   index;
    HYPRE_Int     var;
-   HYPRE_Int     to_part;
+   HYPRE_Int     to_part;     
    hypre_Index   to_index;
    HYPRE_Int     to_var;
 
@@ -704,7 +704,7 @@ typedef struct
 
    HYPRE_Int               ref_count;
 
-   HYPRE_Int              *dataindices;  /* GEC1002 array for starting index of the
+   HYPRE_Int              *dataindices;  /* GEC1002 array for starting index of the 
                                             svector. pdataindices[varx] */
    HYPRE_Int               datasize;     /* Size of the pvector = sums size of svectors */
 
@@ -914,6 +914,7 @@ HYPRE_Int hypre_SStructGridIntersect ( hypre_SStructGrid *grid , HYPRE_Int part
 /* sstruct_innerprod.c */
 HYPRE_Int hypre_SStructPInnerProd ( hypre_SStructPVector *px , hypre_SStructPVector *py , HYPRE_Real *presult_ptr );
 HYPRE_Int hypre_SStructInnerProd ( hypre_SStructVector *x , hypre_SStructVector *y , HYPRE_Real *result_ptr );
+HYPRE_Int hypre_SStructInnerProdLocal ( hypre_SStructVector *x , hypre_SStructVector *y , HYPRE_Real *result_ptr );
 
 /* sstruct_matrix.c */
 HYPRE_Int hypre_SStructPMatrixRef ( hypre_SStructPMatrix *matrix , hypre_SStructPMatrix **matrix_ref );
@@ -20,6 +20,7 @@ HYPRE_StructBiCGSTABCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
+         NULL, NULL,
          hypre_StructKrylovCommInfo,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
 
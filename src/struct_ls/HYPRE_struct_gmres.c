@@ -23,6 +23,7 @@ HYPRE_StructGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
+         NULL,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
 
    *solver = ( (HYPRE_StructSolver) hypre_GMRESCreate( gmres_functions ) );
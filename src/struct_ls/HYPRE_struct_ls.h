@@ -265,6 +265,9 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *    - 4 : Weighted line Jacobi along the coarsening direction of each level,
+ *          with the weights of 1 (lines split across boxes are relaxed per
+ *          box; falls back to Jacobi for constant coefficient matrices)
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                  HYPRE_Int          relax_type);
@@ -328,6 +331,22 @@ HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGGetSkipRelax(HYPRE_StructSolver solver,
                                        HYPRE_Int *skip_relax);
 
+/**
+ * (Optional) Use temporal blocking in the smoother.  If set to 1, each pre-
+ * or post-relaxation call exchanges a ghost layer deep enough for all of its
+ * sweeps once and then relaxes cache-sized tiles of each box through all
+ * sweeps, which reduces memory traffic for bandwidth-bound problems.  This
+ * applies to variable coefficient matrices with stencils of radius one
+ * (5-pt or 7-pt for red-black Gauss-Seidel) and is ignored otherwise.  It
+ * keeps a private copy of the matrix on every level where it is used.  The
+ * default is 0.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetTemporalBlocking(HYPRE_StructSolver solver,
+                                              HYPRE_Int          temporal_blocking);
+
+HYPRE_Int HYPRE_StructPFMGGetTemporalBlocking(HYPRE_StructSolver solver,
+                                              HYPRE_Int *temporal_blocking);
+
 /*
  * RE-VISIT
  **/
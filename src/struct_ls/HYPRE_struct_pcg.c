@@ -25,9 +25,12 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovCreateVector,
          hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
          hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
-         hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovInnerProd,
+         hypre_StructKrylovInnerProdStart, hypre_StructKrylovInnerProdWait,
+         hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
+         NULL, NULL,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
 
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
@@ -93,6 +93,20 @@ HYPRE_Int hypre_JacobiGetNumIterations ( void *jacobi_vdata , HYPRE_Int *num_ite
 HYPRE_Int hypre_JacobiSetTempVec ( void *jacobi_vdata , hypre_StructVector *t );
 HYPRE_Int hypre_JacobiGetFinalRelativeResidualNorm ( void *jacobi_vdata , HYPRE_Real *norm );
 
+/* line_relax.c */
+HYPRE_Int hypre_LineSolveSupported ( hypre_StructMatrix *A , HYPRE_Int dir , HYPRE_Int *supported_ptr );
+HYPRE_Int hypre_LineSolveWorkSize ( hypre_StructVector *x , HYPRE_Int *work_size_ptr );
+HYPRE_Int hypre_LineSolve ( hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Int dir , HYPRE_Int i , hypre_Index loop_size , hypre_IndexRef start , hypre_IndexRef stride , HYPRE_Real *work );
+void *hypre_LineRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_LineRelaxDestroy ( void *relax_vdata );
+HYPRE_Int hypre_LineRelaxSetup ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_LineRelax ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_LineRelaxSetDir ( void *relax_vdata , HYPRE_Int dir );
+HYPRE_Int hypre_LineRelaxSetWeight ( void *relax_vdata , HYPRE_Real weight );
+HYPRE_Int hypre_LineRelaxSetMaxIter ( void *relax_vdata , HYPRE_Int max_iter );
+HYPRE_Int hypre_LineRelaxSetZeroGuess ( void *relax_vdata , HYPRE_Int zero_guess );
+HYPRE_Int hypre_LineRelaxSetTempVec ( void *relax_vdata , hypre_StructVector *t );
+
 /* pcg_struct.c */
 void *hypre_StructKrylovCAlloc ( size_t count, size_t elt_size, HYPRE_MemoryLocation location );
 HYPRE_Int hypre_StructKrylovFree ( void *ptr );
@@ -103,6 +117,8 @@ void *hypre_StructKrylovMatvecCreate ( void *A , void *x );
 HYPRE_Int hypre_StructKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_StructKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_StructKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_StructKrylovInnerProdStart ( HYPRE_Int n , void **x , void **y , HYPRE_Real *local , HYPRE_Real *result , hypre_MPI_Request *request );
+HYPRE_Int hypre_StructKrylovInnerProdWait ( hypre_MPI_Request *request );
 HYPRE_Int hypre_StructKrylovCopyVector ( void *x , void *y );
 HYPRE_Int hypre_StructKrylovClearVector ( void *x );
 HYPRE_Int hypre_StructKrylovScaleVector ( HYPRE_Complex alpha , void *x );
@@ -166,6 +182,8 @@ HYPRE_Int hypre_PFMGSetNumPostRelax ( void *pfmg_vdata , HYPRE_Int num_post_rela
 HYPRE_Int hypre_PFMGGetNumPostRelax ( void *pfmg_vdata , HYPRE_Int *num_post_relax );
 HYPRE_Int hypre_PFMGSetSkipRelax ( void *pfmg_vdata , HYPRE_Int skip_relax );
 HYPRE_Int hypre_PFMGGetSkipRelax ( void *pfmg_vdata , HYPRE_Int *skip_relax );
+HYPRE_Int hypre_PFMGSetTemporalBlocking ( void *pfmg_vdata , HYPRE_Int temporal_blocking );
+HYPRE_Int hypre_PFMGGetTemporalBlocking ( void *pfmg_vdata , HYPRE_Int *temporal_blocking );
 HYPRE_Int hypre_PFMGSetDxyz ( void *pfmg_vdata , HYPRE_Real *dxyz );
 HYPRE_Int hypre_PFMGSetLogging ( void *pfmg_vdata , HYPRE_Int logging );
 HYPRE_Int hypre_PFMGGetLogging ( void *pfmg_vdata , HYPRE_Int *logging );
@@ -188,6 +206,8 @@ HYPRE_Int hypre_PFMGRelaxSetTol ( void *pfmg_relax_vdata , HYPRE_Real tol );
 HYPRE_Int hypre_PFMGRelaxSetMaxIter ( void *pfmg_relax_vdata , HYPRE_Int max_iter );
 HYPRE_Int hypre_PFMGRelaxSetZeroGuess ( void *pfmg_relax_vdata , HYPRE_Int zero_guess );
 HYPRE_Int hypre_PFMGRelaxSetTempVec ( void *pfmg_relax_vdata , hypre_StructVector *t );
+HYPRE_Int hypre_PFMGRelaxSetTemporalBlocking ( void *pfmg_relax_vdata , HYPRE_Int num_sweeps );
+HYPRE_Int hypre_PFMGRelaxSetLineDir ( void *pfmg_relax_vdata , HYPRE_Int line_dir );
 
 /* pfmg_setup.c */
 HYPRE_Int hypre_PFMGSetup ( void *pfmg_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
@@ -457,6 +477,20 @@ HYPRE_Int hypre_SparseMSGSetupRAPOp ( hypre_StructMatrix *R , hypre_StructMatrix
 /* sparse_msg_solve.c */
 HYPRE_Int hypre_SparseMSGSolve ( void *smsg_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
 
+/* temporal_relax.c */
+void *hypre_TemporalRelaxCreate ( MPI_Comm comm );
+HYPRE_Int hypre_TemporalRelaxDestroy ( void *relax_vdata );
+HYPRE_Int hypre_TemporalRelaxSetup ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_TemporalRelax ( void *relax_vdata , hypre_StructMatrix *A , hypre_StructVector *b , hypre_StructVector *x );
+HYPRE_Int hypre_TemporalRelaxSetType ( void *relax_vdata , HYPRE_Int relax_type );
+HYPRE_Int hypre_TemporalRelaxSetWeight ( void *relax_vdata , HYPRE_Real weight );
+HYPRE_Int hypre_TemporalRelaxSetNumSweeps ( void *relax_vdata , HYPRE_Int num_sweeps );
+HYPRE_Int hypre_TemporalRelaxGetNumSweeps ( void *relax_vdata , HYPRE_Int *num_sweeps );
+HYPRE_Int hypre_TemporalRelaxSetMaxIter ( void *relax_vdata , HYPRE_Int max_iter );
+HYPRE_Int hypre_TemporalRelaxSetZeroGuess ( void *relax_vdata , HYPRE_Int zero_guess );
+HYPRE_Int hypre_TemporalRelaxSetStartRed ( void *relax_vdata );
+HYPRE_Int hypre_TemporalRelaxSetStartBlack ( void *relax_vdata );
+
 
 #ifdef __cplusplus
 }
@@ -74,6 +74,10 @@ typedef struct
    hypre_ComputePkg    **down_compute_pkg_l;
    hypre_ComputePkg    **up_compute_pkg_l;
 
+   HYPRE_Int             line_solve;   /* solve whole lines with hypre_LineSolve */
+   HYPRE_Real           *line_work;
+   HYPRE_Int             line_work_size;
+
    HYPRE_Int             time_index;
    HYPRE_BigInt          solve_flops;
    HYPRE_Int             max_levels;
@@ -496,9 +500,13 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
    hypre_StructGrid       *grid;
 
    hypre_Box              *cbox;
+   hypre_Box              *bbox;
+   hypre_BoxArray         *boxes;
+   hypre_Box              *box;
 
-   HYPRE_Int               l;
+   HYPRE_Int               l, i;
    HYPRE_Int               flop_divisor;
+   HYPRE_Int               line_solve, line_solve_all;
 
    HYPRE_Int               x_num_ghost[] = {0, 0, 0, 0, 0, 0};
 #if 0 //defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
@@ -511,6 +519,39 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
 
    grid = hypre_StructMatrixGrid(A);
 
+   /*-----------------------------------------------------
+    * Check whether every line lies within one box, in
+    * which case the lines are solved directly with the
+    * batched line solver and no coarse levels are needed.
+    * A grid holding a single line gains nothing from the
+    * batching and is left to cyclic reduction.
+    *-----------------------------------------------------*/
+
+   hypre_LineSolveSupported(A, cdir, &line_solve);
+   if (hypre_IndexD(base_stride, cdir) != 1 ||
+       hypre_IndexD(hypre_StructGridPeriodic(grid), cdir) != 0)
+   {
+      line_solve = 0;
+   }
+   bbox  = hypre_StructGridBoundingBox(grid);
+   if (hypre_BoxVolume(bbox) <= hypre_BoxSizeD(bbox, cdir))
+   {
+      line_solve = 0;
+   }
+   boxes = hypre_StructGridBoxes(grid);
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxIMinD(box, cdir) != hypre_BoxIMinD(bbox, cdir) ||
+          hypre_BoxIMaxD(box, cdir) != hypre_BoxIMaxD(bbox, cdir))
+      {
+         line_solve = 0;
+      }
+   }
+   hypre_MPI_Allreduce(&line_solve, &line_solve_all, 1, HYPRE_MPI_INT,
+                       hypre_MPI_MIN, comm);
+   (cyc_red_data -> line_solve) = line_solve_all;
+
    /* Compute a preliminary num_levels value based on the grid */
    cbox = hypre_BoxDuplicate(hypre_StructGridBoundingBox(grid));
    num_levels = hypre_Log2(hypre_BoxSizeD(cbox, cdir)) + 2;
@@ -518,6 +559,10 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
    {
       max_levels = (cyc_red_data -> max_levels);
    }
+   if (cyc_red_data -> line_solve)
+   {
+      max_levels = 1;
+   }
 
 
    grid_l    = hypre_TAlloc(hypre_StructGrid *,  num_levels, HYPRE_MEMORY_HOST);
@@ -808,6 +853,7 @@ hypre_CyclicReduction( void               *cyc_red_vdata,
    hypre_Index           stridec;
 
    HYPRE_Int             compute_i, fi, ci, j, l;
+   HYPRE_Int             work_size;
 
    hypre_BeginTiming(cyc_red_data -> time_index);
 
@@ -852,6 +898,37 @@ hypre_CyclicReduction( void               *cyc_red_vdata,
 #undef DEVICE_VAR
    }
 
+   /*--------------------------------------------------
+    * Whole lines: solve them in place with the batched
+    * line solver
+    *--------------------------------------------------*/
+
+   if (cyc_red_data -> line_solve)
+   {
+      hypre_LineSolveWorkSize(x, &work_size);
+      if (work_size > (cyc_red_data -> line_work_size))
+      {
+         hypre_TFree(cyc_red_data -> line_work, HYPRE_MEMORY_HOST);
+         (cyc_red_data -> line_work) = hypre_TAlloc(HYPRE_Real, work_size,
+                                                    HYPRE_MEMORY_HOST);
+         (cyc_red_data -> line_work_size) = work_size;
+      }
+
+      hypre_ForBoxI(fi, base_points)
+      {
+         compute_box = hypre_BoxArrayBox(base_points, fi);
+
+         hypre_BoxGetStrideSize(compute_box, base_stride, loop_size);
+         hypre_LineSolve(A, x, cdir, fi, loop_size, hypre_BoxIMin(compute_box),
+                         base_stride, (cyc_red_data -> line_work));
+      }
+
+      hypre_IncFLOPCount(cyc_red_data -> solve_flops);
+      hypre_EndTiming(cyc_red_data -> time_index);
+
+      return hypre_error_flag;
+   }
+
    /*--------------------------------------------------
     * Down cycle:
     *
@@ -1227,6 +1304,7 @@ hypre_CyclicReductionDestroy( void *cyc_red_vdata )
       }
       hypre_BoxArrayDestroy(cyc_red_data -> fine_points_l[l]);
       hypre_TFree(cyc_red_data -> data, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(cyc_red_data -> line_work, HYPRE_MEMORY_HOST);
       hypre_TFree(cyc_red_data -> grid_l, HYPRE_MEMORY_HOST);
       hypre_TFree(cyc_red_data -> fine_points_l, HYPRE_MEMORY_HOST);
       hypre_TFree(cyc_red_data -> A_l, HYPRE_MEMORY_HOST);
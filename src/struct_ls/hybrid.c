@@ -459,9 +459,12 @@ hypre_HybridSolveUsePCG( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovCreateVector,
          hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
          hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
-         hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovInnerProd,
+         hypre_StructKrylovInnerProdStart, hypre_StructKrylovInnerProdWait,
+         hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
+         NULL, NULL,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
    krylov_solver = hypre_PCGCreate( pcg_functions );
 
@@ -501,6 +504,7 @@ hypre_HybridSolveUseGMRES( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
+         NULL,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
    krylov_solver = hypre_GMRESCreate( gmres_functions );
 
@@ -532,6 +536,7 @@ hypre_HybridSolveUseBiCGSTAB( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
+         NULL, NULL,
          hypre_StructKrylovCommInfo,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
    krylov_solver = hypre_BiCGSTABCreate( bicgstab_functions );
@@ -0,0 +1,530 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Batched tridiagonal line solves and line relaxation.
+ *
+ * hypre_LineSolve solves the tridiagonal systems given by the couplings of A
+ * along direction 'dir' (stencil entries 0 and -/+1 in dir) on all lines of a
+ * box at once, with the Thomas algorithm interleaved across lines.  The lines
+ * are taken in rows of 'lanes' along a second direction (dimension 0, which
+ * is unit-stride, unless dir is 0), and the recurrence along the lines is the
+ * outer loop, so that the inner loop runs over independent lines and
+ * vectorizes.  Couplings that leave the box are dropped.
+ *
+ * hypre_LineRelax is a weighted line Jacobi smoother built on it,
+ *
+ *    x <- x + w T^{-1} (b - A x),
+ *
+ * where T is the tridiagonal part of A along 'dir' restricted to each box.
+ * Lines that are split across boxes are relaxed segment by segment.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+
+#if defined(HYPRE_USING_OPENMP) && !defined(_MSC_VER)
+#define HYPRE_LINE_SIMD _Pragma("omp simd")
+#else
+#define HYPRE_LINE_SIMD
+#endif
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               dir;       /* line direction */
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Real              weight;
+
+   hypre_StructMatrix     *A;
+   hypre_StructVector     *t;
+   void                   *matvec_data;
+   HYPRE_Real             *work;
+   HYPRE_Int               work_size;
+
+   /* log info (always logged) */
+   HYPRE_Int               num_iterations;
+   HYPRE_Int               time_index;
+
+} hypre_LineRelaxData;
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolveSupported
+ *
+ * Sets 'supported_ptr' to 1 if hypre_LineSolve can be used for A along 'dir'.
+ * This requires a host build, variable coefficients, and stencil entries 0
+ * and -1 in dir (the +1 entry may be implied by symmetric storage).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineSolveSupported( hypre_StructMatrix *A,
+                          HYPRE_Int           dir,
+                          HYPRE_Int          *supported_ptr )
+{
+   hypre_StructStencil *stencil = hypre_StructMatrixStencil(A);
+   hypre_Index          index;
+   HYPRE_Int            supported = 1;
+
+#if defined(HYPRE_USING_GPU)
+   supported = 0;
+#endif
+   if (hypre_StructMatrixConstantCoefficient(A) ||
+       dir < 0 || dir >= hypre_StructMatrixNDim(A))
+   {
+      supported = 0;
+   }
+   else
+   {
+      hypre_SetIndex(index, 0);
+      if (hypre_StructStencilElementRank(stencil, index) < 0)
+      {
+         supported = 0;
+      }
+      hypre_IndexD(index, dir) = -1;
+      if (hypre_StructStencilElementRank(stencil, index) < 0)
+      {
+         supported = 0;
+      }
+      hypre_IndexD(index, dir) = 1;
+      if (!hypre_StructMatrixSymmetric(A) &&
+          hypre_StructStencilElementRank(stencil, index) < 0)
+      {
+         supported = 0;
+      }
+   }
+
+   *supported_ptr = supported;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolveWorkSize
+ *
+ * Returns the size of the work array needed by hypre_LineSolve for x (the
+ * largest data box of x).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineSolveWorkSize( hypre_StructVector *x,
+                         HYPRE_Int          *work_size_ptr )
+{
+   hypre_BoxArray *data_space = hypre_StructVectorDataSpace(x);
+   HYPRE_Int       work_size  = 0;
+   HYPRE_Int       i;
+
+   hypre_ForBoxI(i, data_space)
+   {
+      work_size = hypre_max(work_size,
+                            hypre_BoxVolume(hypre_BoxArrayBox(data_space, i)));
+   }
+
+   *work_size_ptr = work_size;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_LineSolve
+ *
+ * Solves T x = x in place on box i over the points given by (loop_size,
+ * start, stride), where T is the tridiagonal part of A along 'dir' with the
+ * couplings leaving the points dropped.  The stride in dir must be 1.  The
+ * work array holds the eliminated upper coefficients and is indexed like x,
+ * see hypre_LineSolveWorkSize.  A zero pivot gives a zero solution value, as
+ * for the coarsest grid in cyclic reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineSolve( hypre_StructMatrix *A,
+                 hypre_StructVector *x,
+                 HYPRE_Int           dir,
+                 HYPRE_Int           i,
+                 hypre_Index         loop_size,
+                 hypre_IndexRef      start,
+                 hypre_IndexRef      stride,
+                 HYPRE_Real         *work )
+{
+   HYPRE_Int       ndim = hypre_StructMatrixNDim(A);
+
+   hypre_Box      *A_dbox;
+   hypre_Box      *x_dbox;
+   HYPRE_Real     *Ap, *Awp, *Aep;
+   HYPRE_Real     *xp;
+
+   hypre_Index     index;
+   hypre_Index     row_size;
+   HYPRE_Int       lane_dir, n, nl;
+   HYPRE_Int       sA, sx, slA, slx;
+
+   A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+   x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+
+   /* data strides along the lines */
+   hypre_SetIndex(index, 0);
+   hypre_IndexD(index, dir) = 1;
+   sA = hypre_BoxOffsetDistance(A_dbox, index);
+   sx = hypre_BoxOffsetDistance(x_dbox, index);
+
+   hypre_SetIndex(index, 0);
+   Ap  = hypre_StructMatrixExtractPointerByIndex(A, i, index);
+   hypre_IndexD(index, dir) = -1;
+   Awp = hypre_StructMatrixExtractPointerByIndex(A, i, index);
+   hypre_IndexD(index, dir) = 1;
+   Aep = hypre_StructMatrixExtractPointerByIndex(A, i, index);
+   if (Aep == NULL)
+   {
+      /* symmetric storage: the upper coupling is the lower one of the next
+       * point (only used for points whose next point is on the line) */
+      Aep = Awp + sA;
+   }
+   xp = hypre_StructVectorBoxData(x, i);
+
+   /* the lines are taken in rows of nl lanes along lane_dir */
+   n = hypre_IndexD(loop_size, dir);
+   lane_dir = (dir == 0) ? 1 : 0;
+   hypre_CopyIndex(loop_size, row_size);
+   hypre_IndexD(row_size, dir) = 1;
+   if (lane_dir < ndim)
+   {
+      nl = hypre_IndexD(loop_size, lane_dir);
+      hypre_IndexD(row_size, lane_dir) = 1;
+      hypre_SetIndex(index, 0);
+      hypre_IndexD(index, lane_dir) = hypre_IndexD(stride, lane_dir);
+      slA = hypre_BoxOffsetDistance(A_dbox, index);
+      slx = hypre_BoxOffsetDistance(x_dbox, index);
+   }
+   else
+   {
+      nl  = 1;
+      slA = 0;
+      slx = 0;
+   }
+
+   if (n < 1 || nl < 1)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_BoxLoop2Begin(ndim, row_size,
+                       A_dbox, start, stride, Ai,
+                       x_dbox, start, stride, xi);
+   {
+      HYPRE_Int   j, k, Ak, xk, Aj, xj;
+      HYPRE_Real  m;
+
+      /* forward elimination; work holds the inverse pivot, which is then
+       * scaled by the upper coupling (not used at the last point) */
+      for (k = 0; k < n; k++)
+      {
+         Ak = Ai + k*sA;
+         xk = xi + k*sx;
+         if (k == 0)
+         {
+            HYPRE_LINE_SIMD
+            for (j = 0; j < nl; j++)
+            {
+               Aj = Ak + j*slA;
+               xj = xk + j*slx;
+               m = Ap[Aj];
+               m = (m != 0.0) ? 1.0 / m : 0.0;
+               work[xj] = m;
+               xp[xj]  *= m;
+            }
+         }
+         else
+         {
+            HYPRE_LINE_SIMD
+            for (j = 0; j < nl; j++)
+            {
+               Aj = Ak + j*slA;
+               xj = xk + j*slx;
+               m = Ap[Aj] - Awp[Aj] * work[xj - sx];
+               m = (m != 0.0) ? 1.0 / m : 0.0;
+               work[xj] = m;
+               xp[xj] = (xp[xj] - Awp[Aj] * xp[xj - sx]) * m;
+            }
+         }
+         if (k < n - 1)
+         {
+            HYPRE_LINE_SIMD
+            for (j = 0; j < nl; j++)
+            {
+               work[xk + j*slx] *= Aep[Ak + j*slA];
+            }
+         }
+      }
+
+      /* back substitution */
+      for (k = n - 2; k >= 0; k--)
+      {
+         HYPRE_LINE_SIMD
+         for (j = 0; j < nl; j++)
+         {
+            xj = xi + k*sx + j*slx;
+            xp[xj] -= work[xj] * xp[xj + sx];
+         }
+      }
+   }
+   hypre_BoxLoop2End(Ai, xi);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_LineRelaxCreate( MPI_Comm  comm )
+{
+   hypre_LineRelaxData *relax_data;
+
+   relax_data = hypre_CTAlloc(hypre_LineRelaxData, 1, HYPRE_MEMORY_HOST);
+
+   (relax_data -> comm)       = comm;
+   (relax_data -> time_index) = hypre_InitializeTiming("LineRelax");
+
+   /* set defaults */
+   (relax_data -> dir)        = 0;
+   (relax_data -> max_iter)   = 1000;
+   (relax_data -> zero_guess) = 0;
+   (relax_data -> weight)     = 1.0;
+
+   return (void *) relax_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxDestroy( void *relax_vdata )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      hypre_StructMatrixDestroy(relax_data -> A);
+      hypre_StructVectorDestroy(relax_data -> t);
+      if (relax_data -> matvec_data)
+      {
+         hypre_StructMatvecDestroy(relax_data -> matvec_data);
+      }
+      hypre_TFree(relax_data -> work, HYPRE_MEMORY_HOST);
+      hypre_FinalizeTiming(relax_data -> time_index);
+      hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetup( void               *relax_vdata,
+                      hypre_StructMatrix *A,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x           )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+   hypre_StructVector  *t;
+   HYPRE_Int            work_size;
+
+   /*----------------------------------------------------------
+    * Set up the temp vector
+    *----------------------------------------------------------*/
+
+   if ((relax_data -> t) == NULL)
+   {
+      t = hypre_StructVectorCreate(hypre_StructVectorComm(b),
+                                   hypre_StructVectorGrid(b));
+      hypre_StructVectorSetNumGhost(t, hypre_StructVectorNumGhost(b));
+      hypre_StructVectorInitialize(t);
+      hypre_StructVectorAssemble(t);
+      (relax_data -> t) = t;
+   }
+
+   /*----------------------------------------------------------
+    * Set up the residual and the line solves
+    *----------------------------------------------------------*/
+
+   hypre_StructMatrixDestroy(relax_data -> A);
+   (relax_data -> A) = hypre_StructMatrixRef(A);
+
+   if (relax_data -> matvec_data)
+   {
+      hypre_StructMatvecDestroy(relax_data -> matvec_data);
+   }
+   (relax_data -> matvec_data) = hypre_StructMatvecCreate();
+   hypre_StructMatvecSetup((relax_data -> matvec_data), A, x);
+
+   hypre_LineSolveWorkSize((relax_data -> t), &work_size);
+   hypre_TFree(relax_data -> work, HYPRE_MEMORY_HOST);
+   (relax_data -> work)      = hypre_TAlloc(HYPRE_Real, work_size, HYPRE_MEMORY_HOST);
+   (relax_data -> work_size) = work_size;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelax( void               *relax_vdata,
+                 hypre_StructMatrix *A,
+                 hypre_StructVector *b,
+                 hypre_StructVector *x           )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   HYPRE_Int            dir         = (relax_data -> dir);
+   HYPRE_Int            max_iter    = (relax_data -> max_iter);
+   HYPRE_Int            zero_guess  = (relax_data -> zero_guess);
+   HYPRE_Real           weight      = (relax_data -> weight);
+   hypre_StructVector  *t           = (relax_data -> t);
+   void                *matvec_data = (relax_data -> matvec_data);
+   HYPRE_Real          *work        = (relax_data -> work);
+
+   hypre_BoxArray      *boxes;
+   hypre_Box           *box;
+   hypre_Index          loop_size;
+   hypre_Index          stride;
+   HYPRE_Int            iter, i;
+
+   /*----------------------------------------------------------
+    * Initialize some things and deal with special cases
+    *----------------------------------------------------------*/
+
+   hypre_BeginTiming(relax_data -> time_index);
+
+   (relax_data -> num_iterations) = 0;
+
+   if (max_iter == 0)
+   {
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+   hypre_SetIndex(stride, 1);
+
+   /*----------------------------------------------------------
+    * Do the iterations: t = b - A x, solve T t = t, x += w t
+    *----------------------------------------------------------*/
+
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      hypre_StructCopy(b, t);
+      if (zero_guess && iter == 0)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+      else
+      {
+         hypre_StructMatvecCompute(matvec_data, -1.0, A, x, 1.0, t);
+      }
+
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+         hypre_BoxGetSize(box, loop_size);
+         hypre_LineSolve(A, t, dir, i, loop_size, hypre_BoxIMin(box), stride, work);
+      }
+
+      hypre_StructAxpy(weight, t, x);
+   }
+
+   (relax_data -> num_iterations) = iter;
+
+   hypre_IncFLOPCount(8 * max_iter * hypre_StructVectorGlobalSize(x));
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetDir( void      *relax_vdata,
+                       HYPRE_Int  dir         )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> dir) = dir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetWeight( void       *relax_vdata,
+                          HYPRE_Real  weight      )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> weight) = weight;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetMaxIter( void      *relax_vdata,
+                           HYPRE_Int  max_iter    )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetZeroGuess( void      *relax_vdata,
+                             HYPRE_Int  zero_guess  )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetTempVec( void               *relax_vdata,
+                           hypre_StructVector *t           )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   hypre_StructVectorDestroy(relax_data -> t);
+   (relax_data -> t) = hypre_StructVectorRef(t);
+
+   return hypre_error_flag;
+}
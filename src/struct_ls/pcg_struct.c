@@ -138,6 +138,44 @@ hypre_StructKrylovInnerProd( void *x,
                                    (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProdStart( HYPRE_Int           n,
+                                  void              **x,
+                                  void              **y,
+                                  HYPRE_Real         *local,
+                                  HYPRE_Real         *result,
+                                  hypre_MPI_Request  *request )
+{
+   HYPRE_Int k;
+
+   for (k = 0; k < n; k++)
+   {
+      local[k] = hypre_StructInnerProdLocal( (hypre_StructVector *) x[k],
+                                             (hypre_StructVector *) y[k] );
+   }
+
+   hypre_MPI_Iallreduce(local, result, n, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                        hypre_StructVectorComm((hypre_StructVector *) x[0]), request);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovInnerProdWait( hypre_MPI_Request *request )
+{
+   hypre_MPI_Status status;
+
+   hypre_MPI_Wait(request, &status);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
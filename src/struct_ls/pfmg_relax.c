@@ -14,8 +14,13 @@ typedef struct
 {
    void                   *relax_data;
    void                   *rb_relax_data;
+   void                   *tb_relax_data;
+   void                   *line_relax_data;
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
+   HYPRE_Int               tb_num_sweeps;  /* temporal blocking sweeps */
+   HYPRE_Int               line_dir;       /* line relaxation direction */
+   HYPRE_Int               max_iter;
 
 } hypre_PFMGRelaxData;
 
@@ -30,8 +35,13 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    pfmg_relax_data = hypre_CTAlloc(hypre_PFMGRelaxData,  1, HYPRE_MEMORY_HOST);
    (pfmg_relax_data -> relax_data) = hypre_PointRelaxCreate(comm);
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
+   (pfmg_relax_data -> line_relax_data) = hypre_LineRelaxCreate(comm);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
+   (pfmg_relax_data -> tb_relax_data) = NULL;
+   (pfmg_relax_data -> tb_num_sweeps) = 0;
+   (pfmg_relax_data -> line_dir) = 0;
+   (pfmg_relax_data -> max_iter) = 1000;
 
    return (void *) pfmg_relax_data;
 }
@@ -48,6 +58,8 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_TemporalRelaxDestroy(pfmg_relax_data -> tb_relax_data);
+      hypre_LineRelaxDestroy(pfmg_relax_data -> line_relax_data);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -67,6 +79,14 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
    HYPRE_Int    relax_type = (pfmg_relax_data -> relax_type);
    HYPRE_Int    constant_coefficient= hypre_StructMatrixConstantCoefficient(A);
 
+   if ((pfmg_relax_data -> tb_relax_data) &&
+       (pfmg_relax_data -> max_iter) <= (pfmg_relax_data -> tb_num_sweeps))
+   {
+      hypre_TemporalRelax((pfmg_relax_data -> tb_relax_data), A, b, x);
+
+      return hypre_error_flag;
+   }
+
    switch(relax_type)
    {
       case 0:
@@ -85,6 +105,9 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
             hypre_RedBlackGS((pfmg_relax_data -> rb_relax_data), A, b, x);
          }
           
+         break;
+      case 4:
+         hypre_LineRelax((pfmg_relax_data -> line_relax_data), A, b, x);
          break;
    }
 
@@ -103,6 +126,18 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data  = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
    HYPRE_Int            relax_type       = (pfmg_relax_data -> relax_type);
    HYPRE_Real           jacobi_weight    = (pfmg_relax_data -> jacobi_weight); 
+   HYPRE_Int            line_solve;
+
+   /* line relaxation falls back to Jacobi where the line solver does not apply */
+   if (relax_type == 4)
+   {
+      hypre_LineSolveSupported(A, (pfmg_relax_data -> line_dir), &line_solve);
+      if (!line_solve)
+      {
+         hypre_PFMGRelaxSetType(pfmg_relax_vdata, 0);
+         relax_type = 0;
+      }
+   }
 
    switch(relax_type)
    {
@@ -114,13 +149,43 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       case 3:
          hypre_RedBlackGSSetup((pfmg_relax_data -> rb_relax_data), A, b, x);
          break;
+      case 4:
+         hypre_LineRelaxSetDir((pfmg_relax_data -> line_relax_data),
+                               (pfmg_relax_data -> line_dir));
+         hypre_LineRelaxSetWeight((pfmg_relax_data -> line_relax_data), jacobi_weight);
+         hypre_LineRelaxSetup((pfmg_relax_data -> line_relax_data), A, b, x);
+         break;
    }
 
    if (relax_type==1)
    {
       hypre_PointRelaxSetWeight(pfmg_relax_data -> relax_data, jacobi_weight);
    }
-   
+
+   /* set up temporal blocking, which is dropped if A is not supported */
+   hypre_TemporalRelaxDestroy(pfmg_relax_data -> tb_relax_data);
+   (pfmg_relax_data -> tb_relax_data) = NULL;
+   if ((pfmg_relax_data -> tb_num_sweeps) > 0 && relax_type >= 0 && relax_type <= 3)
+   {
+      void      *tb_relax_data;
+      HYPRE_Int  tb_num_sweeps;
+
+      tb_relax_data = hypre_TemporalRelaxCreate(hypre_StructMatrixComm(A));
+      hypre_TemporalRelaxSetType(tb_relax_data, (relax_type < 2) ? 1 : 2);
+      hypre_TemporalRelaxSetWeight(tb_relax_data, (relax_type == 1) ? jacobi_weight : 1.0);
+      hypre_TemporalRelaxSetNumSweeps(tb_relax_data, (pfmg_relax_data -> tb_num_sweeps));
+      hypre_TemporalRelaxSetup(tb_relax_data, A, b, x);
+      hypre_TemporalRelaxGetNumSweeps(tb_relax_data, &tb_num_sweeps);
+      if (tb_num_sweeps > 0)
+      {
+         (pfmg_relax_data -> tb_relax_data) = tb_relax_data;
+      }
+      else
+      {
+         hypre_TemporalRelaxDestroy(tb_relax_data);
+      }
+   }
+
    return hypre_error_flag;
 }
 
@@ -154,6 +219,7 @@ hypre_PFMGRelaxSetType( void  *pfmg_relax_vdata,
 
       case 2: /* Red-Black Gauss-Seidel */
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
+      case 4: /* Line Jacobi */
          break;
    }
 
@@ -187,14 +253,23 @@ hypre_PFMGRelaxSetPreRelax( void  *pfmg_relax_vdata )
    {
       case 1: /* Weighted Jacobi */
       case 0: /* Jacobi */
+      case 4: /* Line Jacobi */
          break;
 
       case 2: /* Red-Black Gauss-Seidel */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         if (pfmg_relax_data -> tb_relax_data)
+         {
+            hypre_TemporalRelaxSetStartRed((pfmg_relax_data -> tb_relax_data));
+         }
          break;
 
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         if (pfmg_relax_data -> tb_relax_data)
+         {
+            hypre_TemporalRelaxSetStartRed((pfmg_relax_data -> tb_relax_data));
+         }
          break;
    }
 
@@ -214,14 +289,23 @@ hypre_PFMGRelaxSetPostRelax( void  *pfmg_relax_vdata )
    {
       case 1: /* Weighted Jacobi */
       case 0: /* Jacobi */
+      case 4: /* Line Jacobi */
          break;
 
       case 2: /* Red-Black Gauss-Seidel */
          hypre_RedBlackGSSetStartBlack((pfmg_relax_data -> rb_relax_data));
+         if (pfmg_relax_data -> tb_relax_data)
+         {
+            hypre_TemporalRelaxSetStartBlack((pfmg_relax_data -> tb_relax_data));
+         }
          break;
 
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
+         if (pfmg_relax_data -> tb_relax_data)
+         {
+            hypre_TemporalRelaxSetStartRed((pfmg_relax_data -> tb_relax_data));
+         }
          break;
    }
 
@@ -254,6 +338,12 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   hypre_LineRelaxSetMaxIter((pfmg_relax_data -> line_relax_data), max_iter);
+   if (pfmg_relax_data -> tb_relax_data)
+   {
+      hypre_TemporalRelaxSetMaxIter((pfmg_relax_data -> tb_relax_data), max_iter);
+   }
+   (pfmg_relax_data -> max_iter) = max_iter;
 
    return hypre_error_flag;
 }
@@ -269,6 +359,11 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   hypre_LineRelaxSetZeroGuess((pfmg_relax_data -> line_relax_data), zero_guess);
+   if (pfmg_relax_data -> tb_relax_data)
+   {
+      hypre_TemporalRelaxSetZeroGuess((pfmg_relax_data -> tb_relax_data), zero_guess);
+   }
 
    return hypre_error_flag;
 }
@@ -283,7 +378,39 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
 
    hypre_PointRelaxSetTempVec((pfmg_relax_data -> relax_data), t);
+   hypre_LineRelaxSetTempVec((pfmg_relax_data -> line_relax_data), t);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Sets the number of sweeps done with a single ghost exchange.  Calls with
+ * more sweeps use the regular smoothers.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetTemporalBlocking( void      *pfmg_relax_vdata,
+                                    HYPRE_Int  num_sweeps )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   (pfmg_relax_data -> tb_num_sweeps) = num_sweeps;
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Sets the line direction for line relaxation (relax_type 4).  PFMG uses the
+ * coarsening direction of the level.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetLineDir( void      *pfmg_relax_vdata,
+                           HYPRE_Int  line_dir )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   (pfmg_relax_data -> line_dir) = line_dir;
+
+   return hypre_error_flag;
+}
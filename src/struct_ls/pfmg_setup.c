@@ -73,6 +73,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight= (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
+   HYPRE_Int             tb_num_sweeps;
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
 
@@ -654,6 +655,14 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_SetDeviceOn();
    }
 #endif
+   /* temporal blocking covers the pre- and post-relaxation sweeps */
+   tb_num_sweeps = 0;
+   if (pfmg_data -> temporal_blocking)
+   {
+      tb_num_sweeps = hypre_max((pfmg_data -> num_pre_relax),
+                                (pfmg_data -> num_post_relax));
+   }
+
    /* set up fine grid relaxation */
    relax_data_l[0] = hypre_PFMGRelaxCreate(comm);
    hypre_PFMGRelaxSetTol(relax_data_l[0], 0.0);
@@ -667,6 +676,11 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
+   if (num_levels > 1)
+   {
+      hypre_PFMGRelaxSetTemporalBlocking(relax_data_l[0], tb_num_sweeps);
+      hypre_PFMGRelaxSetLineDir(relax_data_l[0], cdir_l[0]);
+   }
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
    {
@@ -687,6 +701,11 @@ hypre_PFMGSetup( void               *pfmg_vdata,
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
+            if (l < num_levels - 1)
+            {
+               hypre_PFMGRelaxSetTemporalBlocking(relax_data_l[l], tb_num_sweeps);
+               hypre_PFMGRelaxSetLineDir(relax_data_l[l], cdir_l[l]);
+            }
          }
       }
 
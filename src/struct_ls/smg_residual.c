@@ -22,6 +22,7 @@ typedef struct
    hypre_StructVector  *r;
    hypre_BoxArray      *base_points;
    hypre_ComputePkg    *compute_pkg;
+   HYPRE_Int            kernel;
 
    HYPRE_Int            time_index;
    HYPRE_BigInt         flops;
@@ -94,6 +95,7 @@ hypre_SMGResidualSetup( void               *residual_vdata,
    (residual_data -> r)           = hypre_StructVectorRef(r);
    (residual_data -> base_points) = base_points;
    (residual_data -> compute_pkg) = compute_pkg;
+   (residual_data -> kernel)      = hypre_StructMatvecKernelSelect(A);
 
    /*-----------------------------------------------------
     * Compute flops
@@ -123,6 +125,7 @@ hypre_SMGResidual( void               *residual_vdata,
    hypre_IndexRef          base_stride = (residual_data -> base_stride);
    hypre_BoxArray         *base_points = (residual_data -> base_points);
    hypre_ComputePkg       *compute_pkg = (residual_data -> compute_pkg);
+   HYPRE_Int               kernel      = (residual_data -> kernel);
 
    hypre_CommHandle       *comm_handle;
 
@@ -230,6 +233,15 @@ hypre_SMGResidual( void               *residual_vdata,
 
             start  = hypre_BoxIMin(compute_box);
 
+            /* use the stencil-specialized matvec kernel if there is one */
+            if (kernel)
+            {
+               hypre_BoxGetStrideSize(compute_box, base_stride, loop_size);
+               hypre_StructMatvecKernelApply(kernel, -1.0, A, x, r, i,
+                                             loop_size, start, base_stride);
+               continue;
+            }
+
             for (si = 0; si < stencil_size; si++)
             {
                Ap = hypre_StructMatrixBoxData(A, i, si);
@@ -0,0 +1,787 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Temporally blocked weighted Jacobi and red-black Gauss-Seidel relaxation.
+ *
+ * Each local box keeps a private copy of A, x and b on the box grown by
+ * 'depth' ghost layers, where depth is the number of stages (Jacobi sweeps or
+ * red-black half sweeps) done per call.  The ghost layers are filled with a
+ * single exchange, after which stage h updates the box grown by (s-1-h), so
+ * that the last stage ends on the box itself and the stages need no further
+ * communication.
+ *
+ * The stages are run as a skewed wavefront: the box is cut into tiles of
+ * 'tile_size' planes along dimension ndim-2, and each tile sweeps dimension
+ * ndim-1 front by front, advancing all stages in each front.  A point at
+ * stage h is assigned to tile (i_t + h)/tile_size and front i_w + h, which
+ * respects all dependencies of a stencil of radius one and keeps the working
+ * set of each tile in cache.  With OpenMP, the tiles are pipelined across
+ * threads.
+ *
+ * This routine assumes a variable coefficient matrix with a stencil of
+ * radius one, and a 3-pt (1D), 5-pt (2D), or 7-pt (3D) stencil for
+ * red-black.  The private copy of A doubles the matrix storage.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+
+/* working set targeted by one tile (in bytes) */
+#define hypre_TEMPORAL_RELAX_CACHE 1048576
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               relax_type;    /* 1: weighted Jacobi, 2: red-black GS */
+   HYPRE_Real              weight;
+   HYPRE_Int               num_sweeps;    /* max sweeps per call (0: unusable) */
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Int               rb_start;
+
+   HYPRE_Int               ndim;
+   HYPRE_Int               depth;         /* number of ghost layers */
+   HYPRE_Int               stencil_size;
+   HYPRE_Int               diag_rank;
+   hypre_Index            *stencil_shape;
+   hypre_BoxArray         *data_space;    /* grid boxes grown by depth */
+   HYPRE_Int              *data_offsets;  /* running sum of box volumes */
+   HYPRE_Int              *tile_sizes;
+   HYPRE_Real             *A_data;        /* stencil_size values per point */
+   HYPRE_Real             *xb_data;       /* x and b values per point */
+   HYPRE_Real             *t_data;        /* Jacobi work copy of x */
+   HYPRE_Int              *progress;      /* fronts completed per tile */
+   hypre_CommPkg          *comm_pkg;
+
+   /* log info (always logged) */
+   HYPRE_Int               time_index;
+
+} hypre_TemporalRelaxData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_TemporalRelaxCreate( MPI_Comm  comm )
+{
+   hypre_TemporalRelaxData *relax_data;
+
+   relax_data = hypre_CTAlloc(hypre_TemporalRelaxData, 1, HYPRE_MEMORY_HOST);
+
+   (relax_data -> comm)       = comm;
+   (relax_data -> time_index) = hypre_InitializeTiming("TemporalRelax");
+
+   /* set defaults */
+   (relax_data -> relax_type) = 1;
+   (relax_data -> weight)     = 1.0;
+   (relax_data -> num_sweeps) = 1;
+   (relax_data -> max_iter)   = 1;
+   (relax_data -> zero_guess) = 0;
+   (relax_data -> rb_start)   = 1;
+
+   return (void *) relax_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_TemporalRelaxFreeData( hypre_TemporalRelaxData *relax_data )
+{
+   hypre_TFree(relax_data -> stencil_shape, HYPRE_MEMORY_HOST);
+   hypre_BoxArrayDestroy(relax_data -> data_space);
+   hypre_TFree(relax_data -> data_offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> tile_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> A_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> xb_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> t_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> progress, HYPRE_MEMORY_HOST);
+   hypre_CommPkgDestroy(relax_data -> comm_pkg);
+
+   (relax_data -> data_space) = NULL;
+   (relax_data -> comm_pkg)   = NULL;
+   (relax_data -> depth)      = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxDestroy( void *relax_vdata )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      hypre_TemporalRelaxFreeData(relax_data);
+      hypre_FinalizeTiming(relax_data -> time_index);
+      hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns the extents of extended box i padded to three dimensions.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_TemporalRelaxBoxSizes( hypre_TemporalRelaxData *relax_data,
+                             HYPRE_Int                i,
+                             HYPRE_Int               *n )
+{
+   hypre_Box  *ext_box = hypre_BoxArrayBox(relax_data -> data_space, i);
+   HYPRE_Int   d;
+
+   for (d = 0; d < 3; d++)
+   {
+      n[d] = (d < (relax_data -> ndim)) ? hypre_BoxSizeD(ext_box, d) : 1;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Sets num_sweeps to zero if the matrix or grid is not supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetup( void               *relax_vdata,
+                          hypre_StructMatrix *A,
+                          hypre_StructVector *b,
+                          hypre_StructVector *x )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   HYPRE_Int              ndim      = hypre_StructMatrixNDim(A);
+   hypre_StructGrid      *grid      = hypre_StructMatrixGrid(A);
+   hypre_BoxArray        *boxes     = hypre_StructGridBoxes(grid);
+   hypre_StructStencil   *stencil   = hypre_StructMatrixStencil(A);
+   hypre_Index           *shape     = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int              num_sweeps = (relax_data -> num_sweeps);
+   HYPRE_Int              relax_type = (relax_data -> relax_type);
+
+   hypre_CommInfo        *comm_info;
+   hypre_CommPkg         *A_comm_pkg;
+   hypre_CommHandle      *comm_handle;
+   hypre_BoxArray        *data_space;
+   hypre_Box             *box;
+   hypre_Box             *ext_box;
+   hypre_Box             *A_dbox;
+   hypre_Index            diag_index, loop_size, unit_stride;
+   hypre_IndexRef         start;
+
+   HYPRE_Int              num_ghost[2*HYPRE_MAXDIM];
+   HYPRE_Int              n[3];
+   HYPRE_Int              depth, diag_rank, supported;
+   HYPRE_Int              num_boxes, vol, inner, planes, tile_size, num_tiles;
+   HYPRE_Int              max_tiles, offset, i, j, d, dist;
+
+   HYPRE_Real            *Ap, *A_ext;
+
+   hypre_TemporalRelaxFreeData(relax_data);
+
+   depth = (relax_type == 1) ? num_sweeps : 2*num_sweeps;
+
+   hypre_SetIndex(diag_index, 0);
+   diag_rank = hypre_StructStencilElementRank(stencil, diag_index);
+
+   /*----------------------------------------------------------
+    * Check that temporal blocking applies
+    *----------------------------------------------------------*/
+
+   supported = (depth > 0 && diag_rank >= 0 && stencil_size <= 27);
+#if defined(HYPRE_USING_GPU)
+   supported = 0;
+#endif
+   if (hypre_StructMatrixConstantCoefficient(A))
+   {
+      supported = 0;
+   }
+   for (j = 0; j < stencil_size; j++)
+   {
+      dist = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_abs(hypre_IndexD(shape[j], d)) > 1)
+         {
+            supported = 0;
+         }
+         dist += hypre_abs(hypre_IndexD(shape[j], d));
+      }
+      if (relax_type != 1 && dist > 1)
+      {
+         supported = 0;
+      }
+   }
+   for (d = 0; d < ndim; d++)
+   {
+      /* neighbors are only known within the grid's max distance, and the
+       * ghost layer must not wrap around a periodic dimension twice */
+      if (hypre_IndexD(hypre_StructGridMaxDistance(grid), d) < depth)
+      {
+         supported = 0;
+      }
+      if (hypre_IndexD(hypre_StructGridPeriodic(grid), d) &&
+          hypre_IndexD(hypre_StructGridPeriodic(grid), d) < depth)
+      {
+         supported = 0;
+      }
+      /* red-black coloring is not consistent across an odd period */
+      if (relax_type != 1 && hypre_IndexD(hypre_StructGridPeriodic(grid), d) % 2)
+      {
+         supported = 0;
+      }
+   }
+
+   if (!supported)
+   {
+      (relax_data -> num_sweeps) = 0;
+      return hypre_error_flag;
+   }
+
+   /*----------------------------------------------------------
+    * Set up the extended boxes and the tiles
+    *----------------------------------------------------------*/
+
+   num_boxes  = hypre_BoxArraySize(boxes);
+   data_space = hypre_BoxArrayCreate(num_boxes, ndim);
+
+   (relax_data -> ndim)         = ndim;
+   (relax_data -> depth)        = depth;
+   (relax_data -> stencil_size) = stencil_size;
+   (relax_data -> diag_rank)    = diag_rank;
+   (relax_data -> data_space)   = data_space;
+   (relax_data -> stencil_shape) = hypre_CTAlloc(hypre_Index, stencil_size, HYPRE_MEMORY_HOST);
+   (relax_data -> data_offsets) = hypre_CTAlloc(HYPRE_Int, num_boxes + 1, HYPRE_MEMORY_HOST);
+   (relax_data -> tile_sizes)   = hypre_CTAlloc(HYPRE_Int, num_boxes, HYPRE_MEMORY_HOST);
+   for (j = 0; j < stencil_size; j++)
+   {
+      hypre_SetIndex(relax_data -> stencil_shape[j], 0);
+      for (d = 0; d < ndim; d++)
+      {
+         hypre_IndexD(relax_data -> stencil_shape[j], d) = hypre_IndexD(shape[j], d);
+      }
+   }
+
+   max_tiles = 1;
+   hypre_ForBoxI(i, boxes)
+   {
+      ext_box = hypre_BoxArrayBox(data_space, i);
+      hypre_CopyBox(hypre_BoxArrayBox(boxes, i), ext_box);
+      hypre_BoxGrowByValue(ext_box, depth);
+      (relax_data -> data_offsets[i+1]) =
+         (relax_data -> data_offsets[i]) + hypre_BoxVolume(ext_box);
+
+      /* cross section of a tile plane, and planes live in one front */
+      hypre_TemporalRelaxBoxSizes(relax_data, i, n);
+      inner  = (ndim > 2) ? n[0] : 1;
+      planes = (ndim > 1) ? depth + 2 : 1;
+      tile_size = hypre_TEMPORAL_RELAX_CACHE /
+         ((stencil_size + 3) * (HYPRE_Int) sizeof(HYPRE_Real) * inner * planes) - depth;
+      tile_size = hypre_max(tile_size, 2);
+      (relax_data -> tile_sizes[i]) = tile_size;
+
+      num_tiles = (ndim > 1) ? (n[ndim-2] + depth - 2) / tile_size + 1 : 1;
+      max_tiles = hypre_max(max_tiles, num_tiles);
+   }
+   vol = (relax_data -> data_offsets[num_boxes]);
+
+   (relax_data -> progress) = hypre_CTAlloc(HYPRE_Int, max_tiles, HYPRE_MEMORY_HOST);
+   (relax_data -> xb_data)  = hypre_CTAlloc(HYPRE_Real, 2*vol, HYPRE_MEMORY_HOST);
+   if (relax_type == 1)
+   {
+      (relax_data -> t_data) = hypre_CTAlloc(HYPRE_Real, vol, HYPRE_MEMORY_HOST);
+   }
+
+   /*----------------------------------------------------------
+    * Copy A into the extended boxes and fill its ghost layers.
+    * Points outside the grid get a unit diagonal and no
+    * off-diagonals, so that relaxation keeps them at zero.
+    *----------------------------------------------------------*/
+
+   (relax_data -> A_data) = hypre_CTAlloc(HYPRE_Real, stencil_size*vol, HYPRE_MEMORY_HOST);
+
+   hypre_SetIndex(unit_stride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box     = hypre_BoxArrayBox(boxes, i);
+      ext_box = hypre_BoxArrayBox(data_space, i);
+      A_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      offset  = (relax_data -> data_offsets[i]);
+      vol     = hypre_BoxVolume(ext_box);
+      start   = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      A_ext = (relax_data -> A_data) + stencil_size*offset;
+      for (j = 0; j < vol; j++)
+      {
+         A_ext[diag_rank*vol + j] = 1.0;
+      }
+
+      for (j = 0; j < stencil_size; j++)
+      {
+         Ap    = hypre_StructMatrixBoxData(A, i, j);
+         A_ext = (relax_data -> A_data) + stencil_size*offset + j*vol;
+
+         hypre_BoxLoop2Begin(ndim, loop_size,
+                             A_dbox, start, unit_stride, Ai,
+                             ext_box, start, unit_stride, ei);
+         {
+            A_ext[ei] = Ap[Ai];
+         }
+         hypre_BoxLoop2End(Ai, ei);
+      }
+   }
+
+   for (d = 0; d < 2*HYPRE_MAXDIM; d++)
+   {
+      num_ghost[d] = (d < 2*ndim) ? depth : 0;
+   }
+   hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+
+   hypre_CommPkgCreate(comm_info, data_space, data_space, stencil_size, NULL, 0,
+                       hypre_StructMatrixComm(A), &A_comm_pkg);
+   hypre_InitializeCommunication(A_comm_pkg, relax_data -> A_data,
+                                 relax_data -> A_data, 0, 0, &comm_handle);
+   hypre_FinalizeCommunication(comm_handle);
+   hypre_CommPkgDestroy(A_comm_pkg);
+
+   /* x and b are exchanged together on every call */
+   hypre_CommPkgCreate(comm_info, data_space, data_space, 2, NULL, 0,
+                       hypre_StructMatrixComm(A), &(relax_data -> comm_pkg));
+   hypre_CommInfoDestroy(comm_info);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Runs all stages of one (tile, front) step on extended box i.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_TemporalRelaxStep( hypre_TemporalRelaxData *relax_data,
+                         HYPRE_Int                i,
+                         HYPRE_Int                num_stages,
+                         HYPRE_Int                tile,
+                         HYPRE_Int                front )
+{
+   HYPRE_Int     ndim         = (relax_data -> ndim);
+   HYPRE_Int     depth        = (relax_data -> depth);
+   HYPRE_Int     stencil_size = (relax_data -> stencil_size);
+   HYPRE_Int     diag_rank    = (relax_data -> diag_rank);
+   HYPRE_Int     relax_type   = (relax_data -> relax_type);
+   HYPRE_Int     rb_start     = (relax_data -> rb_start);
+   HYPRE_Int     tile_size    = (relax_data -> tile_sizes[i]);
+   HYPRE_Int     offset       = (relax_data -> data_offsets[i]);
+   HYPRE_Real    weight       = (relax_data -> weight);
+   HYPRE_Real    weightc      = 1.0 - weight;
+   hypre_Index  *shape        = (relax_data -> stencil_shape);
+   hypre_Box    *ext_box      = hypre_BoxArrayBox(relax_data -> data_space, i);
+
+   HYPRE_Int     n[3], lo[3], hi[3], soff[27];
+   HYPRE_Int     vol, parity, h, m, d, j, k, ix, iy, iz, xstart, xstep;
+   HYPRE_Real   *Ap, *bp, *xr, *xw;
+   HYPRE_Real    res;
+
+   hypre_TemporalRelaxBoxSizes(relax_data, i, n);
+   vol = n[0]*n[1]*n[2];
+
+   Ap = (relax_data -> A_data) + stencil_size*offset;
+   xr = (relax_data -> xb_data) + 2*offset;
+   bp = xr + vol;
+
+   for (j = 0; j < stencil_size; j++)
+   {
+      soff[j] = hypre_IndexD(shape[j], 0) +
+                n[0]*(hypre_IndexD(shape[j], 1) + n[1]*hypre_IndexD(shape[j], 2));
+   }
+
+   /* parity of the global index sum at the first extended point */
+   parity = 0;
+   for (d = 0; d < ndim; d++)
+   {
+      parity += hypre_BoxIMinD(ext_box, d);
+   }
+   parity = hypre_abs(parity) % 2;
+
+   for (h = 0; h < num_stages; h++)
+   {
+      /* stage h updates the box grown by m */
+      m = num_stages - 1 - h;
+      for (d = 0; d < 3; d++)
+      {
+         lo[d] = (d < ndim) ? depth - m : 0;
+         hi[d] = (d < ndim) ? n[d] - 1 - depth + m : 0;
+      }
+      if (ndim > 1)
+      {
+         lo[ndim-2] = hypre_max(lo[ndim-2], tile*tile_size - h);
+         hi[ndim-2] = hypre_min(hi[ndim-2], (tile + 1)*tile_size - h - 1);
+      }
+      lo[ndim-1] = hypre_max(lo[ndim-1], front - h);
+      hi[ndim-1] = hypre_min(hi[ndim-1], front - h);
+
+      if (relax_type == 1)
+      {
+         xr = (relax_data -> xb_data) + 2*offset;
+         xw = (relax_data -> t_data) + offset;
+         if (h % 2)
+         {
+            xw = xr;
+            xr = (relax_data -> t_data) + offset;
+         }
+      }
+      else
+      {
+         xw = xr;
+      }
+
+      for (iz = lo[2]; iz <= hi[2]; iz++)
+      {
+         for (iy = lo[1]; iy <= hi[1]; iy++)
+         {
+            xstart = lo[0];
+            xstep  = 1;
+            if (relax_type != 1)
+            {
+               /* relax points with (index sum + rb) even */
+               xstart += (lo[0] + iy + iz + parity + rb_start + h) % 2;
+               xstep   = 2;
+            }
+            for (ix = xstart; ix <= hi[0]; ix += xstep)
+            {
+               k = ix + n[0]*(iy + n[1]*iz);
+               res = bp[k];
+               for (j = 0; j < stencil_size; j++)
+               {
+                  if (j != diag_rank)
+                  {
+                     res -= Ap[j*vol + k] * xr[k + soff[j]];
+                  }
+               }
+               res /= Ap[diag_rank*vol + k];
+               if (relax_type == 1 && weight != 1.0)
+               {
+                  res = weight*res + weightc*xr[k];
+               }
+               xw[k] = res;
+            }
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Does max_iter sweeps with one ghost exchange.  Requires max_iter to be no
+ * larger than the number of sweeps the data was set up for.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelax( void               *relax_vdata,
+                     hypre_StructMatrix *A,
+                     hypre_StructVector *b,
+                     hypre_StructVector *x )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   HYPRE_Int              ndim       = hypre_StructVectorNDim(x);
+   HYPRE_Int              max_iter   = (relax_data -> max_iter);
+   HYPRE_Int              zero_guess = (relax_data -> zero_guess);
+   HYPRE_Int              relax_type = (relax_data -> relax_type);
+   hypre_BoxArray        *boxes      = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+   hypre_BoxArray        *data_space = (relax_data -> data_space);
+   HYPRE_Int             *progress   = (relax_data -> progress);
+
+   hypre_CommHandle      *comm_handle;
+   hypre_Box             *box;
+   hypre_Box             *ext_box;
+   hypre_Box             *x_dbox;
+   hypre_Box             *b_dbox;
+   hypre_Index            loop_size, unit_stride;
+   hypre_IndexRef         start;
+
+   HYPRE_Int              n[3];
+   HYPRE_Int              num_stages, num_tiles, num_fronts, tile_size;
+   HYPRE_Int              vol, offset, i, j;
+
+   HYPRE_Real            *xp, *bp, *x_ext, *b_ext;
+
+   if (max_iter > (relax_data -> num_sweeps))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Too many sweeps for temporal blocking setup!");
+      return hypre_error_flag;
+   }
+
+   hypre_BeginTiming(relax_data -> time_index);
+
+   /* if max_iter is zero, return */
+   if (max_iter == 0)
+   {
+      /* if using a zero initial guess, return zero */
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   num_stages = (relax_type == 1) ? max_iter : 2*max_iter;
+
+   /*----------------------------------------------------------
+    * Copy x and b into the extended boxes and exchange ghosts
+    *----------------------------------------------------------*/
+
+   hypre_SetIndex(unit_stride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box     = hypre_BoxArrayBox(boxes, i);
+      ext_box = hypre_BoxArrayBox(data_space, i);
+      x_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      b_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      offset  = (relax_data -> data_offsets[i]);
+      vol     = hypre_BoxVolume(ext_box);
+      start   = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      xp    = hypre_StructVectorBoxData(x, i);
+      bp    = hypre_StructVectorBoxData(b, i);
+      x_ext = (relax_data -> xb_data) + 2*offset;
+      b_ext = x_ext + vol;
+
+      hypre_BoxLoop3Begin(ndim, loop_size,
+                          x_dbox, start, unit_stride, xi,
+                          b_dbox, start, unit_stride, bi,
+                          ext_box, start, unit_stride, ei);
+      {
+         x_ext[ei] = xp[xi];
+         b_ext[ei] = bp[bi];
+      }
+      hypre_BoxLoop3End(xi, bi, ei);
+   }
+
+   hypre_InitializeCommunication(relax_data -> comm_pkg, relax_data -> xb_data,
+                                 relax_data -> xb_data, 0, 0, &comm_handle);
+   hypre_FinalizeCommunication(comm_handle);
+
+   /*----------------------------------------------------------
+    * Relax each box tile by tile
+    *----------------------------------------------------------*/
+
+   hypre_ForBoxI(i, boxes)
+   {
+      ext_box   = hypre_BoxArrayBox(data_space, i);
+      offset    = (relax_data -> data_offsets[i]);
+      vol       = hypre_BoxVolume(ext_box);
+      tile_size = (relax_data -> tile_sizes[i]);
+      hypre_TemporalRelaxBoxSizes(relax_data, i, n);
+
+      if (zero_guess)
+      {
+         x_ext = (relax_data -> xb_data) + 2*offset;
+         for (j = 0; j < vol; j++)
+         {
+            x_ext[j] = 0.0;
+         }
+      }
+
+      num_tiles  = (ndim > 1) ? (n[ndim-2] + num_stages - 2) / tile_size + 1 : 1;
+      num_fronts = n[ndim-1] + num_stages - 1;
+      for (j = 0; j < num_tiles; j++)
+      {
+         progress[j] = 0;
+      }
+
+      /* tile t may run front f once tile t-1 has completed it */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(j)
+#endif
+      {
+         HYPRE_Int  num_threads = hypre_NumActiveThreads();
+         HYPRE_Int  my_thread   = hypre_GetThreadNum();
+         HYPRE_Int  tile, front;
+
+         for (tile = my_thread; tile < num_tiles; tile += num_threads)
+         {
+            for (front = 0; front < num_fronts; front++)
+            {
+#ifdef HYPRE_USING_OPENMP
+               if (tile > 0)
+               {
+                  do
+                  {
+#pragma omp atomic read
+                     j = progress[tile-1];
+                  }
+                  while (j <= front);
+#pragma omp flush
+               }
+#endif
+               hypre_TemporalRelaxStep(relax_data, i, num_stages, tile, front);
+#ifdef HYPRE_USING_OPENMP
+#pragma omp flush
+#pragma omp atomic write
+               progress[tile] = front + 1;
+#endif
+            }
+         }
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Copy the result back into x
+    *----------------------------------------------------------*/
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box     = hypre_BoxArrayBox(boxes, i);
+      ext_box = hypre_BoxArrayBox(data_space, i);
+      x_dbox  = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      offset  = (relax_data -> data_offsets[i]);
+      start   = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      xp    = hypre_StructVectorBoxData(x, i);
+      x_ext = (relax_data -> xb_data) + 2*offset;
+      if (relax_type == 1 && (num_stages % 2))
+      {
+         x_ext = (relax_data -> t_data) + offset;
+      }
+
+      hypre_BoxLoop2Begin(ndim, loop_size,
+                          x_dbox, start, unit_stride, xi,
+                          ext_box, start, unit_stride, ei);
+      {
+         xp[xi] = x_ext[ei];
+      }
+      hypre_BoxLoop2End(xi, ei);
+   }
+
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetType( void      *relax_vdata,
+                            HYPRE_Int  relax_type )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> relax_type) = relax_type;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetWeight( void       *relax_vdata,
+                              HYPRE_Real  weight )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> weight) = weight;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetNumSweeps( void      *relax_vdata,
+                                 HYPRE_Int  num_sweeps )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> num_sweeps) = num_sweeps;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxGetNumSweeps( void      *relax_vdata,
+                                 HYPRE_Int *num_sweeps )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   *num_sweeps = (relax_data -> num_sweeps);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetMaxIter( void      *relax_vdata,
+                               HYPRE_Int  max_iter )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetZeroGuess( void      *relax_vdata,
+                                 HYPRE_Int  zero_guess )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetStartRed( void *relax_vdata )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> rb_start) = 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_TemporalRelaxSetStartBlack( void *relax_vdata )
+{
+   hypre_TemporalRelaxData *relax_data = (hypre_TemporalRelaxData *)relax_vdata;
+
+   (relax_data -> rb_start) = 0;
+
+   return hypre_error_flag;
+}
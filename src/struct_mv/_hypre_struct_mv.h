@@ -1215,6 +1215,24 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* persistent exchange, set up on the first communication after the first
+    * one (buffers have no prefix then and their layout no longer changes) */
+   HYPRE_Int          persistent;          /* persistent requests are set up */
+   HYPRE_Int          persistent_tag;
+   HYPRE_Int          persistent_active;   /* an exchange is in progress */
+   hypre_MPI_Request *persistent_requests; /* recvs, then sends */
+   hypre_MPI_Status  *persistent_status;
+   HYPRE_Complex     *persistent_send_buffer;
+   HYPRE_Complex     *persistent_recv_buffer;
+   HYPRE_Int          num_send_indices;    /* total message sizes (in doubles) */
+   HYPRE_Int          num_recv_indices;
+   HYPRE_Int         *send_indices;        /* send data offset for each send
+                                            * buffer value (-1 = zero) */
+   HYPRE_Int         *recv_indices;        /* recv data offset for each recv
+                                            * buffer value (-1 = unused) */
+#endif
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -1241,6 +1259,10 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   HYPRE_Int          persistent; /* uses the persistent exchange of comm_pkg */
+#endif
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1334,6 +1356,18 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistent(comm_pkg)                 (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentActive(comm_pkg)           (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentRequests(comm_pkg)         (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)           (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffer(comm_pkg)       (comm_pkg -> persistent_send_buffer)
+#define hypre_CommPkgPersistentRecvBuffer(comm_pkg)       (comm_pkg -> persistent_recv_buffer)
+#define hypre_CommPkgNumSendIndices(comm_pkg)             (comm_pkg -> num_send_indices)
+#define hypre_CommPkgNumRecvIndices(comm_pkg)             (comm_pkg -> num_recv_indices)
+#define hypre_CommPkgSendIndices(comm_pkg)                (comm_pkg -> send_indices)
+#define hypre_CommPkgRecvIndices(comm_pkg)                (comm_pkg -> recv_indices)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1349,6 +1383,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_device)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_device)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 
 #endif
 /******************************************************************************
@@ -1657,6 +1692,7 @@ HYPRE_Int hypre_IndexInBox ( hypre_Index index , hypre_Box *box );
 HYPRE_Int hypre_BoxGetSize ( hypre_Box *box , hypre_Index size );
 HYPRE_Int hypre_BoxGetStrideSize ( hypre_Box *box , hypre_Index stride , hypre_Index size );
 HYPRE_Int hypre_BoxGetStrideVolume ( hypre_Box *box , hypre_Index stride , HYPRE_Int *volume_ptr );
+HYPRE_Int hypre_BoxLoopGetTileSize ( HYPRE_Int ndim , HYPRE_Int *loop_size , HYPRE_Int *tile );
 HYPRE_Int hypre_BoxIndexRank( hypre_Box *box , hypre_Index index );
 HYPRE_Int hypre_BoxRankIndex( hypre_Box *box , HYPRE_Int rank , hypre_Index index );
 HYPRE_Int hypre_BoxOffsetDistance( hypre_Box *box , hypre_Index index );
@@ -1797,6 +1833,11 @@ HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type , HYPRE_Int *boxn
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_Box *data_box , HYPRE_Int data_box_offset , hypre_CommEntryType *comm_entry );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action , HYPRE_Int tag , hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
+#ifdef HYPRE_USING_PERSISTENT_COMM
+HYPRE_Int hypre_CommPkgSetupPersistent ( hypre_CommPkg *comm_pkg , HYPRE_Int tag );
+HYPRE_Int hypre_InitializePersistentCommunication ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action , HYPRE_Int tag , hypre_CommHandle **comm_handle_ptr );
+HYPRE_Int hypre_FinalizePersistentCommunication ( hypre_CommHandle *comm_handle );
+#endif
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action );
 HYPRE_Int hypre_CommPkgDestroy ( hypre_CommPkg *comm_pkg );
 
@@ -1826,6 +1867,7 @@ HYPRE_Int hypre_StructGridGetMaxBoxSize(hypre_StructGrid *grid);
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid, HYPRE_MemoryLocation data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x , hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x , hypre_StructVector *y );
 
 /* struct_io.c */
@@ -1864,8 +1906,10 @@ hypre_StructMatrix *hypre_StructMatrixCreateMask ( hypre_StructMatrix *matrix ,
 /* struct_matvec.c */
 void *hypre_StructMatvecCreate ( void );
 HYPRE_Int hypre_StructMatvecSetup ( void *matvec_vdata , hypre_StructMatrix *A , hypre_StructVector *x );
+HYPRE_Int hypre_StructMatvecKernelSelect ( hypre_StructMatrix *A );
+HYPRE_Int hypre_StructMatvecKernelApply ( HYPRE_Int kernel , HYPRE_Complex coeff , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , HYPRE_Int i , hypre_Index loop_size , hypre_IndexRef start , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata , HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y );
-HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride , HYPRE_Int kernel );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
@@ -2527,14 +2571,99 @@ typedef struct hypre_Boxloop_struct
    HYPRE_Int bsize0,bsize1,bsize2;
 } hypre_Boxloop;
 
+/*--------------------------------------------------------------------------
+ * Tiled iteration.  The loop is cut into tiles (bricks) over dimensions
+ * 1..ndim-1; each tile covers whole rows in dimension 0, so the innermost
+ * loop stays unit-stride.  The tiles are the blocks handed out to the threads
+ * in a fixed order, so loops over the same box touch the same data from the
+ * same thread (consistent with first-touch placement).  See
+ * hypre_BoxLoopGetTileSize() for how the tile extents are chosen.
+ *--------------------------------------------------------------------------*/
+
+#define zypre_TileLoopDeclare() \
+HYPRE_Int  hypre__block, hypre__num_blocks;\
+HYPRE_Int  hypre__d, hypre__ndim;\
+HYPRE_Int  hypre__I, hypre__J, hypre__IN, hypre__JN;\
+HYPRE_Int  hypre__i[HYPRE_MAXDIM+1], hypre__n[HYPRE_MAXDIM+1];\
+HYPRE_Int  hypre__tile[HYPRE_MAXDIM+1], hypre__ntiles[HYPRE_MAXDIM+1]
+
+#define zypre_TileLoopInit(ndim, loop_size) \
+hypre__ndim = ndim;\
+for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__n[hypre__d] = loop_size[hypre__d];\
+}\
+hypre__n[hypre__ndim] = 2;\
+hypre_BoxLoopGetTileSize(hypre__ndim, hypre__n, hypre__tile);\
+hypre__num_blocks = 1;\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__ntiles[hypre__d] =\
+      (hypre__n[hypre__d] + hypre__tile[hypre__d] - 1) / hypre__tile[hypre__d];\
+   hypre__num_blocks *= hypre__ntiles[hypre__d];\
+}
+
+/* per-tile bounds, declared inside the block loop so they are private */
+#define zypre_TileLoopDeclareBlock() \
+HYPRE_Int  hypre__lo[HYPRE_MAXDIM+1], hypre__hi[HYPRE_MAXDIM+1]
+
+#define zypre_TileLoopDeclareK(k) \
+HYPRE_Int  hypre__tkinc##k[HYPRE_MAXDIM+1]
+
+#define zypre_TileLoopSet() \
+hypre__IN = hypre__n[0];\
+hypre__JN = 1;\
+hypre__J  = hypre__block;\
+hypre__lo[0] = 0;\
+hypre__hi[0] = hypre__n[0];\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__I = hypre__J % hypre__ntiles[hypre__d];\
+   hypre__J /= hypre__ntiles[hypre__d];\
+   hypre__lo[hypre__d] = hypre__I * hypre__tile[hypre__d];\
+   hypre__hi[hypre__d] = hypre_min(hypre__lo[hypre__d] + hypre__tile[hypre__d],\
+                                   hypre__n[hypre__d]);\
+   hypre__i[hypre__d] = hypre__lo[hypre__d];\
+   hypre__JN *= hypre__hi[hypre__d] - hypre__lo[hypre__d];\
+}\
+hypre__i[hypre__ndim]  = 0;\
+hypre__hi[hypre__ndim] = 2
+
+#define zypre_TileLoopSetK(k, ik) \
+zypre_BoxLoopSetK(k, ik);\
+hypre__tkinc##k[0] = 0;\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__tkinc##k[hypre__d] = hypre__tkinc##k[hypre__d-1] +\
+      hypre__sk##k[hypre__d] -\
+      (hypre__hi[hypre__d-1] - hypre__lo[hypre__d-1])*hypre__sk##k[hypre__d-1];\
+}\
+hypre__tkinc##k[hypre__ndim] = 0
+
+#define zypre_TileLoopInc1() \
+hypre__d = 1;\
+while ((hypre__i[hypre__d]+2) > hypre__hi[hypre__d])\
+{\
+   hypre__d++;\
+}
+
+#define zypre_TileLoopInc2() \
+hypre__i[hypre__d]++;\
+while (hypre__d > 1)\
+{\
+   hypre__d--;\
+   hypre__i[hypre__d] = hypre__lo[hypre__d];\
+}
+
 #define zypre_newBoxLoop0Begin(ndim, loop_size)                               \
 {                                                                             \
-   zypre_BoxLoopDeclare();                                                    \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
-      zypre_BoxLoopSet();                                                     \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopSet();                                                    \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -2542,8 +2671,8 @@ typedef struct hypre_Boxloop_struct
 
 #define zypre_newBoxLoop0End()                                                \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -2552,16 +2681,18 @@ typedef struct hypre_Boxloop_struct
                                dbox1, start1, stride1, i1)                    \
 {                                                                             \
    HYPRE_Int i1;                                                              \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1;                                                           \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -2570,9 +2701,9 @@ typedef struct hypre_Boxloop_struct
 #define zypre_newBoxLoop1End(i1)                                              \
             i1 += hypre__i0inc1;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         i1 += hypre__tkinc1[hypre__d];                                       \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -2583,19 +2714,22 @@ typedef struct hypre_Boxloop_struct
                                dbox2, start2, stride2, i2)                    \
 {                                                                             \
    HYPRE_Int i1, i2;                                                          \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1, i2;                                                       \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopDeclareK(2);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
+      zypre_TileLoopSetK(2, i2);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -2605,10 +2739,10 @@ typedef struct hypre_Boxloop_struct
             i1 += hypre__i0inc1;                                              \
             i2 += hypre__i0inc2;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         i1 += hypre__tkinc1[hypre__d];                                       \
+         i2 += hypre__tkinc2[hypre__d];                                       \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -2620,11 +2754,11 @@ typedef struct hypre_Boxloop_struct
                                dbox3, start3, stride3, i3)                    \
 {                                                                             \
    HYPRE_Int i1, i2, i3;                                                      \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
    zypre_BoxLoopDeclareK(3);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
@@ -2632,10 +2766,14 @@ typedef struct hypre_Boxloop_struct
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1, i2, i3;                                                   \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
-      zypre_BoxLoopSetK(3, i3);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopDeclareK(2);                                              \
+      zypre_TileLoopDeclareK(3);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
+      zypre_TileLoopSetK(2, i2);                                              \
+      zypre_TileLoopSetK(3, i3);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -2646,11 +2784,11 @@ typedef struct hypre_Boxloop_struct
             i2 += hypre__i0inc2;                                              \
             i3 += hypre__i0inc3;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         i3 += hypre__ikinc3[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         i1 += hypre__tkinc1[hypre__d];                                       \
+         i2 += hypre__tkinc2[hypre__d];                                       \
+         i3 += hypre__tkinc3[hypre__d];                                       \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -2662,12 +2800,12 @@ typedef struct hypre_Boxloop_struct
                             dbox4, start4, stride4, i4)                       \
 {                                                                             \
    HYPRE_Int i1, i2, i3, i4;                                                  \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
    zypre_BoxLoopDeclareK(3);                                                  \
    zypre_BoxLoopDeclareK(4);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
@@ -2676,11 +2814,16 @@ typedef struct hypre_Boxloop_struct
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1, i2, i3, i4;                                               \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
-      zypre_BoxLoopSetK(3, i3);                                               \
-      zypre_BoxLoopSetK(4, i4);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopDeclareK(2);                                              \
+      zypre_TileLoopDeclareK(3);                                              \
+      zypre_TileLoopDeclareK(4);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
+      zypre_TileLoopSetK(2, i2);                                              \
+      zypre_TileLoopSetK(3, i3);                                              \
+      zypre_TileLoopSetK(4, i4);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -2692,12 +2835,12 @@ typedef struct hypre_Boxloop_struct
             i3 += hypre__i0inc3;                                              \
             i4 += hypre__i0inc4;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         i3 += hypre__ikinc3[hypre__d];                                       \
-         i4 += hypre__ikinc4[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         i1 += hypre__tkinc1[hypre__d];                                       \
+         i2 += hypre__tkinc2[hypre__d];                                       \
+         i3 += hypre__tkinc3[hypre__d];                                       \
+         i4 += hypre__tkinc4[hypre__d];                                       \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -2706,19 +2849,22 @@ typedef struct hypre_Boxloop_struct
                                     stride1, i1,                              \
                                     stride2, i2)                              \
 {                                                                             \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BasicBoxLoopInitK(1, stride1);                                       \
    zypre_BasicBoxLoopInitK(2, stride2);                                       \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1, i2;                                                       \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopDeclareK(2);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
+      zypre_TileLoopSetK(2, i2);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
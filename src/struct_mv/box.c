@@ -411,6 +411,138 @@ hypre_BoxGetStrideVolume( hypre_Box   *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Computes the tile extents used by the host BoxLoops for a loop of size
+ * loop_size (see boxloop_host.h).  Dimension 0 is never split.  Extents set
+ * with HYPRE_SetStructBoxLoopTile() are used as given, clipped to the loop
+ * size.  Otherwise, with more than one thread, the loop is cut into bricks of
+ * about HYPRE_BOXLOOP_TILE_POINTS points (as square as the loop allows), and
+ * into at least one tile per thread.  With one thread the loop is one tile.
+ * The automatic extents are kept in a small cache in the handle, indexed by
+ * the loop size, since most loops run over the same few boxes.  The cache is
+ * shared by all threads, so entries are only read and written under a critical
+ * section, and an entry with a tile extent < 1 is treated as a miss.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_BOXLOOP_TILE_POINTS 8192
+
+HYPRE_Int
+hypre_BoxLoopGetTileSize( HYPRE_Int   ndim,
+                          HYPRE_Int  *loop_size,
+                          HYPRE_Int  *tile )
+{
+   HYPRE_Int              *user_tile   = hypre_HandleStructBoxLoopTile(hypre_handle());
+   HYPRE_Int               num_threads = hypre_NumThreads();
+   hypre_BoxLoopTileCache *entry;
+   hypre_BoxLoopTileCache  copy;
+   HYPRE_Int               rows, num_tiles, d, dmax;
+   hypre_ulonglongint      slot;
+
+   tile[0] = loop_size[0];
+   for (d = 1; d < ndim; d++)
+   {
+      tile[d] = hypre_max(loop_size[d], 1);
+   }
+
+   if (hypre_HandleStructBoxLoopTileUser(hypre_handle()))
+   {
+      for (d = 1; d < ndim; d++)
+      {
+         if (user_tile[d] > 0)
+         {
+            tile[d] = hypre_min(user_tile[d], tile[d]);
+         }
+      }
+      return hypre_error_flag;
+   }
+
+   if ((num_threads < 2) || (ndim < 2))
+   {
+      return hypre_error_flag;
+   }
+
+   slot = (hypre_ulonglongint) ndim;
+   for (d = 0; d < ndim; d++)
+   {
+      slot = slot * 31 + (hypre_ulonglongint) loop_size[d];
+   }
+   entry = &hypre_HandleStructBoxLoopTileCache(hypre_handle())[slot % HYPRE_BOXLOOP_TILE_CACHE_SIZE];
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_boxloop_tile_cache)
+#endif
+   copy = *entry;
+
+   if (copy.ndim == ndim && copy.num_threads == num_threads)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if (copy.loop_size[d] != loop_size[d] || (d > 0 && copy.tile[d] < 1))
+         {
+            break;
+         }
+      }
+      if (d == ndim)
+      {
+         for (d = 1; d < ndim; d++)
+         {
+            tile[d] = copy.tile[d];
+         }
+         return hypre_error_flag;
+      }
+   }
+
+   /* cache-sized bricks of whole rows */
+   rows = hypre_max(HYPRE_BOXLOOP_TILE_POINTS / hypre_max(loop_size[0], 1), 1);
+   for (d = 1; d < ndim; d++)
+   {
+      if (d < ndim - 1)
+      {
+         dmax = (HYPRE_Int) pow((HYPRE_Real) rows, 1.0 / (HYPRE_Real) (ndim - d));
+         tile[d] = hypre_min(tile[d], hypre_max(dmax, 1));
+         rows = hypre_max(rows / tile[d], 1);
+      }
+      else
+      {
+         tile[d] = hypre_min(tile[d], rows);
+      }
+   }
+
+   /* split the largest tile extent until every thread has a tile */
+   while (1)
+   {
+      num_tiles = 1;
+      dmax = 1;
+      for (d = 1; d < ndim; d++)
+      {
+         num_tiles *= (hypre_max(loop_size[d], 1) + tile[d] - 1) / tile[d];
+         if (tile[d] > tile[dmax])
+         {
+            dmax = d;
+         }
+      }
+      if ((num_tiles >= num_threads) || (tile[dmax] == 1))
+      {
+         break;
+      }
+      tile[dmax] = (tile[dmax] + 1) / 2;
+   }
+
+   copy.ndim        = ndim;
+   copy.num_threads = num_threads;
+   for (d = 0; d < ndim; d++)
+   {
+      copy.loop_size[d] = loop_size[d];
+      copy.tile[d]      = tile[d];
+   }
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_boxloop_tile_cache)
+#endif
+   *entry = copy;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Returns the rank of an index into a multi-D box where the assumed ordering is
  * dimension 0 first, then dimension 1, etc.
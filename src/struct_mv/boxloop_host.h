@@ -40,14 +40,99 @@ typedef struct hypre_Boxloop_struct
    HYPRE_Int bsize0,bsize1,bsize2;
 } hypre_Boxloop;
 
+/*--------------------------------------------------------------------------
+ * Tiled iteration.  The loop is cut into tiles (bricks) over dimensions
+ * 1..ndim-1; each tile covers whole rows in dimension 0, so the innermost
+ * loop stays unit-stride.  The tiles are the blocks handed out to the threads
+ * in a fixed order, so loops over the same box touch the same data from the
+ * same thread (consistent with first-touch placement).  See
+ * hypre_BoxLoopGetTileSize() for how the tile extents are chosen.
+ *--------------------------------------------------------------------------*/
+
+#define zypre_TileLoopDeclare() \
+HYPRE_Int  hypre__block, hypre__num_blocks;\
+HYPRE_Int  hypre__d, hypre__ndim;\
+HYPRE_Int  hypre__I, hypre__J, hypre__IN, hypre__JN;\
+HYPRE_Int  hypre__i[HYPRE_MAXDIM+1], hypre__n[HYPRE_MAXDIM+1];\
+HYPRE_Int  hypre__tile[HYPRE_MAXDIM+1], hypre__ntiles[HYPRE_MAXDIM+1]
+
+#define zypre_TileLoopInit(ndim, loop_size) \
+hypre__ndim = ndim;\
+for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__n[hypre__d] = loop_size[hypre__d];\
+}\
+hypre__n[hypre__ndim] = 2;\
+hypre_BoxLoopGetTileSize(hypre__ndim, hypre__n, hypre__tile);\
+hypre__num_blocks = 1;\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__ntiles[hypre__d] =\
+      (hypre__n[hypre__d] + hypre__tile[hypre__d] - 1) / hypre__tile[hypre__d];\
+   hypre__num_blocks *= hypre__ntiles[hypre__d];\
+}
+
+/* per-tile bounds, declared inside the block loop so they are private */
+#define zypre_TileLoopDeclareBlock() \
+HYPRE_Int  hypre__lo[HYPRE_MAXDIM+1], hypre__hi[HYPRE_MAXDIM+1]
+
+#define zypre_TileLoopDeclareK(k) \
+HYPRE_Int  hypre__tkinc##k[HYPRE_MAXDIM+1]
+
+#define zypre_TileLoopSet() \
+hypre__IN = hypre__n[0];\
+hypre__JN = 1;\
+hypre__J  = hypre__block;\
+hypre__lo[0] = 0;\
+hypre__hi[0] = hypre__n[0];\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__I = hypre__J % hypre__ntiles[hypre__d];\
+   hypre__J /= hypre__ntiles[hypre__d];\
+   hypre__lo[hypre__d] = hypre__I * hypre__tile[hypre__d];\
+   hypre__hi[hypre__d] = hypre_min(hypre__lo[hypre__d] + hypre__tile[hypre__d],\
+                                   hypre__n[hypre__d]);\
+   hypre__i[hypre__d] = hypre__lo[hypre__d];\
+   hypre__JN *= hypre__hi[hypre__d] - hypre__lo[hypre__d];\
+}\
+hypre__i[hypre__ndim]  = 0;\
+hypre__hi[hypre__ndim] = 2
+
+#define zypre_TileLoopSetK(k, ik) \
+zypre_BoxLoopSetK(k, ik);\
+hypre__tkinc##k[0] = 0;\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   hypre__tkinc##k[hypre__d] = hypre__tkinc##k[hypre__d-1] +\
+      hypre__sk##k[hypre__d] -\
+      (hypre__hi[hypre__d-1] - hypre__lo[hypre__d-1])*hypre__sk##k[hypre__d-1];\
+}\
+hypre__tkinc##k[hypre__ndim] = 0
+
+#define zypre_TileLoopInc1() \
+hypre__d = 1;\
+while ((hypre__i[hypre__d]+2) > hypre__hi[hypre__d])\
+{\
+   hypre__d++;\
+}
+
+#define zypre_TileLoopInc2() \
+hypre__i[hypre__d]++;\
+while (hypre__d > 1)\
+{\
+   hypre__d--;\
+   hypre__i[hypre__d] = hypre__lo[hypre__d];\
+}
+
 #define zypre_newBoxLoop0Begin(ndim, loop_size)                               \
 {                                                                             \
-   zypre_BoxLoopDeclare();                                                    \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopDeclare();                                                   \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
-      zypre_BoxLoopSet();                                                     \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopSet();                                                    \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -55,8 +140,8 @@ typedef struct hypre_Boxloop_struct
 
 #define zypre_newBoxLoop0End()                                                \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -65,16 +150,18 @@ typedef struct hypre_Boxloop_struct
                                dbox1, start1, stride1, i1)                    \
 {                                                                             \
    HYPRE_Int i1;                                                              \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1;                                                           \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -83,9 +170,9 @@ typedef struct hypre_Boxloop_struct
 #define zypre_newBoxLoop1End(i1)                                              \
             i1 += hypre__i0inc1;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         i1 += hypre__tkinc1[hypre__d];                                       \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -96,19 +183,22 @@ typedef struct hypre_Boxloop_struct
                                dbox2, start2, stride2, i2)                    \
 {                                                                             \
    HYPRE_Int i1, i2;                                                          \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1, i2;                                                       \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopDeclareK(2);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
+      zypre_TileLoopSetK(2, i2);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -118,10 +208,10 @@ typedef struct hypre_Boxloop_struct
             i1 += hypre__i0inc1;                                              \
             i2 += hypre__i0inc2;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         i1 += hypre__tkinc1[hypre__d];                                       \
+         i2 += hypre__tkinc2[hypre__d];                                       \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -133,11 +223,11 @@ typedef struct hypre_Boxloop_struct
                                dbox3, start3, stride3, i3)                    \
 {                                                                             \
    HYPRE_Int i1, i2, i3;                                                      \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
    zypre_BoxLoopDeclareK(3);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
@@ -145,10 +235,14 @@ typedef struct hypre_Boxloop_struct
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1, i2, i3;                                                   \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
-      zypre_BoxLoopSetK(3, i3);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopDeclareK(2);                                              \
+      zypre_TileLoopDeclareK(3);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
+      zypre_TileLoopSetK(2, i2);                                              \
+      zypre_TileLoopSetK(3, i3);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -159,11 +253,11 @@ typedef struct hypre_Boxloop_struct
             i2 += hypre__i0inc2;                                              \
             i3 += hypre__i0inc3;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         i3 += hypre__ikinc3[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         i1 += hypre__tkinc1[hypre__d];                                       \
+         i2 += hypre__tkinc2[hypre__d];                                       \
+         i3 += hypre__tkinc3[hypre__d];                                       \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -175,12 +269,12 @@ typedef struct hypre_Boxloop_struct
                             dbox4, start4, stride4, i4)                       \
 {                                                                             \
    HYPRE_Int i1, i2, i3, i4;                                                  \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
    zypre_BoxLoopDeclareK(3);                                                  \
    zypre_BoxLoopDeclareK(4);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
@@ -189,11 +283,16 @@ typedef struct hypre_Boxloop_struct
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1, i2, i3, i4;                                               \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
-      zypre_BoxLoopSetK(3, i3);                                               \
-      zypre_BoxLoopSetK(4, i4);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopDeclareK(2);                                              \
+      zypre_TileLoopDeclareK(3);                                              \
+      zypre_TileLoopDeclareK(4);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
+      zypre_TileLoopSetK(2, i2);                                              \
+      zypre_TileLoopSetK(3, i3);                                              \
+      zypre_TileLoopSetK(4, i4);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -205,12 +304,12 @@ typedef struct hypre_Boxloop_struct
             i3 += hypre__i0inc3;                                              \
             i4 += hypre__i0inc4;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         i3 += hypre__ikinc3[hypre__d];                                       \
-         i4 += hypre__ikinc4[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_TileLoopInc1();                                                \
+         i1 += hypre__tkinc1[hypre__d];                                       \
+         i2 += hypre__tkinc2[hypre__d];                                       \
+         i3 += hypre__tkinc3[hypre__d];                                       \
+         i4 += hypre__tkinc4[hypre__d];                                       \
+         zypre_TileLoopInc2();                                                \
       }                                                                       \
    }                                                                          \
 }
@@ -219,19 +318,22 @@ typedef struct hypre_Boxloop_struct
                                     stride1, i1,                              \
                                     stride2, i2)                              \
 {                                                                             \
-   zypre_BoxLoopDeclare();                                                    \
+   zypre_TileLoopDeclare();                                                   \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
-   zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_TileLoopInit(ndim, loop_size);                                       \
    zypre_BasicBoxLoopInitK(1, stride1);                                       \
    zypre_BasicBoxLoopInitK(2, stride2);                                       \
    OMP1                                                                       \
    for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
       HYPRE_Int i1, i2;                                                       \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
+      zypre_TileLoopDeclareBlock();                                           \
+      zypre_TileLoopDeclareK(1);                                              \
+      zypre_TileLoopDeclareK(2);                                              \
+      zypre_TileLoopSet();                                                    \
+      zypre_TileLoopSetK(1, i1);                                              \
+      zypre_TileLoopSetK(2, i2);                                              \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
          for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
@@ -771,6 +771,9 @@ hypre_CommTypeSetEntry( hypre_Box           *box,
  * Different "actions" are possible when the buffer data is unpacked:
  *   action = 0    - copy the data over existing values in memory
  *   action = 1    - add the data to existing values in memory
+ *
+ * With HYPRE_USING_PERSISTENT_COMM (host builds only), the communications
+ * after the first one go through hypre_InitializePersistentCommunication.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -812,6 +815,18 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
 
+#if defined(HYPRE_USING_PERSISTENT_COMM) && !defined(HYPRE_USING_GPU)
+   /* after the first communication, reuse the persistent exchange unless it
+    * is already in progress for another handle */
+   if ( !hypre_CommPkgFirstComm(comm_pkg) &&
+        !hypre_CommPkgPersistentActive(comm_pkg) )
+   {
+      return hypre_InitializePersistentCommunication(comm_pkg, send_data,
+                                                     recv_data, action, tag,
+                                                     comm_handle_ptr);
+   }
+#endif
+
    /*--------------------------------------------------------------------
     * allocate requests and status
     *--------------------------------------------------------------------*/
@@ -1102,6 +1117,9 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    hypre_CommHandleAction(comm_handle)      = action;
    hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers_device;
    hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers_device;
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   hypre_CommHandlePersistent(comm_handle)  = 0;
+#endif
 
    *comm_handle_ptr = comm_handle;
 
@@ -1148,6 +1166,13 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
    HYPRE_Complex      **send_buffers_device = hypre_CommHandleSendBuffersDevice(comm_handle);
    HYPRE_Complex      **recv_buffers_device = hypre_CommHandleRecvBuffersDevice(comm_handle);
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      return hypre_FinalizePersistentCommunication(comm_handle);
+   }
+#endif
+
    /*--------------------------------------------------------------------
     * finish communications
     *--------------------------------------------------------------------*/
@@ -1336,6 +1361,325 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
    return hypre_error_flag;
 }
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+
+/*--------------------------------------------------------------------------
+ * Set up the persistent exchange of a communication package.  This may only
+ * be called after the first communication, when the send and recv entries
+ * and buffer sizes are final.
+ *
+ * The send and recv buffers are allocated once, and the entries are compiled
+ * into index lists that give the data offset of each buffer value, so that
+ * packing and unpacking are single gather/scatter loops.  The persistent
+ * requests are (re)created whenever 'tag' changes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgSetupPersistent( hypre_CommPkg *comm_pkg,
+                              HYPRE_Int      tag )
+{
+   HYPRE_Int            ndim         = hypre_CommPkgNDim(comm_pkg);
+   HYPRE_Int            num_values   = hypre_CommPkgNumValues(comm_pkg);
+   HYPRE_Int            num_sends    = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs    = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm         = hypre_CommPkgComm(comm_pkg);
+
+   hypre_MPI_Request   *requests;
+   HYPRE_Complex       *buffer;
+   HYPRE_Int           *indices;
+
+   hypre_CommType      *comm_type;
+   hypre_CommEntryType *comm_entry;
+   HYPRE_Int           *length_array;
+   HYPRE_Int           *stride_array;
+   HYPRE_Int           *order;
+
+   HYPRE_Int            i, j, k, d, ll, m, r;
+   HYPRE_Int            size, offset, start;
+   HYPRE_Int            send_bufsize, recv_bufsize;
+
+   if (!hypre_CommPkgPersistent(comm_pkg))
+   {
+      /* the package buffer sizes also count local data, so add up the
+       * message sizes */
+      send_bufsize = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         send_bufsize += hypre_CommTypeBufsize(hypre_CommPkgSendType(comm_pkg, i));
+      }
+      recv_bufsize = 0;
+      for (i = 0; i < num_recvs; i++)
+      {
+         recv_bufsize += hypre_CommTypeBufsize(hypre_CommPkgRecvType(comm_pkg, i));
+      }
+      hypre_CommPkgNumSendIndices(comm_pkg) = send_bufsize;
+      hypre_CommPkgNumRecvIndices(comm_pkg) = recv_bufsize;
+
+      /* send index list, in the packing order of hypre_InitializeCommunication */
+      indices = hypre_TAlloc(HYPRE_Int, send_bufsize, HYPRE_MEMORY_HOST);
+      k = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         for (j = 0; j < hypre_CommTypeNumEntries(comm_type); j++)
+         {
+            comm_entry = hypre_CommTypeEntry(comm_type, j);
+            length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+            stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+            order = hypre_CommEntryTypeOrder(comm_entry);
+            size = 1;
+            for (d = 0; d < ndim; d++)
+            {
+               size *= length_array[d];
+            }
+
+            for (ll = 0; ll < num_values; ll++)
+            {
+               for (m = 0; m < size; m++)
+               {
+                  if (order[ll] > -1)
+                  {
+                     offset = hypre_CommEntryTypeOffset(comm_entry) +
+                        order[ll]*stride_array[ndim];
+                     r = m;
+                     for (d = 0; d < ndim; d++)
+                     {
+                        offset += (r % length_array[d]) * stride_array[d];
+                        r /= length_array[d];
+                     }
+                     indices[k++] = offset;
+                  }
+                  else
+                  {
+                     indices[k++] = -1;
+                  }
+               }
+            }
+         }
+      }
+      hypre_CommPkgSendIndices(comm_pkg) = indices;
+
+      /* recv index list; recv buffers may be larger than the data they hold
+       * when the send and recv boxes do not match */
+      indices = hypre_TAlloc(HYPRE_Int, recv_bufsize, HYPRE_MEMORY_HOST);
+      for (k = 0; k < recv_bufsize; k++)
+      {
+         indices[k] = -1;
+      }
+      start = 0;
+      for (i = 0; i < num_recvs; i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         k = start;
+         for (j = 0; j < hypre_CommTypeNumEntries(comm_type); j++)
+         {
+            comm_entry = hypre_CommTypeEntry(comm_type, j);
+            length_array = hypre_CommEntryTypeLengthArray(comm_entry);
+            stride_array = hypre_CommEntryTypeStrideArray(comm_entry);
+            size = 1;
+            for (d = 0; d < ndim; d++)
+            {
+               size *= length_array[d];
+            }
+
+            for (ll = 0; ll < num_values; ll++)
+            {
+               for (m = 0; m < size; m++)
+               {
+                  offset = hypre_CommEntryTypeOffset(comm_entry) +
+                     ll*stride_array[ndim];
+                  r = m;
+                  for (d = 0; d < ndim; d++)
+                  {
+                     offset += (r % length_array[d]) * stride_array[d];
+                     r /= length_array[d];
+                  }
+                  indices[k++] = offset;
+               }
+            }
+         }
+         start += hypre_CommTypeBufsize(comm_type);
+      }
+      hypre_CommPkgRecvIndices(comm_pkg) = indices;
+
+      hypre_CommPkgPersistentSendBuffer(comm_pkg) =
+         hypre_CTAlloc(HYPRE_Complex, send_bufsize, HYPRE_MEMORY_HOST);
+      hypre_CommPkgPersistentRecvBuffer(comm_pkg) =
+         hypre_CTAlloc(HYPRE_Complex, recv_bufsize, HYPRE_MEMORY_HOST);
+      hypre_CommPkgPersistentRequests(comm_pkg) =
+         hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+      hypre_CommPkgPersistentStatus(comm_pkg) =
+         hypre_CTAlloc(hypre_MPI_Status, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   }
+   else if (hypre_CommPkgPersistentTag(comm_pkg) != tag)
+   {
+      requests = hypre_CommPkgPersistentRequests(comm_pkg);
+      for (i = 0; i < (num_sends + num_recvs); i++)
+      {
+         hypre_MPI_Request_free(&requests[i]);
+      }
+   }
+   else
+   {
+      return hypre_error_flag;
+   }
+
+   /* create the persistent requests */
+   requests = hypre_CommPkgPersistentRequests(comm_pkg);
+   j = 0;
+   buffer = hypre_CommPkgPersistentRecvBuffer(comm_pkg);
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_MPI_Recv_init(buffer,
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+      buffer += hypre_CommTypeBufsize(comm_type);
+   }
+   buffer = hypre_CommPkgPersistentSendBuffer(comm_pkg);
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      hypre_MPI_Send_init(buffer,
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+      buffer += hypre_CommTypeBufsize(comm_type);
+   }
+
+   hypre_CommPkgPersistent(comm_pkg)    = 1;
+   hypre_CommPkgPersistentTag(comm_pkg) = tag;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Initialize a communication exchange with the persistent requests of
+ * comm_pkg.  Same arguments as hypre_InitializeCommunication, which calls
+ * this routine after the first communication.  The send buffer is packed
+ * with the send index list, the requests are started, and local data is
+ * exchanged, so that independent computations can overlap the exchange
+ * until hypre_FinalizeCommunication.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_InitializePersistentCommunication( hypre_CommPkg     *comm_pkg,
+                                         HYPRE_Complex     *send_data,
+                                         HYPRE_Complex     *recv_data,
+                                         HYPRE_Int          action,
+                                         HYPRE_Int          tag,
+                                         hypre_CommHandle **comm_handle_ptr )
+{
+   hypre_CommHandle    *comm_handle;
+   HYPRE_Int            num_requests;
+   HYPRE_Int            send_bufsize;
+   HYPRE_Complex       *send_buffer;
+   HYPRE_Int           *send_indices;
+   HYPRE_Int            i;
+
+   hypre_CommPkgSetupPersistent(comm_pkg, tag);
+
+   num_requests = hypre_CommPkgNumSends(comm_pkg) + hypre_CommPkgNumRecvs(comm_pkg);
+   send_bufsize = hypre_CommPkgNumSendIndices(comm_pkg);
+   send_buffer  = hypre_CommPkgPersistentSendBuffer(comm_pkg);
+   send_indices = hypre_CommPkgSendIndices(comm_pkg);
+
+   /*--------------------------------------------------------------------
+    * pack send buffer and start the requests
+    *--------------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < send_bufsize; i++)
+   {
+      send_buffer[i] = (send_indices[i] > -1) ? send_data[send_indices[i]] : 0.0;
+   }
+
+   if (num_requests)
+   {
+      hypre_MPI_Startall(num_requests, hypre_CommPkgPersistentRequests(comm_pkg));
+   }
+   hypre_CommPkgPersistentActive(comm_pkg) = 1;
+
+   hypre_ExchangeLocalData(comm_pkg, send_data, recv_data, action);
+
+   /*--------------------------------------------------------------------
+    * set up comm_handle and return
+    *--------------------------------------------------------------------*/
+
+   comm_handle = hypre_CTAlloc(hypre_CommHandle, 1, HYPRE_MEMORY_HOST);
+
+   hypre_CommHandleCommPkg(comm_handle)     = comm_pkg;
+   hypre_CommHandleSendData(comm_handle)    = send_data;
+   hypre_CommHandleRecvData(comm_handle)    = recv_data;
+   hypre_CommHandleNumRequests(comm_handle) = num_requests;
+   hypre_CommHandleRequests(comm_handle)    = hypre_CommPkgPersistentRequests(comm_pkg);
+   hypre_CommHandleStatus(comm_handle)      = hypre_CommPkgPersistentStatus(comm_pkg);
+   hypre_CommHandleAction(comm_handle)      = action;
+   hypre_CommHandlePersistent(comm_handle)  = 1;
+
+   *comm_handle_ptr = comm_handle;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Finalize a persistent communication exchange.  This routine blocks until
+ * the requests are completed, and unpacks the recv buffer with the recv
+ * index list.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FinalizePersistentCommunication( hypre_CommHandle *comm_handle )
+{
+   hypre_CommPkg       *comm_pkg     = hypre_CommHandleCommPkg(comm_handle);
+   HYPRE_Complex       *recv_data    = hypre_CommHandleRecvData(comm_handle);
+   HYPRE_Int            action       = hypre_CommHandleAction(comm_handle);
+   HYPRE_Int            recv_bufsize = hypre_CommPkgNumRecvIndices(comm_pkg);
+   HYPRE_Complex       *recv_buffer  = hypre_CommPkgPersistentRecvBuffer(comm_pkg);
+   HYPRE_Int           *recv_indices = hypre_CommPkgRecvIndices(comm_pkg);
+   HYPRE_Int            i;
+
+   if (hypre_CommHandleNumRequests(comm_handle))
+   {
+      hypre_MPI_Waitall(hypre_CommHandleNumRequests(comm_handle),
+                        hypre_CommHandleRequests(comm_handle),
+                        hypre_CommHandleStatus(comm_handle));
+   }
+
+   /* unpack in buffer order, since different entries may overlap */
+   if (action > 0)
+   {
+      for (i = 0; i < recv_bufsize; i++)
+      {
+         if (recv_indices[i] > -1)
+         {
+            recv_data[recv_indices[i]] += recv_buffer[i];
+         }
+      }
+   }
+   else
+   {
+      for (i = 0; i < recv_bufsize; i++)
+      {
+         if (recv_indices[i] > -1)
+         {
+            recv_data[recv_indices[i]] = recv_buffer[i];
+         }
+      }
+   }
+
+   hypre_CommPkgPersistentActive(comm_pkg) = 0;
+
+   hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+#endif
+
 /*--------------------------------------------------------------------------
  * Execute local data exchanges.
  *--------------------------------------------------------------------------*/
@@ -1462,6 +1806,23 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
       hypre_TFree(hypre_CommPkgIdentityOrder(comm_pkg), HYPRE_MEMORY_HOST);
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+      if (hypre_CommPkgPersistent(comm_pkg))
+      {
+         for (i = 0; i < (hypre_CommPkgNumSends(comm_pkg) +
+                          hypre_CommPkgNumRecvs(comm_pkg)); i++)
+         {
+            hypre_MPI_Request_free(&hypre_CommPkgPersistentRequests(comm_pkg)[i]);
+         }
+      }
+      hypre_TFree(hypre_CommPkgPersistentRequests(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgPersistentStatus(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgPersistentSendBuffer(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgPersistentRecvBuffer(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgSendIndices(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgRecvIndices(comm_pkg), HYPRE_MEMORY_HOST);
+#endif
+
       hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
    }
 
@@ -116,6 +116,24 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* persistent exchange, set up on the first communication after the first
+    * one (buffers have no prefix then and their layout no longer changes) */
+   HYPRE_Int          persistent;          /* persistent requests are set up */
+   HYPRE_Int          persistent_tag;
+   HYPRE_Int          persistent_active;   /* an exchange is in progress */
+   hypre_MPI_Request *persistent_requests; /* recvs, then sends */
+   hypre_MPI_Status  *persistent_status;
+   HYPRE_Complex     *persistent_send_buffer;
+   HYPRE_Complex     *persistent_recv_buffer;
+   HYPRE_Int          num_send_indices;    /* total message sizes (in doubles) */
+   HYPRE_Int          num_recv_indices;
+   HYPRE_Int         *send_indices;        /* send data offset for each send
+                                            * buffer value (-1 = zero) */
+   HYPRE_Int         *recv_indices;        /* recv data offset for each recv
+                                            * buffer value (-1 = unused) */
+#endif
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -142,6 +160,10 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   HYPRE_Int          persistent; /* uses the persistent exchange of comm_pkg */
+#endif
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -235,6 +257,18 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistent(comm_pkg)                 (comm_pkg -> persistent)
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentActive(comm_pkg)           (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentRequests(comm_pkg)         (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)           (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffer(comm_pkg)       (comm_pkg -> persistent_send_buffer)
+#define hypre_CommPkgPersistentRecvBuffer(comm_pkg)       (comm_pkg -> persistent_recv_buffer)
+#define hypre_CommPkgNumSendIndices(comm_pkg)             (comm_pkg -> num_send_indices)
+#define hypre_CommPkgNumRecvIndices(comm_pkg)             (comm_pkg -> num_recv_indices)
+#define hypre_CommPkgSendIndices(comm_pkg)                (comm_pkg -> send_indices)
+#define hypre_CommPkgRecvIndices(comm_pkg)                (comm_pkg -> recv_indices)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -250,5 +284,6 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_device)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_device)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 
 #endif
@@ -20,6 +20,18 @@
 #endif
 #define MAX_DEPTH 7
 
+/* the stencil-specialized kernels below are host-only */
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP) && \
+    !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS)
+#define HYPRE_MATVEC_KERNELS
+#endif
+
+#if defined(HYPRE_USING_OPENMP) && !defined(_MSC_VER)
+#define HYPRE_MATVEC_SIMD _Pragma("omp simd")
+#else
+#define HYPRE_MATVEC_SIMD
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecData data structure
  *--------------------------------------------------------------------------*/
@@ -29,6 +41,7 @@ typedef struct
    hypre_StructMatrix  *A;
    hypre_StructVector  *x;
    hypre_ComputePkg    *compute_pkg;
+   HYPRE_Int            kernel;   /* stencil kernel, 0 = generic */
 
 } hypre_StructMatvecData;
 
@@ -80,6 +93,197 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    (matvec_data -> A)           = hypre_StructMatrixRef(A);
    (matvec_data -> x)           = hypre_StructVectorRef(x);
    (matvec_data -> compute_pkg) = compute_pkg;
+   (matvec_data -> kernel)      = hypre_StructMatvecKernelSelect(A);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecKernelSelect
+ *
+ * Returns the stencil-specialized kernel to use for A, or 0 if the generic
+ * code must be used.  Kernels are keyed on (ndim, stencil size) for the
+ * compact stencils 5-pt and 9-pt in 2D, and 7-pt, 19-pt and 27-pt in 3D.
+ * The kernel number is the stencil size.  HYPRE_SetStructMatvecGeneric(1)
+ * turns the kernels off, which lets tests compare them to the generic code.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecKernelSelect( hypre_StructMatrix *A )
+{
+   HYPRE_Int kernel = 0;
+
+#ifdef HYPRE_MATVEC_KERNELS
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(A);
+   HYPRE_Int             si, d;
+
+   if (hypre_HandleStructMatvecGeneric(hypre_handle()) ||
+       hypre_StructMatrixConstantCoefficient(A) != 0)
+   {
+      return 0;
+   }
+
+   switch (ndim)
+   {
+      case 2:
+         if (stencil_size == 5 || stencil_size == 9)
+         {
+            kernel = stencil_size;
+         }
+         break;
+
+      case 3:
+         if (stencil_size == 7 || stencil_size == 19 || stencil_size == 27)
+         {
+            kernel = stencil_size;
+         }
+         break;
+   }
+
+   /* only compact (radius one) stencils */
+   for (si = 0; (si < stencil_size) && kernel; si++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         if (hypre_abs(hypre_IndexD(stencil_shape[si], d)) > 1)
+         {
+            kernel = 0;
+         }
+      }
+   }
+#endif
+
+   return kernel;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecKernelApply
+ *
+ * Computes y += coeff*A*x on box i over the points given by (loop_size,
+ * start, stride) with a stencil-specialized kernel (see
+ * hypre_StructMatvecKernelSelect).  The stencil sum is fully unrolled and the
+ * innermost loop runs along the unit-stride direction so that it vectorizes.
+ * Used by StructMatvec (coeff = 1) and by the SMG residual (coeff = -1).
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_MV_T(k) Ap[k][Aj] * xq[k][xj]
+
+#define HYPRE_MV_SUM5                                                  \
+   HYPRE_MV_T(0) + HYPRE_MV_T(1) + HYPRE_MV_T(2) + HYPRE_MV_T(3) +    \
+   HYPRE_MV_T(4)
+#define HYPRE_MV_SUM7                                                  \
+   HYPRE_MV_SUM5 + HYPRE_MV_T(5) + HYPRE_MV_T(6)
+#define HYPRE_MV_SUM9                                                  \
+   HYPRE_MV_SUM7 + HYPRE_MV_T(7) + HYPRE_MV_T(8)
+#define HYPRE_MV_SUM19                                                 \
+   HYPRE_MV_SUM9 + HYPRE_MV_T(9) + HYPRE_MV_T(10) + HYPRE_MV_T(11) +  \
+   HYPRE_MV_T(12) + HYPRE_MV_T(13) + HYPRE_MV_T(14) + HYPRE_MV_T(15) + \
+   HYPRE_MV_T(16) + HYPRE_MV_T(17) + HYPRE_MV_T(18)
+#define HYPRE_MV_SUM27                                                 \
+   HYPRE_MV_SUM19 + HYPRE_MV_T(19) + HYPRE_MV_T(20) + HYPRE_MV_T(21) + \
+   HYPRE_MV_T(22) + HYPRE_MV_T(23) + HYPRE_MV_T(24) + HYPRE_MV_T(25) + \
+   HYPRE_MV_T(26)
+
+/* one row of loop points along the unit-stride direction */
+#define HYPRE_MV_ROW(SUM)                                              \
+{                                                                      \
+   HYPRE_Int ii;                                                       \
+   if (s0 == 1)                                                        \
+   {                                                                   \
+      HYPRE_MATVEC_SIMD                                                \
+      for (ii = 0; ii < nx; ii++)                                      \
+      {                                                                \
+         HYPRE_Int Aj = Ai + ii, xj = xi + ii;                         \
+         yp[yi + ii] += coeff * (SUM);                                 \
+      }                                                                \
+   }                                                                   \
+   else                                                                \
+   {                                                                   \
+      for (ii = 0; ii < nx; ii++)                                      \
+      {                                                                \
+         HYPRE_Int Aj = Ai + ii*s0, xj = xi + ii*s0;                   \
+         yp[yi + ii*s0] += coeff * (SUM);                              \
+      }                                                                \
+   }                                                                   \
+}
+
+HYPRE_Int
+hypre_StructMatvecKernelApply( HYPRE_Int           kernel,
+                               HYPRE_Complex       coeff,
+                               hypre_StructMatrix *A,
+                               hypre_StructVector *x,
+                               hypre_StructVector *y,
+                               HYPRE_Int           i,
+                               hypre_Index         loop_size,
+                               hypre_IndexRef      start,
+                               hypre_IndexRef      stride )
+{
+#ifdef HYPRE_MATVEC_KERNELS
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(A);
+
+   hypre_Box            *A_data_box;
+   hypre_Box            *x_data_box;
+   hypre_Box            *y_data_box;
+   HYPRE_Complex        *Ap[27];
+   HYPRE_Complex        *xq[27];
+   HYPRE_Complex        *xp;
+   HYPRE_Complex        *yp;
+   hypre_Index           row_size;
+   HYPRE_Int             nx, s0, si;
+
+   A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+   x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+   y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+   xp = hypre_StructVectorBoxData(x, i);
+   yp = hypre_StructVectorBoxData(y, i);
+
+   /* hoist the coefficient pointers and the shifted x pointers */
+   for (si = 0; si < kernel; si++)
+   {
+      Ap[si] = hypre_StructMatrixBoxData(A, i, si);
+      xq[si] = xp + hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+   }
+
+   /* loop over rows, then along each row in the inner kernel */
+   nx = hypre_IndexD(loop_size, 0);
+   s0 = hypre_IndexD(stride, 0);
+   hypre_CopyIndex(loop_size, row_size);
+   hypre_IndexD(row_size, 0) = 1;
+
+   hypre_BoxLoop3Begin(ndim, row_size,
+                       A_data_box, start, stride, Ai,
+                       x_data_box, start, stride, xi,
+                       y_data_box, start, stride, yi);
+   {
+      switch (kernel)
+      {
+         case 5:
+            HYPRE_MV_ROW(HYPRE_MV_SUM5);
+            break;
+         case 7:
+            HYPRE_MV_ROW(HYPRE_MV_SUM7);
+            break;
+         case 9:
+            HYPRE_MV_ROW(HYPRE_MV_SUM9);
+            break;
+         case 19:
+            HYPRE_MV_ROW(HYPRE_MV_SUM19);
+            break;
+         case 27:
+            HYPRE_MV_ROW(HYPRE_MV_SUM27);
+            break;
+      }
+   }
+   hypre_BoxLoop3End(Ai, xi, yi);
+#else
+   hypre_error_in_arg(1);
+#endif
 
    return hypre_error_flag;
 }
@@ -252,7 +456,8 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
       {
          case 0:
          {
-            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride,
+                                   (matvec_data -> kernel) );
             break;
          }
          case 1:
@@ -281,7 +486,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC0
  * core of struct matvec computation, for the case constant_coefficient==0
- * (all coefficients are variable)
+ * (all coefficients are variable); kernel is from hypre_StructMatvecKernelSelect
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
@@ -289,7 +494,8 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
                                  hypre_StructVector *x,
                                  hypre_StructVector *y,
                                  hypre_BoxArrayArray     *compute_box_aa,
-                                 hypre_IndexRef           stride
+                                 hypre_IndexRef           stride,
+                                 HYPRE_Int                kernel
    )
 {
    HYPRE_Int i, j, si;
@@ -347,8 +553,15 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
          hypre_BoxGetSize(compute_box, loop_size);
          start  = hypre_BoxIMin(compute_box);
 
-         /* unroll up to depth MAX_DEPTH */
-         for (si = 0; si < stencil_size; si+= MAX_DEPTH)
+         /* use the stencil-specialized kernel if there is one */
+         if (kernel)
+         {
+            hypre_StructMatvecKernelApply(kernel, 1.0, A, x, y, i,
+                                          loop_size, start, stride);
+         }
+
+         /* otherwise unroll up to depth MAX_DEPTH */
+         for (si = 0; (si < stencil_size) && !kernel; si+= MAX_DEPTH)
          {
             depth = hypre_min(MAX_DEPTH, (stencil_size -si));
             switch(depth)
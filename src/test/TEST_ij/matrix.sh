@@ -24,6 +24,24 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -17 ${TNAME}.out.2 | head -6 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+# IJ: SELL-C-sigma matvec gives the same results as CSR
+#=============================================================================
+
+tail -3 ${TNAME}.out.11 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.13 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# IJ: dense and hash SpGEMM row accumulators give the same hierarchy
+#=============================================================================
+
+tail -21 ${TNAME}.out.0 | head -5 > ${TNAME}.testdata
+tail -21 ${TNAME}.out.14 | head -5 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+tail -21 ${TNAME}.out.15 | head -5 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -42,6 +60,9 @@ FILES="\
  ${TNAME}.out.10\
  ${TNAME}.out.11\
  ${TNAME}.out.12\
+ ${TNAME}.out.13\
+ ${TNAME}.out.14\
+ ${TNAME}.out.15\
 "
 
 for i in $FILES
@@ -127,6 +127,7 @@ FILES="\
  ${TNAME}.out.118\
  ${TNAME}.out.119\
  ${TNAME}.out.120\
+ ${TNAME}.out.121\
 "
 
 for i in $FILES
@@ -199,6 +200,19 @@ FILES="\
  ${TNAME}.out.323\
  ${TNAME}.out.324\
  ${TNAME}.out.325\
+ ${TNAME}.out.326\
+ ${TNAME}.out.327\
+ ${TNAME}.out.328\
+ ${TNAME}.out.329\
+ ${TNAME}.out.330\
+ ${TNAME}.out.331\
+ ${TNAME}.out.332\
+ ${TNAME}.out.333\
+ ${TNAME}.out.334\
+ ${TNAME}.out.335\
+ ${TNAME}.out.336\
+ ${TNAME}.out.337\
+ ${TNAME}.out.338\
 "
 
 for i in $FILES
@@ -70,6 +70,7 @@ FILES="\
  ${TNAME}.out.52\
  ${TNAME}.out.53\
  ${TNAME}.out.60\
+ ${TNAME}.out.61\
 "
 
 for i in $FILES
@@ -21,6 +21,19 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp  >&2
 tail -3 ${TNAME}.out.2 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp  >&2
 
+#=============================================================================
+# line relaxation in different orientations
+#=============================================================================
+
+tail -3 ${TNAME}.out.3 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.4 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp  >&2
+
+#=============================================================================
+
+tail -3 ${TNAME}.out.5 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp  >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -29,6 +42,9 @@ FILES="\
  ${TNAME}.out.0\
  ${TNAME}.out.1\
  ${TNAME}.out.2\
+ ${TNAME}.out.3\
+ ${TNAME}.out.4\
+ ${TNAME}.out.5\
 "
 
 for i in $FILES
@@ -118,6 +118,8 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           recompute_res_p = 0;
+   HYPRE_Int           pcg_pipelined = 0;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           debug_flag;
@@ -237,11 +239,15 @@ main( hypre_int argc,
    HYPRE_Int    mult_add = -1;
    HYPRE_Int    simple = -1;
    HYPRE_Int    add_last_lvl = -1;
+   HYPRE_Int    add_async = 0;
    HYPRE_Int    add_P_max_elmts = 0;
    HYPRE_Real   add_trunc_factor = 0;
    HYPRE_Int    rap2     = 0;
    HYPRE_Int    mod_rap2 = 0;
    HYPRE_Int    keepTranspose = 0;
+   HYPRE_Int    sp_level = -1;
+   HYPRE_Int    reuse_hierarchy = 0;
+   HYPRE_Int    num_resetups = 1;
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int    dslu_threshold = -1;
 #endif
@@ -254,12 +260,18 @@ main( hypre_int argc,
    HYPRE_Real   atol = 0.0;
    HYPRE_Real   max_row_sum = 1.;
    HYPRE_Int    converge_type = 0;
+   HYPRE_Int    lagged_conv_check = 0;
 
    HYPRE_Int  cheby_order = 2;
    HYPRE_Int  cheby_eig_est = 10;
    HYPRE_Int  cheby_variant = 0;
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
+   HYPRE_Int  cheby_ca = 0;
+
+   HYPRE_Int spmv_use_sell = 0;
+   HYPRE_Int relax_halo_overlap = 0;
+   HYPRE_Int spgemm_host_acc = 0;
 
 #if defined(HYPRE_USING_GPU)
    keepTranspose = 1;
@@ -299,6 +311,11 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+   HYPRE_Int    s_step = 1;
+   /* parameters for block PCG */
+   HYPRE_Int    num_rhs = 4;
+   HYPRE_Int    precond_multivec = 0;
+   HYPRE_Int    recycle_dim = 2;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -393,6 +410,11 @@ main( hypre_int argc,
    HYPRE_Int ilu_max_row_nnz = 1000;
    HYPRE_Int ilu_schur_max_iter = 3;
    HYPRE_Real ilu_nsh_droptol = 1.0e-02;
+   HYPRE_Int ilu_tri_solve = 0;
+   HYPRE_Int ilu_lower_jacobi_iters = 5;
+   HYPRE_Int ilu_upper_jacobi_iters = 5;
+   HYPRE_Int ilu_iter_setup_max_iter = 5;
+   HYPRE_Real ilu_iter_setup_tol = 0.0;
    /* end hypre ILU options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
@@ -1109,7 +1131,47 @@ main( hypre_int argc,
          arg_index++;
          ilu_nsh_droptol = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ilu_tri_solve") == 0 )
+      {                /* type of triangular solves */
+         arg_index++;
+         ilu_tri_solve = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_ljac_iters") == 0 )
+      {                /* Jacobi iterations for the L solve */
+         arg_index++;
+         ilu_lower_jacobi_iters = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_ujac_iters") == 0 )
+      {                /* Jacobi iterations for the U solve */
+         arg_index++;
+         ilu_upper_jacobi_iters = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_iter_setup_max_iter") == 0 )
+      {                /* max number of sweeps of the iterative ILU setup */
+         arg_index++;
+         ilu_iter_setup_max_iter = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_iter_setup_tol") == 0 )
+      {                /* stop tolerance of the iterative ILU setup */
+         arg_index++;
+         ilu_iter_setup_tol = atof(argv[arg_index++]);
+      }
       /* end ilu options */
+      else if ( strcmp(argv[arg_index], "-spmv_sell") == 0 )
+      {
+         arg_index++;
+         spmv_use_sell = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-relax_overlap") == 0 )
+      {
+         arg_index++;
+         relax_halo_overlap = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-spgemm_host_acc") == 0 )
+      {
+         arg_index++;
+         spgemm_host_acc = atoi(argv[arg_index++]);
+      }
 #if defined(HYPRE_USING_GPU)
       else if ( strcmp(argv[arg_index], "-exec_host") == 0 )
       {
@@ -1198,7 +1260,8 @@ main( hypre_int argc,
        || solver_id == 15 || solver_id == 20 || solver_id == 51 || solver_id == 61
        || solver_id == 16
        || solver_id == 70 || solver_id == 71 || solver_id == 72
-       || solver_id == 90 || solver_id == 91)
+       || solver_id == 90 || solver_id == 91 || solver_id == 100
+       || solver_id == 102)
    {
       strong_threshold = 0.25;
       strong_thresholdR = 0.25;
@@ -1229,6 +1292,7 @@ main( hypre_int argc,
    k_dim = 5;
    cgs = 1;
    unroll = 0;
+   s_step = 1;
 
    /* defaults for LGMRES - should use a larger k_dim, though*/
    aug_dim = 2;
@@ -1251,6 +1315,21 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-s_step") == 0 )
+      {
+         arg_index++;
+         s_step = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-num_rhs") == 0 )
+      {
+         arg_index++;
+         num_rhs = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-precond_mv") == 0 )
+      {
+         arg_index++;
+         precond_multivec = 1;
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1261,6 +1340,11 @@ main( hypre_int argc,
          arg_index++;
          aug_dim = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-recycle") == 0 )
+      {
+         arg_index++;
+         recycle_dim = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-w") == 0 )
       {
          arg_index++;
@@ -1353,6 +1437,11 @@ main( hypre_int argc,
          arg_index++;
          converge_type = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-lagged_conv") == 0 )
+      {
+         arg_index++;
+         lagged_conv_check = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-atol") == 0 )
       {
          arg_index++;
@@ -1463,6 +1552,16 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-recompute_p") == 0 )
+      {
+         arg_index++;
+         recompute_res_p = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-pcg_pipelined") == 0 )
+      {
+         arg_index++;
+         pcg_pipelined = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1596,6 +1695,11 @@ main( hypre_int argc,
          arg_index++;
          cheby_fraction = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cheby_ca") == 0 )
+      {
+         arg_index++;
+         cheby_ca = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-additive") == 0 )
       {
          arg_index++;
@@ -1616,6 +1720,11 @@ main( hypre_int argc,
          arg_index++;
          add_last_lvl  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-add_async") == 0 )
+      {
+         arg_index++;
+         add_async  = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-add_Pmx") == 0 )
       {
          arg_index++;
@@ -1651,6 +1760,21 @@ main( hypre_int argc,
          arg_index++;
          keepTranspose  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sp_level") == 0 )
+      {
+         arg_index++;
+         sp_level  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-reuse_hier") == 0 )
+      {
+         arg_index++;
+         reuse_hierarchy  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-num_resetups") == 0 )
+      {
+         arg_index++;
+         num_resetups  = atoi(argv[arg_index++]);
+      }
 #ifdef HYPRE_USING_DSUPERLU
       else if ( strcmp(argv[arg_index], "-dslu_th") == 0 )
       {
@@ -1862,6 +1986,8 @@ main( hypre_int argc,
          hypre_printf("       80=ILU      81=ILU-GMRES  \n");
          hypre_printf("       82=ILU-FlexGMRES  \n");
          hypre_printf("       90=AMG-DD          91=AMG-DD-GMRES  \n");
+         hypre_printf("       100=AMG-BlockPCG   101=DS-BlockPCG  \n");
+         hypre_printf("       102=AMG-GCRODR     103=DS-GCRODR  \n");
          hypre_printf("\n");
          hypre_printf("  -cljp                 : CLJP coarsening \n");
          hypre_printf("  -cljp1                : CLJP coarsening, fixed random \n");
@@ -1937,6 +2063,8 @@ main( hypre_int argc,
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -cheby_ca <val> : communication-avoiding Chebyshev on the <val> finest levels (default is 0)\n");
+         hypre_printf("  -add_async <val> : overlap additive levels with the coarse levels below -add_end (default is 0)\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -1977,15 +2105,26 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -s_step <val>          : block size of s-step COGMRES (default: 1, off)\n");
+         hypre_printf("  -num_rhs <val>         : number of right-hand sides for block PCG and GCRODR (default: 4)\n");
+         hypre_printf("  -precond_mv            : apply AMG to all right-hand sides at once in block PCG\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
+         hypre_printf("  -recycle <val>         : number of recycled vectors for GCRODR (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -lagged_conv <val>     : AMG solver: check convergence one cycle late (non-blocking reduction)\n");
+         hypre_printf("  -pcg_pipelined <val>   : use pipelined PCG (one non-blocking reduction per iteration)\n");
+         hypre_printf("  -recompute_p <val>     : recompute PCG residual every <val> iterations\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
+         hypre_printf("  -sp_level  <val>       : store AMG levels >= val in single precision (default: -1)\n");
+         hypre_printf("  -reuse_hier  <val>     : 1 = numeric-only AMG re-setup if the sparsity is unchanged;\n");
+         hypre_printf("                           solver 0 also re-solves with a scaled diagonal\n");
+         hypre_printf("  -num_resetups  <val>   : number of such re-setups (default: 1)\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
          hypre_printf("  -sai_filt <val>        : set ParaSAILS filter = val \n");
@@ -2009,6 +2148,10 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
          hypre_printf("\n");
+         hypre_printf("  -spmv_sell <val>       : use SELL-C-sigma storage in host matvecs\n");
+         hypre_printf("  -relax_overlap <val>   : hybrid G-S relaxes interior rows during halo exchange\n");
+         hypre_printf("  -spgemm_host_acc <val> : host SpGEMM rows: 0 adaptive, 1 dense marker, 2 hash\n");
+         hypre_printf("\n");
          /* begin lobpcg */
 
          hypre_printf("LOBPCG options:\n");
@@ -2105,6 +2248,7 @@ main( hypre_int argc,
          hypre_printf("  -ilu_type   <val>                : set ILU factorization type = val\n");
          hypre_printf("  -ilu_type   0                    : Block Jacobi with ILU(k) variants \n");
          hypre_printf("  -ilu_type   1                    : Block Jacobi with ILUT \n");
+         hypre_printf("  -ilu_type   2                    : Block Jacobi with iterative ILU(k) \n");
          hypre_printf("  -ilu_type   10                   : GMRES with ILU(k) variants \n");
          hypre_printf("  -ilu_type   11                   : GMRES with ILUT \n");
          hypre_printf("  -ilu_type   20                   : NSH with ILU(k) variants \n");
@@ -2120,6 +2264,12 @@ main( hypre_int argc,
          hypre_printf("  -ilu_schur_max_iter   <val>      : set max. num of iteration for GMRES/NSH Schur = val \n");
          hypre_printf("  -ilu_nsh_droptol   <val>         : set drop tolerance threshold for NSH = val \n");
          hypre_printf("  -ilu_sm_max_iter   <val>         : set number of iterations when applied as a smmother in AMG = val \n");
+         hypre_printf("  -ilu_tri_solve   <val>           : set type of triangular solves for BJ ILU = val \n");
+         hypre_printf("       0=sequential, 1=level-scheduled, 2=Jacobi iterations\n");
+         hypre_printf("  -ilu_ljac_iters   <val>          : set num. of Jacobi iterations for the L solve = val \n");
+         hypre_printf("  -ilu_ujac_iters   <val>          : set num. of Jacobi iterations for the U solve = val \n");
+         hypre_printf("  -ilu_iter_setup_max_iter   <val> : set max. num of sweeps of iterative ILU(k) = val \n");
+         hypre_printf("  -ilu_iter_setup_tol   <val>      : set stop tolerance of iterative ILU(k) = val \n");
          /* end ILU options */
          /* hypre AMG-DD options */
          hypre_printf("  -amgdd_start_level   <val>       : set AMG-DD start level = val\n");
@@ -2195,6 +2345,15 @@ main( hypre_int argc,
    /* default execution policy */
    HYPRE_SetExecutionPolicy(default_exec_policy);
 
+   /* SELL-C-sigma storage for host matvecs */
+   HYPRE_SetSpMVUseSELL(spmv_use_sell);
+
+   /* overlap of the halo exchange with host hybrid G-S */
+   HYPRE_SetRelaxHaloOverlap(relax_halo_overlap);
+
+   /* accumulator of host sparse matrix products */
+   HYPRE_SetSpGemmHostAccumulator(spgemm_host_acc);
+
 #if defined(HYPRE_USING_GPU)
 #if defined(HYPRE_USING_HIP)
    spgemm_use_cusparse = 1;
@@ -3466,6 +3625,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetIsolatedFPoints(amg_solver, num_isolated_fpt, isolated_fpt_index);
       HYPRE_BoomerAMGSetMeasureType(amg_solver, measure_type);
       HYPRE_BoomerAMGSetConvergeType(amg_solver, converge_type);
+      HYPRE_BoomerAMGSetLaggedConvCheck(amg_solver, lagged_conv_check);
       HYPRE_BoomerAMGSetTol(amg_solver, tol);
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
@@ -3502,6 +3662,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyCommAvoid(amg_solver, cheby_ca);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -3557,6 +3718,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetMultAdditive(amg_solver, mult_add);
       HYPRE_BoomerAMGSetSimple(amg_solver, simple);
       HYPRE_BoomerAMGSetAddLastLvl(amg_solver, add_last_lvl);
+      HYPRE_BoomerAMGSetAddAsync(amg_solver, add_async);
       HYPRE_BoomerAMGSetMultAddPMaxElmts(amg_solver, add_P_max_elmts);
       HYPRE_BoomerAMGSetMultAddTruncFactor(amg_solver, add_trunc_factor);
 
@@ -3564,6 +3726,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetSinglePrecisionLevel(amg_solver, sp_level);
+      HYPRE_BoomerAMGSetReuseHierarchy(amg_solver, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
       HYPRE_BoomerAMGSetDSLUThreshold(amg_solver, dslu_threshold);
 #endif
@@ -3681,6 +3845,69 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      /* change the values of A but not its sparsity, then set up and solve
+         again; with -reuse_hier 1 these setups are numeric-only */
+      if (solver_id == 0 && reuse_hierarchy)
+      {
+         HYPRE_Int resetup;
+
+         for (resetup = 0; resetup < num_resetups; resetup++)
+         {
+            hypre_CSRMatrix *A_diag   = hypre_ParCSRMatrixDiag(parcsr_A);
+            HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+            HYPRE_Int       *A_diag_j = hypre_CSRMatrixJ(A_diag);
+            HYPRE_Real      *A_diag_a = hypre_CSRMatrixData(A_diag);
+            HYPRE_Int        jj;
+
+            if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A_diag)) == hypre_MEMORY_HOST)
+            {
+               for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+               {
+                  for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+                  {
+                     if (A_diag_j[jj] == i)
+                     {
+                        A_diag_a[jj] *= 1.5;
+                     }
+                  }
+               }
+            }
+
+            HYPRE_ParVectorSetConstantValues(x, 0.0);
+
+            time_index = hypre_InitializeTiming("BoomerAMG Re-setup");
+            hypre_BeginTiming(time_index);
+
+            HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
+
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Re-setup phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+
+            time_index = hypre_InitializeTiming("BoomerAMG Solve");
+            hypre_BeginTiming(time_index);
+
+            HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+
+            hypre_EndTiming(time_index);
+            hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+            hypre_FinalizeTiming(time_index);
+            hypre_ClearTiming();
+
+            HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+            HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+
+            if (myid == 0)
+            {
+               hypre_printf("\n");
+               hypre_printf("BoomerAMG Iterations = %d\n", num_iterations);
+               hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+               hypre_printf("\n");
+            }
+         }
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       //HYPRE_ParVectorSetRandomValues(x, 775);
@@ -3825,6 +4052,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
+      HYPRE_BoomerAMGSetChebyCommAvoid(amg_solver, cheby_ca);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
@@ -3863,11 +4091,14 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetMultAdditive(amg_solver, mult_add);
       HYPRE_BoomerAMGSetSimple(amg_solver, simple);
       HYPRE_BoomerAMGSetAddLastLvl(amg_solver, add_last_lvl);
+      HYPRE_BoomerAMGSetAddAsync(amg_solver, add_async);
       HYPRE_BoomerAMGSetMultAddPMaxElmts(amg_solver, add_P_max_elmts);
       HYPRE_BoomerAMGSetMultAddTruncFactor(amg_solver, add_trunc_factor);
       HYPRE_BoomerAMGSetRAP2(amg_solver, rap2);
       HYPRE_BoomerAMGSetModuleRAP2(amg_solver, mod_rap2);
       HYPRE_BoomerAMGSetKeepTranspose(amg_solver, keepTranspose);
+      HYPRE_BoomerAMGSetSinglePrecisionLevel(amg_solver, sp_level);
+      HYPRE_BoomerAMGSetReuseHierarchy(amg_solver, reuse_hierarchy);
       if (nongalerk_tol)
       {
          HYPRE_BoomerAMGSetNonGalerkinTol(amg_solver, nongalerk_tol[nongalerk_num_tol-1]);
@@ -3948,6 +4179,8 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      HYPRE_PCGSetRecomputeResidualP(pcg_solver, recompute_res_p);
+      HYPRE_PCGSetPipelined(pcg_solver, pcg_pipelined);
 
       if (solver_id == 1)
       {
@@ -4000,6 +4233,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyCommAvoid(pcg_precond, cheby_ca);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -4040,11 +4274,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddAsync(pcg_precond, add_async);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetReuseHierarchy(pcg_precond, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4169,6 +4406,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyCommAvoid(pcg_precond, cheby_ca);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -4206,11 +4444,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddAsync(pcg_precond, add_async);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetReuseHierarchy(pcg_precond, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -4455,6 +4696,303 @@ main( hypre_int argc,
 
    }
 
+   /*-----------------------------------------------------------
+    * Solve num_rhs systems at once using block PCG.  The first
+    * right-hand side is b, the others are random.
+    *-----------------------------------------------------------*/
+
+   if (solver_id == 100 || solver_id == 101)
+   {
+      hypre_ParVector *B_multi, *X_multi;
+      hypre_Vector    *B_local;
+      HYPRE_Int        local_size;
+
+      if (num_rhs < 1)
+      {
+         num_rhs = 1;
+      }
+
+      B_multi = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD,
+                                           hypre_ParVectorGlobalSize((hypre_ParVector *) b),
+                                           hypre_ParVectorPartitioning((hypre_ParVector *) b),
+                                           num_rhs);
+      hypre_ParVectorInitialize(B_multi);
+      hypre_ParVectorSetPartitioningOwner(B_multi, 0);
+      X_multi = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD,
+                                           hypre_ParVectorGlobalSize((hypre_ParVector *) b),
+                                           hypre_ParVectorPartitioning((hypre_ParVector *) b),
+                                           num_rhs);
+      hypre_ParVectorInitialize(X_multi);
+      hypre_ParVectorSetPartitioningOwner(X_multi, 0);
+
+      B_local    = hypre_ParVectorLocalVector(B_multi);
+      local_size = hypre_VectorSize(B_local);
+      hypre_ParVectorSetRandomValues(B_multi, 22775);
+      hypre_TMemcpy(hypre_VectorData(B_local),
+                    hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) b)),
+                    HYPRE_Complex, local_size, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_ParVectorSetConstantValues(X_multi, 0.0);
+
+      time_index = hypre_InitializeTiming("BlockPCG Setup");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_ParCSRBlockPCGCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+      HYPRE_ParCSRBlockPCGSetMaxIter(pcg_solver, max_iter);
+      HYPRE_ParCSRBlockPCGSetTol(pcg_solver, tol);
+      HYPRE_ParCSRBlockPCGSetAbsoluteTol(pcg_solver, atol);
+      HYPRE_ParCSRBlockPCGSetPrintLevel(pcg_solver, ioutdat);
+
+      if (solver_id == 100)
+      {
+         /* use BoomerAMG as preconditioner */
+         if (myid == 0) hypre_printf("Solver: AMG-BlockPCG, %d right-hand sides\n", num_rhs);
+         HYPRE_BoomerAMGCreate(&pcg_precond);
+         HYPRE_BoomerAMGSetInterpType(pcg_precond, interp_type);
+         HYPRE_BoomerAMGSetPostInterpType(pcg_precond, post_interp_type);
+         HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
+         HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
+         HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
+         HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
+         HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
+         HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
+         HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
+         HYPRE_BoomerAMGSetPMaxElmts(pcg_precond, P_max_elmts);
+         HYPRE_BoomerAMGSetJacobiTruncThreshold(pcg_precond, jacobi_trunc_threshold);
+         HYPRE_BoomerAMGSetPrintLevel(pcg_precond, poutdat);
+         HYPRE_BoomerAMGSetPrintFileName(pcg_precond, "driver.out.log");
+         HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
+         HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
+         HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
+         if (relax_type > -1) HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type);
+         if (relax_down > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_down, 1);
+         if (relax_up > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_up, 2);
+         if (relax_coarse > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_coarse, 3);
+         HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
+         HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
+         HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
+         HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
+         HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
+         HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
+         HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
+         if (num_functions > 1)
+            HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
+         HYPRE_ParCSRBlockPCGSetMaxIter(pcg_solver, mg_max_iter);
+         HYPRE_ParCSRBlockPCGSetPrecondMultivec(pcg_solver, precond_multivec);
+         HYPRE_ParCSRBlockPCGSetPrecond(pcg_solver,
+                                        (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSolve,
+                                        (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSetup,
+                                        pcg_precond);
+      }
+      else if (solver_id == 101)
+      {
+         /* use diagonal scaling as preconditioner */
+         if (myid == 0) hypre_printf("Solver: DS-BlockPCG, %d right-hand sides\n", num_rhs);
+         pcg_precond = NULL;
+
+         HYPRE_ParCSRBlockPCGSetPrecond(pcg_solver,
+                                        (HYPRE_PtrToParSolverFcn) HYPRE_ParCSRDiagScale,
+                                        (HYPRE_PtrToParSolverFcn) HYPRE_ParCSRDiagScaleSetup,
+                                        pcg_precond);
+      }
+
+      HYPRE_ParCSRBlockPCGSetup(pcg_solver, parcsr_A,
+                                (HYPRE_ParVector) B_multi, (HYPRE_ParVector) X_multi);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      time_index = hypre_InitializeTiming("BlockPCG Solve");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_ParCSRBlockPCGSolve(pcg_solver, parcsr_A,
+                                (HYPRE_ParVector) B_multi, (HYPRE_ParVector) X_multi);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      HYPRE_ParCSRBlockPCGGetNumIterations(pcg_solver, &num_iterations);
+      HYPRE_ParCSRBlockPCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+
+      /* keep the solution of the first system for the usual output */
+      hypre_TMemcpy(hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) x)),
+                    hypre_VectorData(hypre_ParVectorLocalVector(X_multi)),
+                    HYPRE_Complex, local_size, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+      HYPRE_ParCSRBlockPCGDestroy(pcg_solver);
+      if (solver_id == 100)
+      {
+         HYPRE_BoomerAMGDestroy(pcg_precond);
+      }
+      hypre_ParVectorDestroy(B_multi);
+      hypre_ParVectorDestroy(X_multi);
+
+      if (myid == 0)
+      {
+         hypre_printf("\n");
+         hypre_printf("Iterations = %d\n", num_iterations);
+         hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+         hypre_printf("\n");
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Solve a sequence of num_rhs systems with GCRODR, recycling
+    * the deflation space from one solve to the next.  The first
+    * right-hand side is b, the others are random.
+    *-----------------------------------------------------------*/
+
+   if (solver_id == 102 || solver_id == 103)
+   {
+      HYPRE_ParVector  b_seq;
+      HYPRE_Int        i_rhs, num_recycled;
+
+      if (num_rhs < 1)
+      {
+         num_rhs = 1;
+      }
+
+      HYPRE_ParVectorCreate(hypre_MPI_COMM_WORLD,
+                            hypre_ParVectorGlobalSize((hypre_ParVector *) b),
+                            hypre_ParVectorPartitioning((hypre_ParVector *) b),
+                            &b_seq);
+      HYPRE_ParVectorInitialize(b_seq);
+      hypre_ParVectorSetPartitioningOwner((hypre_ParVector *) b_seq, 0);
+
+      time_index = hypre_InitializeTiming("GCRODR Setup");
+      hypre_BeginTiming(time_index);
+
+      HYPRE_ParCSRGCRODRCreate(hypre_MPI_COMM_WORLD, &pcg_solver);
+      HYPRE_ParCSRGCRODRSetKDim(pcg_solver, k_dim);
+      HYPRE_ParCSRGCRODRSetRecycleDim(pcg_solver, recycle_dim);
+      HYPRE_ParCSRGCRODRSetMaxIter(pcg_solver, max_iter);
+      HYPRE_ParCSRGCRODRSetTol(pcg_solver, tol);
+      HYPRE_ParCSRGCRODRSetAbsoluteTol(pcg_solver, atol);
+      HYPRE_ParCSRGCRODRSetLogging(pcg_solver, 1);
+      HYPRE_ParCSRGCRODRSetPrintLevel(pcg_solver, ioutdat);
+
+      if (solver_id == 102)
+      {
+         /* use BoomerAMG as preconditioner */
+         if (myid == 0) hypre_printf("Solver: AMG-GCRODR, %d right-hand sides\n", num_rhs);
+         HYPRE_BoomerAMGCreate(&pcg_precond);
+         HYPRE_BoomerAMGSetInterpType(pcg_precond, interp_type);
+         HYPRE_BoomerAMGSetPostInterpType(pcg_precond, post_interp_type);
+         HYPRE_BoomerAMGSetTol(pcg_precond, pc_tol);
+         HYPRE_BoomerAMGSetCoarsenType(pcg_precond, coarsen_type);
+         HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
+         HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
+         HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
+         HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
+         HYPRE_BoomerAMGSetTruncFactor(pcg_precond, trunc_factor);
+         HYPRE_BoomerAMGSetPMaxElmts(pcg_precond, P_max_elmts);
+         HYPRE_BoomerAMGSetJacobiTruncThreshold(pcg_precond, jacobi_trunc_threshold);
+         HYPRE_BoomerAMGSetPrintLevel(pcg_precond, poutdat);
+         HYPRE_BoomerAMGSetPrintFileName(pcg_precond, "driver.out.log");
+         HYPRE_BoomerAMGSetMaxIter(pcg_precond, 1);
+         HYPRE_BoomerAMGSetCycleType(pcg_precond, cycle_type);
+         HYPRE_BoomerAMGSetNumSweeps(pcg_precond, num_sweeps);
+         if (relax_type > -1) HYPRE_BoomerAMGSetRelaxType(pcg_precond, relax_type);
+         if (relax_down > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_down, 1);
+         if (relax_up > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_up, 2);
+         if (relax_coarse > -1)
+            HYPRE_BoomerAMGSetCycleRelaxType(pcg_precond, relax_coarse, 3);
+         HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
+         HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
+         HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
+         HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
+         HYPRE_BoomerAMGSetNumFunctions(pcg_precond, num_functions);
+         HYPRE_BoomerAMGSetAggNumLevels(pcg_precond, agg_num_levels);
+         HYPRE_BoomerAMGSetAggInterpType(pcg_precond, agg_interp_type);
+         HYPRE_BoomerAMGSetCycleNumSweeps(pcg_precond, ns_coarse, 3);
+         if (num_functions > 1)
+            HYPRE_BoomerAMGSetDofFunc(pcg_precond, dof_func);
+         HYPRE_ParCSRGCRODRSetMaxIter(pcg_solver, mg_max_iter);
+         HYPRE_ParCSRGCRODRSetPrecond(pcg_solver,
+                                      (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSolve,
+                                      (HYPRE_PtrToParSolverFcn) HYPRE_BoomerAMGSetup,
+                                      pcg_precond);
+      }
+      else if (solver_id == 103)
+      {
+         /* use diagonal scaling as preconditioner */
+         if (myid == 0) hypre_printf("Solver: DS-GCRODR, %d right-hand sides\n", num_rhs);
+         pcg_precond = NULL;
+
+         HYPRE_ParCSRGCRODRSetPrecond(pcg_solver,
+                                      (HYPRE_PtrToParSolverFcn) HYPRE_ParCSRDiagScale,
+                                      (HYPRE_PtrToParSolverFcn) HYPRE_ParCSRDiagScaleSetup,
+                                      pcg_precond);
+      }
+
+      HYPRE_ParCSRGCRODRSetup(pcg_solver, parcsr_A, b, x);
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      time_index = hypre_InitializeTiming("GCRODR Solve");
+      hypre_BeginTiming(time_index);
+
+      for (i_rhs = 0; i_rhs < num_rhs; i_rhs++)
+      {
+         if (i_rhs > 0)
+         {
+            HYPRE_ParVectorSetRandomValues(b_seq, 22775 + i_rhs);
+            HYPRE_ParVectorSetConstantValues(x, 0.0);
+            HYPRE_ParCSRGCRODRSolve(pcg_solver, parcsr_A, b_seq, x);
+         }
+         else
+         {
+            HYPRE_ParCSRGCRODRSolve(pcg_solver, parcsr_A, b, x);
+         }
+         HYPRE_ParCSRGCRODRGetNumIterations(pcg_solver, &num_iterations);
+         HYPRE_ParCSRGCRODRGetNumRecycled(pcg_solver, &num_recycled);
+         if (myid == 0 && num_rhs > 1)
+         {
+            hypre_printf("System %d: %d iterations, %d recycled vectors kept\n",
+                         i_rhs, num_iterations, num_recycled);
+         }
+      }
+
+      hypre_EndTiming(time_index);
+      hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
+      hypre_FinalizeTiming(time_index);
+      hypre_ClearTiming();
+
+      HYPRE_ParCSRGCRODRGetNumIterations(pcg_solver, &num_iterations);
+      HYPRE_ParCSRGCRODRGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+
+      HYPRE_ParCSRGCRODRDestroy(pcg_solver);
+      if (solver_id == 102)
+      {
+         HYPRE_BoomerAMGDestroy(pcg_precond);
+      }
+      HYPRE_ParVectorDestroy(b_seq);
+
+      if (myid == 0)
+      {
+         hypre_printf("\n");
+         hypre_printf("GCRODR Iterations = %d\n", num_iterations);
+         hypre_printf("Final GCRODR Relative Residual Norm = %e\n", final_res_norm);
+         hypre_printf("\n");
+      }
+   }
+
    /* begin lobpcg */
 
    /*-----------------------------------------------------------
@@ -5444,6 +5982,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(amg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(amg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(amg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyCommAvoid(amg_precond, cheby_ca);
          HYPRE_BoomerAMGSetRelaxOrder(amg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(amg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(amg_precond, outer_wt);
@@ -5491,11 +6030,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(amg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(amg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(amg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddAsync(amg_precond, add_async);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(amg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(amg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(amg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(amg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(amg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(amg_precond, sp_level);
+         HYPRE_BoomerAMGSetReuseHierarchy(amg_precond, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(amg_precond, dslu_threshold);
 #endif
@@ -5620,6 +6162,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyCommAvoid(pcg_precond, cheby_ca);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -5659,11 +6202,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddAsync(pcg_precond, add_async);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetReuseHierarchy(pcg_precond, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -5725,6 +6271,11 @@ main( hypre_int argc,
          HYPRE_ILUCreate(&pcg_precond);
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
+         HYPRE_ILUSetTriSolve(pcg_precond, ilu_tri_solve);
+         HYPRE_ILUSetLowerJacobiIters(pcg_precond, ilu_lower_jacobi_iters);
+         HYPRE_ILUSetUpperJacobiIters(pcg_precond, ilu_upper_jacobi_iters);
+         HYPRE_ILUSetIterativeSetupMaxIter(pcg_precond, ilu_iter_setup_max_iter);
+         HYPRE_ILUSetIterativeSetupTolerance(pcg_precond, ilu_iter_setup_tol);
          /* set print level */
          HYPRE_ILUSetPrintLevel(pcg_precond, 1);
          /* set max iterations */
@@ -5940,6 +6491,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyCommAvoid(pcg_precond, cheby_ca);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -5979,11 +6531,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddAsync(pcg_precond, add_async);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetReuseHierarchy(pcg_precond, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6126,6 +6681,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyCommAvoid(pcg_precond, cheby_ca);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6165,11 +6721,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddAsync(pcg_precond, add_async);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetReuseHierarchy(pcg_precond, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6306,6 +6865,11 @@ main( hypre_int argc,
          HYPRE_ILUCreate(&pcg_precond);
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
+         HYPRE_ILUSetTriSolve(pcg_precond, ilu_tri_solve);
+         HYPRE_ILUSetLowerJacobiIters(pcg_precond, ilu_lower_jacobi_iters);
+         HYPRE_ILUSetUpperJacobiIters(pcg_precond, ilu_upper_jacobi_iters);
+         HYPRE_ILUSetIterativeSetupMaxIter(pcg_precond, ilu_iter_setup_max_iter);
+         HYPRE_ILUSetIterativeSetupTolerance(pcg_precond, ilu_iter_setup_tol);
          /* set print level */
          HYPRE_ILUSetPrintLevel(pcg_precond, 1);
          /* set max iterations */
@@ -6490,6 +7054,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyCommAvoid(pcg_precond, cheby_ca);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6530,11 +7095,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddAsync(pcg_precond, add_async);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetReuseHierarchy(pcg_precond, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -6785,6 +7353,7 @@ main( hypre_int argc,
       HYPRE_COGMRESSetKDim(pcg_solver, k_dim);
       HYPRE_COGMRESSetUnroll(pcg_solver, unroll);
       HYPRE_COGMRESSetCGS(pcg_solver, cgs);
+      HYPRE_COGMRESSetSStep(pcg_solver, s_step);
       HYPRE_COGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_COGMRESSetTol(pcg_solver, tol);
       HYPRE_COGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -6841,6 +7410,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyCommAvoid(pcg_precond, cheby_ca);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -6881,11 +7451,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddAsync(pcg_precond, add_async);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetReuseHierarchy(pcg_precond, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7151,6 +7724,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
+         HYPRE_BoomerAMGSetChebyCommAvoid(pcg_precond, cheby_ca);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
@@ -7183,11 +7757,14 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMultAdditive(pcg_precond, mult_add);
          HYPRE_BoomerAMGSetSimple(pcg_precond, simple);
          HYPRE_BoomerAMGSetAddLastLvl(pcg_precond, add_last_lvl);
+         HYPRE_BoomerAMGSetAddAsync(pcg_precond, add_async);
          HYPRE_BoomerAMGSetMultAddPMaxElmts(pcg_precond, add_P_max_elmts);
          HYPRE_BoomerAMGSetMultAddTruncFactor(pcg_precond, add_trunc_factor);
          HYPRE_BoomerAMGSetRAP2(pcg_precond, rap2);
          HYPRE_BoomerAMGSetModuleRAP2(pcg_precond, mod_rap2);
          HYPRE_BoomerAMGSetKeepTranspose(pcg_precond, keepTranspose);
+         HYPRE_BoomerAMGSetSinglePrecisionLevel(pcg_precond, sp_level);
+         HYPRE_BoomerAMGSetReuseHierarchy(pcg_precond, reuse_hierarchy);
 #ifdef HYPRE_USING_DSUPERLU
          HYPRE_BoomerAMGSetDSLUThreshold(pcg_precond, dslu_threshold);
 #endif
@@ -7447,6 +8024,11 @@ main( hypre_int argc,
       HYPRE_ILUSetType(ilu_solver, ilu_type);
       /* set level of fill */
       HYPRE_ILUSetLevelOfFill(ilu_solver, ilu_lfil);
+      HYPRE_ILUSetTriSolve(ilu_solver, ilu_tri_solve);
+      HYPRE_ILUSetLowerJacobiIters(ilu_solver, ilu_lower_jacobi_iters);
+      HYPRE_ILUSetUpperJacobiIters(ilu_solver, ilu_upper_jacobi_iters);
+      HYPRE_ILUSetIterativeSetupMaxIter(ilu_solver, ilu_iter_setup_max_iter);
+      HYPRE_ILUSetIterativeSetupTolerance(ilu_solver, ilu_iter_setup_tol);
       /* set print level */
       HYPRE_ILUSetPrintLevel(ilu_solver, 2);
       /* set max iterations */
@@ -100,6 +100,9 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           tblock;
+   HYPRE_Int           tile[3];
+   HYPRE_Int           mv_generic;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -210,6 +213,9 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   tblock = 0;
+   tile[0] = tile[1] = tile[2] = 0;
+   mv_generic = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -401,6 +407,22 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-tblock") == 0 )
+      {
+         arg_index++;
+         tblock = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-tile") == 0 )
+      {
+         arg_index++;
+         tile[1] = atoi(argv[arg_index++]);
+         tile[2] = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mvgeneric") == 0 )
+      {
+         arg_index++;
+         mv_generic = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -587,8 +609,12 @@ main( hypre_int argc,
       hypre_printf("                        1 - Weighted Jacobi (default)\n");
       hypre_printf("                        2 - R/B Gauss-Seidel\n");
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
+      hypre_printf("                        4 - Line Jacobi (PFMG, along coarsening direction)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -tblock <t>         : temporal blocking in PFMG relaxation (0 or 1)\n");
+      hypre_printf("  -tile <ty> <tz>     : tile extents of the host box loops (0 = auto)\n");
+      hypre_printf("  -mvgeneric <g>      : generic matvec (1) or stencil kernels (0)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
@@ -724,6 +750,10 @@ main( hypre_int argc,
 
    hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
 
+   /* tiling of the host box loops */
+   HYPRE_SetStructBoxLoopTile(tile);
+   HYPRE_SetStructMatvecGeneric(mv_generic);
+
    for ( rep=0; rep<reps; ++rep )
    {
       time_index = hypre_InitializeTiming("Struct Interface");
@@ -1435,6 +1465,7 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetTemporalBlocking(solver, tblock);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1613,6 +1644,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1778,6 +1810,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2011,6 +2044,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2256,6 +2290,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2380,6 +2415,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2531,6 +2567,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2682,6 +2719,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2780,6 +2818,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -31,3 +31,48 @@ HYPRE_SetUseGpuRand( HYPRE_Int use_curand )
    return hypre_SetUseGpuRand(use_curand);
 }
 
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpMVUseSELL
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSpMVUseSELL( HYPRE_Int use_sell )
+{
+   return hypre_SetSpMVUseSELL(use_sell);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetRelaxHaloOverlap
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetRelaxHaloOverlap( HYPRE_Int overlap )
+{
+   return hypre_SetRelaxHaloOverlap(overlap);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetSpGemmHostAccumulator
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetSpGemmHostAccumulator( HYPRE_Int accumulator )
+{
+   return hypre_SetSpGemmHostAccumulator(accumulator);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructBoxLoopTile
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructBoxLoopTile( HYPRE_Int *tile )
+{
+   return hypre_SetStructBoxLoopTile(tile);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructMatvecGeneric
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_SetStructMatvecGeneric( HYPRE_Int generic )
+{
+   return hypre_SetStructMatvecGeneric(generic);
+}
@@ -231,6 +231,27 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
 HYPRE_Int HYPRE_SetSpGemmUseCusparse( HYPRE_Int use_cusparse );
 HYPRE_Int HYPRE_SetUseGpuRand( HYPRE_Int use_curand );
 
+/* host matvec with SELL-C-sigma copies of the matrices (built on first use) */
+HYPRE_Int HYPRE_SetSpMVUseSELL( HYPRE_Int use_sell );
+
+/* host hybrid Gauss-Seidel: relax rows without off-processor coupling first,
+ * overlapped with the halo exchange (changes the local relaxation order) */
+HYPRE_Int HYPRE_SetRelaxHaloOverlap( HYPRE_Int overlap );
+
+/* accumulator of the rows of host sparse matrix products: 0 (default) picks
+ * a hash table for rows much shorter than the number of columns and a dense
+ * marker otherwise, 1 always uses the dense marker, 2 always the hash table */
+HYPRE_Int HYPRE_SetSpGemmHostAccumulator( HYPRE_Int accumulator );
+
+/* tile extents of the host (OpenMP) struct box loops: tile[d] > 0 fixes the
+ * extent in dimension d > 0 (dimension 0 is never split), 0 lets it be chosen
+ * from the loop size and the number of threads; tile = NULL resets all */
+HYPRE_Int HYPRE_SetStructBoxLoopTile( HYPRE_Int *tile );
+
+/* host struct matrix-vector products: 1 always uses the generic stencil loop,
+ * 0 (default) picks a kernel specialized to the stencil where one exists */
+HYPRE_Int HYPRE_SetStructMatvecGeneric( HYPRE_Int generic );
+
 #ifdef __cplusplus
 }
 #endif
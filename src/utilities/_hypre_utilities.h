@@ -265,6 +265,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -436,6 +437,7 @@ HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request , hypre_MPI_Status *status
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count , hypre_MPI_Request *array_of_requests , hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_requests , HYPRE_Int *index , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
@@ -1209,12 +1211,35 @@ static char hypre__levelname[16];
 struct hypre_CudaData;
 typedef struct hypre_CudaData hypre_CudaData;
 
+/* host BoxLoops: tile extents chosen for a loop size, see hypre_BoxLoopGetTileSize */
+#define HYPRE_BOXLOOP_TILE_CACHE_SIZE 8
+typedef struct
+{
+   HYPRE_Int              ndim;
+   HYPRE_Int              num_threads;
+   HYPRE_Int              loop_size[HYPRE_MAXDIM];
+   HYPRE_Int              tile[HYPRE_MAXDIM];
+} hypre_BoxLoopTileCache;
+
 typedef struct
 {
    HYPRE_Int              hypre_error;
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   /* host SpMV: use SELL-C-sigma companion storage of hypre_CSRMatrix */
+   HYPRE_Int              spmv_use_sell;
+   /* host hybrid G-S: relax interior rows while the halo exchange is in flight */
+   HYPRE_Int              relax_halo_overlap;
+   /* host SpGEMM accumulator: 0 adaptive per row, 1 dense marker, 2 hash */
+   HYPRE_Int              spgemm_host_accumulator;
+   /* host BoxLoops: tile extents per dimension (0 = chosen automatically),
+      whether any of them is set, and the extents chosen for recent loops */
+   HYPRE_Int              struct_boxloop_tile[HYPRE_MAXDIM];
+   HYPRE_Int              struct_boxloop_tile_user;
+   hypre_BoxLoopTileCache struct_boxloop_tile_cache[HYPRE_BOXLOOP_TILE_CACHE_SIZE];
+   /* host StructMatvec: skip the stencil-specialized kernels */
+   HYPRE_Int              struct_matvec_generic;
 #if defined(HYPRE_USING_GPU)
    hypre_CudaData        *cuda_data;
    /* device G-S options */
@@ -1242,6 +1267,13 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSELL(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleRelaxHaloOverlap(hypre_handle)               ((hypre_handle) -> relax_halo_overlap)
+#define hypre_HandleSpgemmHostAccumulator(hypre_handle)          ((hypre_handle) -> spgemm_host_accumulator)
+#define hypre_HandleStructBoxLoopTile(hypre_handle)              ((hypre_handle) -> struct_boxloop_tile)
+#define hypre_HandleStructBoxLoopTileUser(hypre_handle)          ((hypre_handle) -> struct_boxloop_tile_user)
+#define hypre_HandleStructBoxLoopTileCache(hypre_handle)         ((hypre_handle) -> struct_boxloop_tile_cache)
+#define hypre_HandleStructMatvecGeneric(hypre_handle)            ((hypre_handle) -> struct_matvec_generic)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
 #define hypre_HandleDeviceGSMethod(hypre_handle)                 ((hypre_handle) -> device_gs_method)
 
@@ -1640,6 +1672,11 @@ HYPRE_Int hypre_SyncCudaComputeStream(hypre_Handle *hypre_handle);
 HYPRE_Int hypre_SetSpGemmUseCusparse( HYPRE_Int use_cusparse );
 HYPRE_Int hypre_SetUseGpuRand( HYPRE_Int use_gpurand );
 HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
+HYPRE_Int hypre_SetSpMVUseSELL( HYPRE_Int use_sell );
+HYPRE_Int hypre_SetRelaxHaloOverlap( HYPRE_Int overlap );
+HYPRE_Int hypre_SetSpGemmHostAccumulator( HYPRE_Int accumulator );
+HYPRE_Int hypre_SetStructBoxLoopTile( HYPRE_Int *tile );
+HYPRE_Int hypre_SetStructMatvecGeneric( HYPRE_Int generic );
 /******************************************************************************
  * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
  * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
@@ -41,3 +41,49 @@ hypre_SetGaussSeidelMethod( HYPRE_Int gs_method )
    return hypre_error_flag;
 }
 
+
+HYPRE_Int
+hypre_SetSpMVUseSELL( HYPRE_Int use_sell )
+{
+   hypre_HandleSpMVUseSELL(hypre_handle()) = use_sell;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SetRelaxHaloOverlap( HYPRE_Int overlap )
+{
+   hypre_HandleRelaxHaloOverlap(hypre_handle()) = overlap;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SetSpGemmHostAccumulator( HYPRE_Int accumulator )
+{
+   hypre_HandleSpgemmHostAccumulator(hypre_handle()) = accumulator;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SetStructBoxLoopTile( HYPRE_Int *tile )
+{
+   HYPRE_Int d;
+
+   hypre_HandleStructBoxLoopTileUser(hypre_handle()) = 0;
+   for (d = 0; d < HYPRE_MAXDIM; d++)
+   {
+      hypre_HandleStructBoxLoopTile(hypre_handle())[d] = tile ? tile[d] : 0;
+      /* dimension 0 is never split */
+      if (d > 0 && tile && tile[d] > 0)
+      {
+         hypre_HandleStructBoxLoopTileUser(hypre_handle()) = 1;
+      }
+   }
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_SetStructMatvecGeneric( HYPRE_Int generic )
+{
+   hypre_HandleStructMatvecGeneric(hypre_handle()) = generic;
+   return hypre_error_flag;
+}
@@ -553,6 +553,19 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+   return hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1181,6 +1194,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
                                     datatype, op, comm);
 }
 
+/* nonblocking reductions need MPI-3, older libraries get a blocking one */
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = hypre_MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
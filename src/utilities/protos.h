@@ -282,3 +282,8 @@ HYPRE_Int hypre_SyncCudaComputeStream(hypre_Handle *hypre_handle);
 HYPRE_Int hypre_SetSpGemmUseCusparse( HYPRE_Int use_cusparse );
 HYPRE_Int hypre_SetUseGpuRand( HYPRE_Int use_gpurand );
 HYPRE_Int hypre_SetGaussSeidelMethod( HYPRE_Int gs_method );
+HYPRE_Int hypre_SetSpMVUseSELL( HYPRE_Int use_sell );
+HYPRE_Int hypre_SetRelaxHaloOverlap( HYPRE_Int overlap );
+HYPRE_Int hypre_SetSpGemmHostAccumulator( HYPRE_Int accumulator );
+HYPRE_Int hypre_SetStructBoxLoopTile( HYPRE_Int *tile );
+HYPRE_Int hypre_SetStructMatvecGeneric( HYPRE_Int generic );